@@ -1,1033 +1,1060 @@
 #include "base_de_datos.h"
 
-float Datos_tres_aplausos_1[] = {
-0.96166, 0.99994, 0.99994, 0.99994, 0.29934, -1.04997, -1.04997, -0.89182, -0.87822, -1.04997, 
--1.05047, -1.05047, -1.04997, -1.04997, -1.04997, -1.04997, -1.04896, -1.04947, 0.99994, 0.99994, 
-0.99138, 0.99994, 0.99994, 0.99994, 0.53707, -1.04997, -1.05098, -1.04997, -1.04997, -1.04997, 
--1.04947, -1.04997, -1.05047, 0.82063, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.52952, -1.04997, -1.04947, -1.04947, -1.04997, -1.04997, -1.05199, 0.35223, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.40461, 0.50534, -0.12525, 
--1.05047, -1.05047, -1.04997, -1.04997, -1.04997, -1.04997, -0.07689, 0.56679, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.05910, -0.63848, -1.04947, -1.04947, -1.04997, -0.42341, 
-0.05456, 0.09888, 0.49426, 0.63931, 0.82164, 0.68414, 0.47109, 0.34618, -0.22699, -0.53069, 
--0.79210, -0.80972, -0.93262, -1.04947, -0.57451, -0.33275, -0.12071, 0.79495, 0.99994, 0.99994, 
-0.93748, 0.99994, 0.99994, 0.65543, 0.48368, -0.04567, -0.19223, -0.30656, -0.50047, -0.66517, 
--0.95730, -0.77447, -0.90441, -0.69287, -0.29599, -0.20029, -0.09704, 0.38899, 0.23790, 0.27214, 
-0.42274, 0.41166, -0.08445, -0.42543, -0.51710, -0.47731, -0.58862, -0.31009, 0.22732, 0.23387, 
-0.16486, 0.70681, 0.67155, 0.54513, -0.06581, 0.23034, 0.02535, -0.53321, -0.56293, -0.20180, 
--0.57199, -0.80721, -0.76641, -0.46169, -0.73115, -0.24058, 0.38043, 0.55470, 0.58139, 0.84632, 
-0.91834, 0.70378, 0.02535, -0.10107, -0.28793, -0.30052, -0.51508, -0.11920, 0.29682, 0.48620, 
-0.51290, 0.46454, 0.30891, -0.32822, -0.31462, -0.29901, -0.49393, -0.33275, -0.24864, -0.28944, 
-0.09838, 0.40108, 0.29985, 0.04147, 0.10392, 0.11601, 0.16285, 0.30438, 0.50181, 0.36784, 
--0.00286, -0.27080, -0.59869, -0.64200, -0.53422, -0.49292, -0.39974, -0.28088, 0.02182, 0.36583, 
-0.84028, 0.72443, 0.37842, 0.29279, 0.16285, -0.08092, -0.63646, -0.93816, -0.97996, -0.65661, 
--0.32621, 0.14875, 0.44692, 0.44440, 0.53103, 0.70177, 0.72292, 0.36784, 0.20667, 0.00621, 
--0.26627, -0.49090, -0.56746, -0.53775, -0.37607, -0.10258, 0.17494, 0.20314, 0.20667, 0.24344, 
-0.20768, 0.18652, 0.15076, 0.10493, -0.06732, -0.16151, -0.28692, -0.12172, -0.12071, 0.00218, 
-0.20868, 0.37187, 0.50937, 0.41468, 0.24746, 0.17544, -0.07236, 0.00319, 0.10090, 0.02938, 
--0.00185, 0.06010, 0.21271, 0.17292, 0.05255, -0.01545, -0.20382, -0.37859, -0.43198, -0.49191, 
--0.20634, -0.13482, -0.01998, 0.03844, 0.21271, 0.23538, 0.27214, 0.28474, 0.21926, 0.29279, 
-0.11097, -0.04013, -0.03408, -0.17964, -0.29397, -0.15194, -0.10862, -0.17561, -0.19777, -0.08092, 
--0.07488, -0.01847, -0.00940, -0.12575, -0.20986, -0.13834, -0.03056, -0.02804, -0.07639, 0.19508, 
-0.17544, 0.01729, -0.10711, -0.26677, -0.28340, -0.06178, 0.19055, 0.30035, 0.32755, 0.46454, 
-0.45044, 0.37338, 0.13313, -0.03257, -0.29045, -0.76842, -0.93362, -0.71352, -0.27433, 0.06010, 
-0.16285, 0.44087, 0.59046, 0.64637, 0.65040, 0.57837, 0.29733, -0.02552, -0.33124, -0.36046, 
--0.34333, -0.40931, -0.53372, -0.48839, -0.28692, 0.07018, 0.22279, 0.35424, 0.46354, 0.45145, 
-0.42576, 0.39051, 0.26610, 0.17091, -0.04416, -0.29297, -0.48788, -0.52112, -0.50249, -0.54580, 
--0.55940, -0.47529, -0.26325, -0.14690, 0.26812, 0.48771, 0.68565, 0.65694, 0.70932, 0.66702, 
-0.29531, -0.04113, -0.49997, -0.64553, -0.63495, -0.63243, -0.52364, -0.36851, -0.11719, 0.01427, 
-0.15932, 0.30639, 0.28171, 0.30186, 0.32503, 0.27315, 0.24595, 0.02938, -0.09553, -0.17712, 
--0.19374, -0.18770, -0.10510, -0.08344, -0.09402, -0.04063, 0.00571, 0.09234, 0.11601, 0.17292, 
-0.28222, 0.39756, 0.35172, 0.30740, 0.33007, 0.23890, 0.08025, -0.17511, -0.32873, -0.66618, 
--0.73216, -0.73619, -0.62387, -0.51659, -0.15093, 0.36633, 0.64788, 0.73300, 0.73451, 0.53153, 
-0.30085, 0.16134, -0.06330, -0.31009, -0.45615, -0.42442, -0.35189, -0.29145, -0.08143, -0.09251, 
--0.13179, -0.15899, 0.01981, 0.13414, 0.12155, 0.16033, 0.09234, 0.04600, -0.08143, -0.12575, 
--0.11668, -0.15698, -0.26879, -0.10258, 0.10896, 0.21876, 0.31949, 0.37388, 0.44289, 0.34518, 
-0.22027, 0.02686, -0.25217, -0.43752, -0.41737, -0.40679, -0.32419, -0.08898, 0.18602, 0.33309, 
-0.38849, 0.20113, -0.01847, -0.12978, -0.21188, -0.27735, -0.24713, -0.17612, -0.14640, 0.07622, 
-0.24797, 0.34467, 0.40310, 0.41317, 0.37187, 0.11702, -0.06380, -0.29800, -0.38161, -0.39269, 
--0.28037, -0.21893, -0.18417, -0.05121, 0.13867, 0.13464, 0.05104, 0.02132, 0.04902, 0.01729, 
--0.06732, -0.14640, -0.22648, -0.22195, -0.21339, -0.18971, -0.07840, -0.01192, -0.00286, 0.10342, 
-0.19458, 0.25502, 0.43029, 0.41317, 0.31395, 0.14321, -0.03358, -0.29649, -0.45263, -0.52918, 
--0.49594, -0.45011, -0.26375, 0.04701, 0.20163, 0.19508, 0.22329, 0.25401, 0.27164, 0.25703, 
-0.16738, 0.21170, 0.21674, 0.09284, -0.12222, -0.15849, -0.19425, -0.25368, -0.34786, -0.18367, 
--0.03257, 0.05960, 0.22178, 0.26106, 0.13414, 0.10644, 0.10291, 0.09032, 0.06866, -0.00034, 
--0.17309, -0.17511, -0.27131, -0.23504, -0.24058, -0.25267, -0.24008, -0.19475, -0.04113, 0.17192, 
-0.32906, 0.24142, 0.19307, 0.19508, 0.22279, 0.11551, -0.00638, -0.11920, -0.20029, -0.29045, 
--0.23253, -0.19777, -0.18720, -0.12978, -0.11417, 0.10090, 0.24847, 0.23487, 0.22984, 0.15026, 
-0.08075, -0.02401, -0.10762, -0.19374, -0.20835, -0.22950, -0.19828, -0.13582, -0.11316, -0.08697, 
-0.01528, 0.07924, 0.14623, 0.22984, 0.23689, 0.22681, 0.28574, 0.22329, 0.08176, -0.10963, 
--0.20936, -0.30858, -0.37607, -0.31513, -0.17007, 0.01880, 0.11953, 0.19760, 0.32553, 0.42425, 
-0.38496, 0.22631, -0.00487, -0.16151, -0.21943, -0.31311, -0.33477, -0.28944, -0.16504, 0.01377, 
-0.18098, 0.25653, 0.26106, 0.19660, 0.15882, 0.11702, -0.01998, -0.16453, -0.28188, -0.33427, 
--0.40176, -0.31613, -0.18417, -0.14993, -0.06833, 0.05758, 0.10795, 0.15429, 0.24394, 0.22631, 
-0.17544, 0.10442, 0.01578, -0.04416, -0.10409, -0.16403, -0.17561, -0.12927, -0.04667, -0.09150, 
--0.10258, -0.07740, -0.03056, 0.01326, 0.05809, 0.12659, 0.16486, 0.16134, 0.09385, 0.10644, 
-0.07924, 0.04550, -0.05070, -0.15446, -0.24814, -0.23958, -0.18518, 0.00017, 0.07269, 0.13918, 
-0.19609, 0.20314, 0.14119, 0.10392, 0.04449, -0.06833, -0.12273, -0.13431, -0.12575, -0.10862, 
--0.04063, -0.02048, 0.04399, 0.09536, 0.08126, 0.12507, 0.19760, 0.16285, 0.13162, 0.05104, 
-0.00268, -0.04013, -0.08193, -0.12827, -0.14791, -0.13784, -0.16755, -0.16403, -0.12776, -0.14791, 
--0.15093, -0.06481, -0.00235, 0.07219, 0.14724, 0.18098, 0.15781, 0.08327, 0.02333, 0.05355, 
--0.00991, -0.09251, -0.08999, -0.06430, -0.02502, -0.01746, 0.05758, 0.07269, -0.00789, -0.15144, 
--0.18367, -0.17662, -0.16151, -0.14287, -0.07488, 0.00369, 0.11500, 0.17343, 0.20415, 0.15832, 
-0.08176, 0.00520, -0.07387, -0.11366, -0.09503, -0.12172, -0.10611, -0.02048, -0.00638, 0.03190, 
-0.06967, 0.10745, 0.11802, 0.14069, 0.12105, 0.10896, 0.04449, 0.01880, -0.02300, -0.08143, 
--0.14640, -0.23756, -0.23001, -0.20130, -0.13935, -0.11769, -0.09956, -0.01797, 0.03190, 0.06312, 
-0.08428, 0.07622, 0.05607, 0.06061, 0.02787, -0.03811, -0.06430, -0.07639, -0.10460, -0.13985, 
--0.13733, -0.04466, 0.02686, 0.05960, 0.08126, 0.11601, 0.13213, 0.11853, 0.09536, 0.04550, 
--0.05322, -0.15949, -0.17712, -0.17108, -0.16705, -0.14539, -0.11064, -0.03761, 0.00369, 0.07018, 
-0.07924, 0.06715, 0.03341, 0.03996, 0.05859, 0.06212, 0.06967, 0.06363, 0.08176, 0.05507, 
-0.01729, -0.02401, 0.00772, -0.01696, -0.05876, -0.09503, -0.11417, -0.13683, -0.08898, -0.03459, 
--0.00789, 0.01779, 0.08025, 0.09788, 0.10090, 0.09838, 0.07672, 0.05557, -0.02300, -0.11971, 
--0.17410, -0.16403, -0.16302, -0.14791, -0.09251, 0.06061, 0.12004, 0.20465, 0.17947, 0.11047, 
-0.08579, 0.08377, 0.06715, -0.02854, -0.07740, -0.12122, -0.16252, -0.24159, -0.26929, -0.22749, 
--0.19475, -0.15849, -0.11870, -0.01595, 0.04650, 0.07773, 0.11399, 0.11551, 0.07874, 0.02031, 
-0.00369, 0.00571, -0.02099, -0.08143, -0.11064, -0.10913, -0.10057, -0.08092, -0.00537, 0.07521, 
-0.09586, 0.12608, 0.12608, 0.11953, 0.06464, -0.01897, -0.07790, -0.11417, -0.12323, -0.13028, 
--0.14237, -0.14136, -0.10812, -0.05322, 0.01225, 0.07420, 0.10493, 0.11198, 0.12004, 0.13313, 
-0.14421, 0.12205, 0.08982, 0.01679, -0.06682, -0.09855, -0.18166, -0.23656, -0.15144, -0.07992, 
--0.05020, 0.06665, 0.10493, 0.08126, 0.07169, 0.08327, 0.08730, 0.02233, -0.07387, -0.08243, 
--0.10460, -0.16453, -0.12625, -0.09956, -0.09754, -0.10308, -0.05423, 0.02636, 0.02283, 0.02233, 
-0.06866, 0.06312, 0.03039, 0.00923, 0.00974, 0.01326, -0.02502, -0.05121, -0.04113, -0.07689, 
--0.09805, -0.07840, -0.08495, -0.11114, -0.06128, 0.00823, 0.03240, 0.06917, 0.09385, 0.05758, 
-0.05104, 0.03794, -0.00840, -0.05624, -0.11417, -0.11870, -0.10661, -0.08042, -0.02955, 0.00420, 
-0.02837, 0.02787, 0.03492, 0.05154, 0.05255, 0.05507, 0.05355, 0.04600, -0.03106, -0.06581, 
--0.06632, -0.05272, -0.07740, -0.12273, -0.06632, -0.00185, 0.01427, 0.02686, 0.04399, 0.05053, 
-0.03744, 0.00369, -0.00487, -0.02199, -0.04970, -0.01494, -0.03660, -0.03056, -0.02653, -0.06632, 
--0.10258, -0.11568, -0.12273, -0.11467, -0.03459, 0.01981, 0.04902, 0.10342, 0.14421, 0.14824, 
-0.05607, -0.01595, -0.11568, -0.15345, -0.15698, -0.15748, -0.13985, -0.11417, -0.06632, 0.01628, 
-0.06413, 0.09284, 0.08226, 0.05607, 0.03844, -0.05070, -0.12172, -0.11971, -0.13784, -0.09553, 
--0.04667, -0.00537, 0.01377, 0.03844, 0.07874, 0.09939, 0.05960, 0.03442, 0.04449, 0.03895, 
-0.01981, 0.00923, 0.00923, -0.00487, -0.02955, -0.06732, -0.05977, -0.08193, -0.11316, -0.09251, 
--0.06934, -0.04718, -0.03358, -0.01998, 0.00671, 0.02031, -0.01192, -0.02502, -0.05121, -0.07689, 
--0.08898, -0.07689, -0.04466, 0.00722, 0.06061, 0.06514, 0.05557, 0.02636, 0.01125, -0.00991, 
--0.07387, -0.09956, -0.12726, -0.12877, -0.09503, -0.05524, 0.03341, 0.06866, 0.08226, 0.05204, 
-0.01981, -0.00688, -0.07941, -0.12525, -0.13129, -0.10711, -0.07891, -0.02099, 0.02283, 0.06866, 
-0.10191, 0.08579, 0.02485, 0.00621, -0.00235, -0.00537, -0.02653, -0.02602, -0.03106, -0.03761, 
--0.05373, -0.09503, -0.11064, -0.09855, -0.08546, -0.08646, -0.04466, 0.04147, 0.07672, 0.09032, 
-0.11853, 0.12306, 0.10543, 0.07521, 0.01175, -0.03358, -0.09049, -0.10762, -0.13179, -0.11165, 
--0.08193, -0.04214, -0.03056, 0.02182, 0.06061, 0.07370, 0.08780, 0.08377, 0.05809, -0.00688, 
--0.04667, -0.06682, -0.08193, -0.12273, -0.14590, -0.13381, -0.08797, -0.05775, -0.02401, 0.01729, 
-0.04197, 0.05859, 0.06715, 0.11500, 0.11500, 0.05910, 0.02031, -0.04013, -0.10460, -0.11971, 
--0.11769, -0.13935, -0.14388, -0.11668, -0.05373, -0.00134, 0.04852, 0.07874, 0.08428, 0.08025, 
-0.06161, 0.04147, 0.01326, -0.05221, -0.07387, -0.10308, -0.12222, -0.12273, -0.09654, -0.04416, 
-0.00319, 0.06312, 0.10644, 0.11097, 0.09435, 0.07572, 0.02686, -0.04617, -0.08143, -0.11316, 
--0.11467, -0.08848, -0.04063, -0.02905, -0.02250, -0.00840, -0.00286, -0.01494, -0.01746, -0.00185, 
--0.00286, -0.00286, -0.00638, -0.01293, -0.01847, -0.01897, -0.03912, -0.06380, -0.08193, -0.06833, 
--0.04063, -0.02149, -0.00940, 0.02535, 0.04550, 0.03391, 0.01175, -0.00588, -0.05221, -0.06984, 
--0.07740, -0.08999, -0.08344, -0.05624, -0.03106, -0.02552, -0.00588, 0.01377, -0.00034, -0.00991, 
--0.01444, -0.01847, -0.05423, -0.05725, -0.04667, -0.04264, -0.01696, 0.00671, 0.00671, 0.01377, 
-0.02787, 0.03089, 0.01377, -0.00235, -0.02250, -0.05473, -0.06581, -0.06178, -0.05221, -0.04315, 
--0.03559, -0.03358, -0.02199, -0.00588, 0.01225, 0.01326, 0.01125, 0.00168, -0.01192, -0.01797, 
--0.01998, -0.01897, -0.01696, -0.02804, -0.04516, -0.06430, -0.03912, -0.01595, -0.01041, -0.00638, 
--0.00638, 0.00772, 0.00369, -0.00940, -0.01545, -0.01645, -0.01243, -0.01696, -0.01293, -0.01041, 
--0.01394, -0.04013, -0.05725, -0.08546, -0.09301, -0.08898, -0.07337, -0.05675, -0.02703, 0.00369, 
-0.03089, 0.04247, 0.04298, 0.04247, 0.00369, -0.01293, -0.03811, -0.06027, -0.07085, -0.06330, 
--0.05322, -0.03761, 0.00117, -0.00437, -0.00487, -0.00084, -0.01091, -0.02703, -0.04466, -0.04416, 
--0.05121, -0.06279, -0.04113, -0.01696, -0.00588, -0.00487, 0.01225, 0.01981, 0.01578, 0.01326, 
--0.00588, 0.00117, -0.00286, -0.01645, -0.02300, -0.03761, -0.03610, -0.02854, -0.02300, -0.00991, 
-0.00017, -0.00638, -0.00991, -0.01091, -0.01595, -0.02653, -0.02451, -0.01444, -0.02552, -0.03559, 
--0.03408, -0.03408, -0.03509, -0.03056, -0.03005, -0.04516, -0.04013, -0.02300, -0.02602, -0.03862, 
--0.03710, -0.02804, -0.02602, -0.02602, -0.02401, -0.01394, -0.02703, -0.01091, 0.01125, 0.00268, 
-0.00319, -0.01091, -0.01394, -0.01444, -0.02300, -0.02451, -0.02703, -0.03811, -0.04768, -0.02653, 
--0.01998, -0.01696, -0.02401, -0.03005, -0.02048, -0.00286, 0.00369, 0.01326, 0.00974, 0.00571, 
--0.00235, -0.00437, -0.01998, -0.02099, -0.01595, -0.02602, -0.03509, -0.04013, -0.03710, -0.03610, 
--0.02703, -0.02703, -0.01394, 0.00017, 0.01326, 0.02434, 0.03442, 0.02988, 0.02585, 0.01578, 
-0.00974, -0.02854, -0.03459, -0.06078, -0.07035, -0.06330, -0.04819, -0.03056, -0.01595, -0.00386, 
-0.00722, 0.02736, 0.02837, 0.02082, 0.02283, 0.01779, -0.00537, -0.02149, -0.04013, -0.04416, 
--0.06027, -0.06632, -0.06833, -0.08495, -0.06430, -0.04466, -0.02754, -0.01746, 0.00571, 0.03643, 
-0.04348, 0.03593, 0.03542, 0.01981, -0.01847, -0.03660, -0.03358, -0.03308, -0.03912, -0.06380, 
--0.05775, -0.05171, -0.05624, -0.04667, -0.01847, -0.00185, 0.00117, -0.00084, -0.00084, 0.01175, 
-0.00671, -0.00134, 0.00117, 0.01326, 0.00369, -0.00235, 0.00117, 0.00117, -0.03862, -0.05272, 
--0.05826, -0.05624, -0.05725, -0.02804, -0.00991, 0.00621, 0.01578, 0.02485, 0.02686, 0.02434, 
-0.01326, -0.00437, -0.02955, -0.04315, -0.04567, -0.04718, -0.04869, -0.04667, -0.04315, -0.02703, 
--0.00487, 0.00671, 0.02233, 0.03139, 0.02837, 0.01024, -0.01394, -0.02703, -0.05121, -0.06330, 
--0.06531, -0.06078, -0.04516, -0.03811, -0.02905, -0.01091, -0.00134, 0.00420, -0.00940, -0.01696, 
--0.01746, -0.02602, -0.02401, -0.02250, -0.02099, -0.02451, -0.03408, -0.01343, -0.00991, -0.01696, 
--0.01343, -0.01041, -0.00537, -0.00588, -0.00588, -0.00134, 0.01225, 0.00772, -0.00134, 0.00117, 
-0.00117, -0.01343, -0.02703, -0.03912, -0.04516, -0.04013, -0.03610, -0.02351, -0.00940, 0.00017, 
-0.00571, 0.01528, 0.02686, 0.03341, 0.02333, 0.01074, -0.00437, -0.01243, -0.01293, -0.01645, 
--0.01847, -0.01897, -0.02451, -0.02451, -0.01746, -0.02099, -0.01293, -0.00437, 0.00168, -0.00084, 
--0.00084, -0.01192, -0.01797, -0.01847, -0.01343, -0.00638, -0.00437, -0.01343, -0.01595, -0.00840, 
--0.01192, -0.00739, -0.00386, -0.01444, -0.01746, -0.01494, -0.01243, -0.02199, -0.02250, -0.02250, 
--0.02048, -0.02199, -0.02653, -0.03106, -0.02955, -0.01948, -0.01394, -0.00487, -0.00185, 0.00369, 
-0.00772, -0.00134, -0.00890, -0.00940, -0.01394, -0.01494, -0.01847, -0.02099, -0.01293, -0.01645, 
--0.02300, -0.02401, -0.02250, -0.02502, -0.03056, -0.03509, -0.01444, -0.00940, 0.00017, 0.00369, 
-0.00268, 0.00017, -0.01696, -0.01444, -0.02754, -0.02854, -0.03559, -0.04567, -0.05423, -0.05121, 
--0.05020, -0.05121, -0.05121, -0.02804, -0.02099, -0.01494, -0.00991, -0.00588, -0.01645, -0.02401, 
--0.02552, -0.04264, -0.04869, -0.05876, -0.06481, -0.05927, -0.06078, -0.04667, -0.04214, -0.04264, 
--0.04819, -0.04869, -0.06229, -0.06531, -0.06833, -0.07387, -0.07740, -0.07740, -0.08143, -0.08395, 
--0.09301, -0.10661, -0.11819, -0.13683, -0.14690, -0.13582, -0.08143, 0.03844, 0.05104, -0.09754, 
--0.11165, 0.03996, -0.00134, -0.13532, -0.12776, -0.07790, -0.01897, -0.01293, -0.03358, -0.03408, 
-0.01931, 0.11349, 0.03794, -0.12474, -0.16252, -0.09452, 0.07320, -0.04617, -0.05876, 0.04147, 
-0.15127, 0.14421, 0.07269, 0.17645, 0.18501, 0.28171, 0.30085, 0.26006, 0.28625, 0.29632, 
-0.31848, 0.30992, 0.17695, 0.35172, 0.35525, 0.31546, 0.36683, 0.33913, 0.55268, 0.57535, 
-0.67004, 0.47210, 0.45749, 0.45749, 0.69018, 0.89669, 0.96166, -0.06833, -1.04947, -1.04947, 
--1.05047, -1.04947, -1.04997, -1.05047, -1.04997, -1.04947, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.04600, -1.05098, -1.04997, -1.04947, -1.05047, -1.04997, -1.04997, -0.14690, 
-0.47008, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.63025, -0.92305, -0.99809, -1.04997, 
--1.05047, -1.05047, -1.04947, -1.04745, -1.04796, -0.48385, 0.58542, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.86042, 0.07068, -0.38917, -0.54379, -0.44406, -0.49342, -0.78958, 
--1.02227, -1.04796, -1.05047, -0.65812, -0.32067, -0.00840, 0.42778, 0.50635, 0.64838, 0.96166, 
-0.99994, 0.70127, 0.28171, -0.20583, -0.68935, -0.62589, -0.60020, -0.56494, -0.20533, 0.11097, 
-0.43130, 0.43835, 0.41317, 0.33208, 0.27819, 0.26509, 0.14673, 0.04801, -0.03408, 0.03039, 
--0.07538, -0.28994, -0.18266, -0.19777, -0.25418, -0.23907, -0.11265, 0.09939, 0.05557, 0.08428, 
-0.31949, 0.35424, 0.17796, 0.17947, 0.09284, 0.01024, 0.05456, 0.00268, -0.18921, -0.10107, 
-0.01225, -0.08445, -0.14892, -0.18266, -0.15244, -0.15144, -0.21993, -0.15496, -0.01645, -0.05272, 
-0.08881, 0.16285, 0.04399, 0.03844, 0.03542, 0.06866, -0.10913, -0.21842, -0.24008, -0.14539, 
--0.13230, -0.09956, -0.01897, 0.10795, 0.21775, 0.07773, 0.11047, 0.30740, 0.19508, -0.01847, 
--0.03710, 0.01981, -0.03459, -0.18166, -0.28188, -0.12172, -0.09855, -0.15748, -0.13784, 0.02787, 
-0.00319, 0.06464, 0.09838, 0.22631, 0.34215, 0.10946, 0.18501, 0.20415, -0.01293, -0.28944, 
--0.24361, -0.19475, -0.10308, -0.03962, 0.03744, 0.08226, 0.34366, 0.39000, 0.24041, 0.12759, 
--0.04063, -0.13129, -0.19626, -0.09503, -0.15446, -0.06682, -0.04667, 0.05910, 0.18753, 0.11198, 
-0.09788, 0.13213, 0.09083, 0.06363, 0.05406, 0.06312, 0.08881, -0.06279, -0.14388, -0.19677, 
--0.25116, -0.29699, -0.20785, -0.06884, -0.05423, 0.07169, 0.22631, 0.30992, 0.35273, 0.39302, 
-0.26610, -0.02300, -0.12776, -0.26627, -0.31563, -0.45716, -0.36952, -0.25066, -0.15849, 0.01427, 
-0.14371, 0.33913, 0.37691, 0.32906, 0.29128, 0.15127, -0.00537, -0.11165, -0.12776, -0.26426, 
--0.30757, -0.25267, -0.21036, -0.03811, 0.06464, 0.11450, 0.21221, 0.20314, 0.18551, 0.11399, 
-0.06161, 0.01225, -0.01494, -0.06934, -0.11568, -0.06481, -0.07035, -0.02653, 0.06564, 0.07269, 
-0.06212, 0.06212, 0.11248, 0.03895, 0.01024, -0.08596, -0.07488, -0.11165, 0.02132, 0.01175, 
-0.04953, 0.04550, 0.09637, 0.09989, -0.06229, -0.13482, -0.18619, -0.23051, -0.27786, -0.18266, 
--0.05775, -0.02905, 0.00722, 0.04399, 0.05859, 0.05910, 0.03341, -0.02602, -0.06078, -0.08697, 
--0.13431, -0.18417, -0.04013, -0.03660, -0.06581, -0.06027, 0.05053, -0.06833, -0.10359, -0.09402, 
--0.11819, -0.07236, -0.06732, -0.07186, -0.01494, -0.04869, 0.04197, 0.05758, 0.01628, -0.01041, 
-0.04399, 0.05758, 0.01427, -0.05322, -0.11366, -0.11719, -0.13330, -0.03610, 0.12205, 0.15731, 
-0.15832, 0.21775, 0.21775, 0.22631, 0.10291, 0.05910, -0.03005, -0.14690, -0.27735, -0.29397, 
--0.13683, -0.04416, 0.13011, 0.19660, 0.20818, 0.19609, 0.15479, 0.12407, 0.09486, -0.02955, 
--0.07639, -0.08848, -0.16504, -0.18266, -0.13028, -0.15043, -0.12172, -0.10611, -0.07639, -0.01595, 
-0.04247, 0.09788, 0.09989, 0.09385, 0.10241, 0.03341, 0.03240, -0.03106, -0.15395, -0.24109, 
--0.28289, -0.21641, -0.20684, -0.14136, -0.08193, 0.00117, 0.06615, 0.10392, 0.13616, 0.17091, 
-0.18350, 0.20264, 0.10241, 0.07320, -0.03912, -0.14338, -0.22749, -0.21439, -0.17158, -0.10258, 
--0.06330, 0.00268, 0.06967, 0.08428, 0.09939, 0.12860, 0.14069, 0.05910, 0.00974, 0.05053, 
-0.04096, -0.01343, -0.01696, 0.02182, -0.00840, -0.02602, -0.08143, -0.10208, -0.06481, -0.05423, 
--0.03710, -0.00185, 0.05003, 0.06061, 0.05406, 0.04550, 0.12306, 0.12860, 0.12004, 0.10241, 
-0.08176, -0.01897, -0.09402, -0.18569, -0.21993, -0.26879, -0.28944, -0.28188, -0.18468, -0.12978, 
--0.00235, 0.12759, 0.20113, 0.24092, 0.23185, 0.22732, 0.13213, 0.09586, 0.00117, -0.09855, 
--0.15194, -0.22900, -0.23555, -0.20130, -0.16050, -0.13532, -0.09754, -0.03761, 0.03089, 0.01477, 
-0.05758, 0.07471, 0.08881, 0.09385, 0.05960, -0.01696, -0.04768, -0.07840, -0.17108, -0.12978, 
--0.04013, -0.05775, -0.03660, -0.00286, 0.07572, 0.14774, 0.14875, 0.12910, 0.11551, -0.01847, 
--0.09704, -0.12222, -0.15798, -0.15547, -0.15194, -0.07740, 0.00722, 0.06363, 0.10845, 0.13213, 
-0.15731, 0.15328, 0.10946, 0.04197, -0.10913, -0.13935, -0.16906, -0.15395, -0.12776, -0.08546, 
--0.00940, 0.04147, 0.08478, 0.12507, 0.12910, 0.13716, 0.09637, 0.07471, -0.02199, -0.09805, 
--0.16453, -0.18669, -0.18619, -0.16252, -0.12676, -0.10107, -0.06783, -0.01192, 0.03744, 0.04147, 
-0.00369, -0.01394, -0.01293, -0.02804, -0.03761, -0.11366, -0.14136, -0.12726, -0.13079, -0.11014, 
--0.07035, -0.03509, -0.01091, 0.04953, 0.13716, 0.15278, 0.13112, 0.08680, 0.04953, 0.00319, 
--0.04063, -0.14489, -0.18367, -0.21842, -0.18720, -0.11014, -0.09150, -0.00588, 0.09032, 0.14119, 
-0.13112, 0.11148, 0.08730, 0.08327, 0.01528, -0.03308, -0.04869, -0.03710, -0.04667, -0.06279, 
--0.06078, -0.05927, -0.08848, -0.02149, 0.02736, 0.05255, 0.05859, 0.04650, 0.04953, 0.06212, 
-0.05003, 0.00168, -0.03106, -0.03358, -0.02653, -0.05473, -0.09503, -0.10510, -0.07941, -0.12424, 
--0.11265, -0.07135, -0.06279, -0.05322, -0.02300, 0.04399, 0.08428, 0.10241, 0.07169, 0.04701, 
-0.02938, -0.01091, -0.05221, -0.10510, -0.13129, -0.12323, -0.12575, -0.13280, -0.10862, -0.02854, 
-0.00067, -0.00134, 0.00722, 0.07118, 0.09586, 0.08982, 0.04197, 0.03089, 0.02938, -0.01696, 
--0.05725, -0.09301, -0.07337, -0.09754, -0.10762, -0.06229, -0.00940, 0.01578, 0.02132, 0.07169, 
-0.08881, 0.11148, 0.12558, 0.12155, 0.11299, 0.08025, 0.07471, 0.04449, -0.06934, -0.11366, 
--0.13532, -0.12273, -0.11265, -0.09351, -0.01696, 0.07622, 0.12356, 0.15882, 0.17192, 0.14673, 
-0.05960, -0.01897, -0.08042, -0.17863, -0.18065, -0.15345, -0.09301, -0.05121, 0.04801, 0.09435, 
-0.11248, 0.11047, 0.08982, 0.06262, 0.03341, -0.00940, -0.03106, -0.08546, -0.12676, -0.13683, 
--0.14287, -0.14539, -0.08949, -0.04264, 0.02031, 0.06514, 0.06413, 0.07572, 0.08982, 0.08629, 
-0.04600, -0.00134, -0.05927, -0.10762, -0.09251, -0.10208, -0.08646, -0.05322, -0.05624, -0.04113, 
-0.00923, 0.00823, 0.01880, 0.02837, 0.02434, 0.02686, 0.03039, 0.02434, 0.01679, 0.01175, 
--0.00638, -0.03408, -0.02854, -0.06984, -0.09251, -0.08092, -0.06531, -0.04617, -0.03308, 0.01779, 
-0.05507, 0.06866, 0.08730, 0.06514, 0.04650, 0.00621, -0.02451, -0.04466, -0.06178, -0.08495, 
--0.07488, -0.05675, -0.02048, 0.01628, 0.02283, 0.02736, 0.02938, 0.02736, 0.01477, 0.00168, 
-0.01225, -0.00890, -0.00940, -0.02703, -0.07135, -0.07840, -0.08546, -0.08243, -0.08898, -0.07286, 
--0.06229, -0.04113, -0.03459, -0.03408, -0.03408, -0.03761, -0.03358, -0.02602, -0.02552, -0.00588, 
-0.02787, -0.00688, -0.02300, -0.02955, -0.02048, -0.01444, -0.02300, -0.04466, -0.03308, 0.00571, 
-0.00420, 0.01729, 0.02585, 0.01175, -0.00991, -0.04164, -0.09049, -0.08949, -0.07135, -0.02905, 
-0.03492, 0.05960, 0.07370, 0.08025, 0.08075, 0.07269, 0.03089, -0.00084, -0.02099, -0.07840, 
--0.06229, -0.05322, -0.03761, -0.01494, -0.00084, 0.01477, 0.03089, 0.03794, 0.04147, 0.04550, 
-0.05104, 0.03542, 0.02132, -0.00134, -0.02804, -0.02502, -0.04013, -0.04970, -0.09351, -0.10913, 
--0.08092, -0.06682, -0.03257, -0.01394, -0.00840, 0.02837, 0.03039, 0.03391, 0.03492, 0.00420, 
--0.00840, -0.01091, -0.01293, -0.03308, -0.05070, -0.05070, -0.05221, -0.04214, -0.03610, -0.01293, 
-0.01024, 0.02132, 0.03391, 0.04550, 0.02988, 0.03341, 0.01830, -0.00638, -0.05775, -0.08294, 
--0.08344, -0.07639, -0.04718, -0.02199, -0.00487, 0.00571, 0.01981, 0.02686, 0.01175, 0.00722, 
-0.00671, 0.00268, 0.00621, -0.00890, 0.00571, 0.01225, 0.02233, 0.02787, 0.03442, 0.02132, 
-0.01377, 0.01024, 0.00067, -0.01394, -0.00638, -0.02199, -0.03710, -0.05524, -0.03962, -0.02300, 
--0.01192, 0.00369, 0.01578, 0.04046, 0.04147, 0.01578, -0.01091, -0.02250, -0.04718, -0.06380, 
--0.08646, -0.09906, -0.09049, -0.06531, -0.04113, -0.01243, 0.03341, 0.04449, 0.05003, 0.04550, 
-0.03240, 0.00823, 0.00168, -0.01293, -0.05121, -0.09351, -0.09150, -0.11316, -0.11870, -0.11769, 
--0.08546, -0.05322, -0.01897, 0.00823, 0.02837, 0.02535, 0.03341, 0.03039, 0.00218, -0.02099, 
--0.05221, -0.05977, -0.06027, -0.04970, -0.03005, -0.03005, -0.01142, 0.02233, 0.02233, 0.02384, 
-0.03794, 0.03593, 0.02535, 0.02182, 0.01225, -0.00588, -0.03358, -0.03660, -0.04063, -0.04667, 
--0.05121, -0.05775, -0.04970, -0.04113, -0.02602, -0.01394, 0.02031, 0.03794, 0.04902, 0.04953, 
-0.04600, 0.02182, 0.00923, -0.00084, -0.04416, -0.06430, -0.08646, -0.09452, -0.08445, -0.05020, 
--0.00588, -0.00134, 0.01024, 0.03240, 0.04600, 0.03089, 0.00571, 0.00369, -0.01293, -0.05473, 
--0.06229, -0.06380, -0.05524, -0.06884, -0.06833, -0.03408, -0.03005, -0.01595, -0.00235, 0.00520, 
-0.00117, -0.00688, -0.00739, -0.00286, -0.01192, -0.01746, -0.00386, -0.00638, -0.01041, -0.02602, 
--0.02401, -0.04264, -0.04869, -0.03811, -0.03710, -0.03660, -0.00638, 0.00621, 0.00117, 0.00017, 
-0.00369, 0.01981, 0.00823, -0.00084, -0.00789, -0.02401, -0.04416, -0.06380, -0.05524, -0.04869, 
--0.03862, -0.02703, -0.01797, -0.00084, 0.01830, 0.01729, 0.00520, 0.00571, 0.00520, 0.00168, 
-0.00117, -0.00437, -0.01243, -0.03761, -0.03005, -0.02502, -0.03912, -0.02552, -0.01192, -0.00134, 
--0.01494, -0.01243, -0.02300, -0.03862, -0.02602, -0.03005, -0.03358, -0.03358, -0.02149, -0.02250, 
--0.02300, -0.02602, -0.04214, -0.06833, -0.06934, -0.06581, -0.07085, -0.06229, -0.05423, -0.03056, 
-0.00520, 0.02837, 0.03945, 0.03844, 0.02787, 0.00168, -0.02552, -0.04516, -0.06330, -0.09100, 
--0.09452, -0.08193, -0.04567, -0.01343, 0.00571, 0.01931, 0.02384, 0.02283, 0.01225, 0.00571, 
--0.00991, -0.02703, -0.06128, -0.06531, -0.05070, -0.04264, -0.03660, -0.02199, -0.00537, 0.00621, 
-0.00520, 0.00923, 0.01074, 0.01477, -0.00034, -0.00940, -0.01041, -0.00537, -0.00789, -0.01494, 
--0.01797, -0.02653, -0.03660, -0.03710, -0.03408, -0.03459, -0.04919, -0.03106, -0.01494, -0.00890, 
--0.00386, -0.00235, -0.01444, -0.02804, -0.04819, -0.05524, -0.05373, -0.03962, -0.00991, 0.01931, 
-0.02686, 0.02434, 0.02384, -0.00185, -0.01998, -0.04667, -0.06934, -0.06984, -0.06984, -0.05423, 
--0.03106, -0.01897, -0.00991, 0.01931, 0.03391, 0.02434, -0.01394, -0.03358, -0.04315, -0.05775, 
--0.06279, -0.06984, -0.05675, -0.02955, -0.00185, 0.00621, 0.02182, 0.02938, 0.02434, 0.01931, 
--0.00386, -0.01545, -0.01192, -0.00537, -0.00134, -0.00034, -0.00185, -0.00437, -0.00235, -0.02149, 
--0.04768, -0.04567, -0.04718, -0.03811, -0.02653, 0.00369, 0.03492, 0.04298, 0.04197, 0.03844, 
-0.03844, 0.03794, 0.01880, -0.00840, -0.04063, -0.06178, -0.05473, -0.05624, -0.05524, -0.04919, 
--0.01847, -0.00386, 0.00268, 0.01074, 0.02384, 0.02434, 0.01377, 0.01326, 0.01125, 0.00571, 
--0.01343, -0.02854, -0.04617, -0.05524, -0.06531, -0.06682, -0.06178, -0.05221, -0.04113, -0.03912, 
--0.02653, -0.00537, 0.01125, 0.01326, 0.00974, 0.01175, 0.00218, -0.00890, -0.03862, -0.04667, 
--0.05070, -0.06833, -0.06229, -0.05221, -0.04416, -0.03811, -0.01444, -0.00386, 0.01578, 0.02988, 
-0.02182, 0.01377, -0.00286, -0.02250, -0.03811, -0.03660, -0.04113, -0.05524, -0.05373, -0.04315, 
--0.03710, -0.02099, 0.00571, 0.01931, 0.02686, 0.03190, 0.03643, 0.02283, 0.00571, -0.00084, 
--0.02048, -0.04214, -0.05322, -0.05070, -0.04516, -0.03358, -0.01444, -0.00134, -0.00286, -0.00034, 
--0.00638, -0.02199, -0.02250, -0.02300, -0.02703, -0.01998, -0.02300, -0.02199, -0.02451, -0.02804, 
--0.03610, -0.03358, -0.02804, -0.02703, -0.00991, -0.00588, 0.00268, -0.00286, -0.00840, -0.02451, 
--0.02905, -0.03106, -0.05020, -0.04567, -0.04315, -0.02703, -0.01343, 0.00017, -0.00084, 0.00319, 
-0.00974, 0.01024, -0.00336, -0.01696, -0.02905, -0.04315, -0.04567, -0.03509, -0.02048, -0.01595, 
--0.00688, 0.00319, 0.00571, 0.00420, 0.00722, 0.00319, -0.00789, -0.01645, -0.01494, -0.01243, 
--0.01192, -0.01797, -0.01293, -0.01091, -0.00890, -0.00638, -0.00185, 0.00017, -0.00134, 0.00017, 
--0.00688, -0.00134, -0.00688, -0.00890, -0.00688, -0.00537, -0.01243, -0.01494, -0.01897, -0.03005, 
--0.02451, -0.01696, -0.01897, -0.01847, -0.01243, -0.00688, -0.00840, -0.01041, 0.00017, 0.00420, 
-0.00117, -0.00840, -0.00940, -0.02048, -0.02300, -0.03811, -0.04013, -0.03761, -0.04013, -0.03660, 
--0.02854, -0.01545, -0.00034, 0.00420, 0.01074, 0.01477, 0.01326, 0.00319, -0.00437, -0.02300, 
--0.03610, -0.03912, -0.03610, -0.03106, -0.02250, -0.01545, -0.01494, -0.01041, -0.00487, -0.00991, 
--0.00991, -0.01041, -0.01696, -0.01394, -0.01243, -0.03005, -0.02804, -0.01394, 0.00218, 0.00319, 
--0.01041, 0.00017, -0.01243, -0.02199, -0.02149, -0.02854, -0.00789, -0.00638, -0.00991, -0.00588, 
--0.00286, -0.01696, -0.01243, -0.01091, -0.01343, -0.01243, -0.02653, -0.02854, -0.02250, -0.02552, 
--0.02502, -0.02401, -0.02300, -0.02351, -0.02955, -0.01897, -0.01394, -0.02199, -0.02602, -0.02955, 
--0.03056, -0.03710, -0.04013, -0.03710, -0.02905, -0.03408, -0.02653, -0.02502, -0.02300, -0.02602, 
--0.02048, -0.01192, -0.01444, -0.01645, -0.02250, -0.02703, -0.03862, -0.03811, -0.04416, -0.04214, 
--0.04214, -0.04113, -0.04113, -0.03559, -0.03761, -0.03056, -0.02048, -0.01847, -0.02048, -0.02149, 
--0.02300, -0.03459, -0.03559, -0.04264, -0.04113, -0.04365, -0.03912, -0.03912, -0.03710, -0.04113, 
--0.04617, -0.03257, -0.03660, -0.03408, -0.03106, -0.02703, -0.02401, -0.01696, -0.01293, -0.01394, 
--0.01343, -0.02804, -0.03660, -0.04264, -0.04567, -0.05221, -0.05322, -0.04819, -0.04214, -0.04063, 
--0.02451, -0.01847, -0.01444, -0.01998, -0.03056, -0.03459, -0.03710, -0.05473, -0.06279, -0.07135, 
--0.07286, -0.07085, -0.07035, -0.07740, -0.07941, -0.07790, -0.07488, -0.07488, -0.08646, -0.09906, 
--0.10963, -0.11971, -0.16604, -0.21742, -0.25620, -0.34736, -0.40226, -0.07236, 0.15127, -0.28289, 
--0.53674, -0.19878, -0.00890, -0.02804, 0.04953, 0.11953, 0.16738, 0.24847, 0.43886, 0.02485, 
--0.43500, -0.65258, -0.37053, -0.50047, -1.04947, -1.04997, -1.04997, -1.04947, -1.04997, -0.57099, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.88863, 
--1.04997, -1.04947, -1.04997, -1.04947, -1.04896, -1.04896, -1.04947, -1.05047, -0.23152, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, -0.14640, 0.12457, -1.05098, 
--1.04997, -1.04997, -1.04997, -1.04997, -1.04947, 0.18300, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.02636, 0.35676, -0.65157, -1.05199, -1.04997, -1.05148, -1.05148, 
--1.04947, -1.02328, -1.04947, -1.04796, -0.36348, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.57031, 0.48116, 0.17443, -0.84196, -1.04947, -1.05047, -1.03939, 0.08579, 
-0.16889, 0.02233, 0.12306, 0.75214, 0.99994, 0.99994, 0.99994, 0.21221, -0.93614, -1.04997, 
--1.04997, -1.04947, -1.04997, -1.05047, -1.04997, -1.04997, 0.45548, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.01528, -0.40830, -0.36499, 
--0.72158, -1.04947, -1.05047, -1.04997, -1.04947, -0.86815, -0.73115, -0.34887, 0.19811, 0.15479, 
--0.02955, 0.13062, 0.40511, 0.18249, -0.05473, 0.03341, -0.22396, -0.88074, -0.23454, -0.20130, 
-0.08931, 0.43029, 0.63579, 0.87100, 0.61665, 0.76372, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.58039, 0.29884, -0.60927, -1.01975, -0.71201, -1.04997, -1.04947, -1.04997, -0.89232, -0.64855, 
--0.41082, 0.10342, 0.27970, 0.78588, 0.95612, 0.26761, 0.33057, 0.53103, 0.27164, 0.21120, 
-0.15529, 0.23991, 0.13162, 0.10644, 0.27567, 0.34266, 0.22631, 0.44188, 0.31042, 0.27768, 
-0.99994, 0.99994, 0.22631, 0.49275, 0.19609, -0.05070, -0.19425, -0.78253, -1.05047, -0.97341, 
--0.75482, -0.53422, 0.07018, 0.63478, 0.99994, 0.99994, 0.99994, 0.99994, 0.99339, 0.77581, 
-0.51541, -0.38665, -0.70496, -0.80519, -1.04997, -1.04997, -1.04796, -0.57754, -0.13079, 0.15076, 
-0.43936, 0.99540, 0.99994, 0.99994, 0.77329, 0.02434, -0.43601, -0.48839, -0.66366, -1.03688, 
--1.04947, -0.97895, -0.91751, -0.36146, 0.22430, 0.34215, 0.68213, 0.90172, 0.81157, 0.68515, 
-0.44138, 0.48973, 0.17645, 0.06816, -0.26023, -0.34182, -0.33830, -0.36751, -0.24310, -0.07387, 
--0.37254, -0.29095, 0.19811, -0.08646, 0.25200, 0.19257, 0.03442, -0.04567, -0.10107, 0.32906, 
-0.10493, 0.00974, 0.25351, 0.17192, 0.01225, -0.15446, 0.10442, 0.26308, 0.39655, 0.59801, 
-0.71587, 0.62420, 0.33863, 0.51995, -0.00940, -0.21188, 0.00017, 0.08277, 0.10745, -0.02905, 
--0.13079, -0.18317, 0.00621, -0.49141, -0.73518, -0.57048, -0.72561, -1.04896, -0.56645, 0.03341, 
-0.31647, 0.57333, 0.65795, 0.79293, 0.59046, 0.33712, 0.13162, -0.12474, -0.51156, -0.38362, 
--0.39974, -0.72209, -0.38413, -0.24411, -0.35189, -0.29951, -0.00789, -0.28944, -0.10510, -0.02905, 
--0.40881, -0.36297, -0.15194, -0.23807, -0.46018, -0.30455, -0.24965, 0.00420, 0.20465, 0.35877, 
-0.65090, 0.89971, 0.83524, 0.67155, 0.51793, 0.54110, 0.36532, 0.23387, 0.21473, 0.17746, 
--0.17007, -0.61380, -0.63395, -0.71101, -0.65057, -0.62538, -0.59667, -0.29448, 0.00671, 0.29531, 
-0.39101, 0.73854, 0.80905, 0.83272, 0.99994, 0.99994, 0.07320, -0.25066, -0.54983, -0.80318, 
--1.04997, -1.02177, -0.92154, -0.42140, -0.00739, 0.30589, 0.70278, 0.99994, 0.90424, 0.83776, 
-0.70127, 0.41468, 0.20717, 0.09385, -0.46975, -0.60826, -1.05148, -1.04947, -1.04947, -0.76188, 
--0.60574, -0.56091, -0.07438, 0.24948, 0.43281, 0.93094, 0.99994, 0.57182, 0.67659, 0.67860, 
-0.44692, 0.10191, -0.06330, -0.41384, -0.79210, -0.85858, -1.05047, -1.04745, -0.80318, -0.87167, 
--0.57502, 0.00621, 0.28725, 0.34920, 0.67659, 0.55168, 0.42073, 0.58744, 0.51793, 0.40562, 
-0.27366, 0.17897, 0.08226, -0.13935, -0.38816, -0.35895, -0.31110, -0.11819, 0.04650, 0.01528, 
-0.14824, 0.62068, 0.51088, 0.47109, 0.83625, 0.61262, 0.31344, 0.20516, 0.21725, -0.18115, 
--0.72007, -0.93060, -1.04997, -1.04997, -0.82282, -0.81677, -0.59819, -0.34535, -0.23001, 0.45346, 
-0.78034, 0.94705, 0.99641, 0.99994, 0.85186, 0.57182, 0.11450, -0.17007, -0.27584, -0.65006, 
--0.57754, -0.61330, -0.77396, -0.50047, -0.18569, 0.11500, 0.27366, 0.33661, -0.02955, -0.45716, 
--0.42341, -0.39672, -0.61481, -0.26879, -0.25922, -0.32822, -0.16957, -0.02199, 0.40159, 0.48771, 
-0.65442, 0.55823, 0.82013, 0.56477, -0.01746, 0.07018, 0.08881, -0.07387, -0.27080, -0.29901, 
--0.24008, -0.28440, -0.13280, -0.07589, 0.00823, 0.00218, -0.05675, 0.11853, 0.11702, -0.19576, 
--0.28994, -0.23807, -0.18619, -0.25469, -0.33124, 0.07420, 0.35223, 0.49073, 0.61464, 0.81912, 
-0.54160, 0.42073, 0.34316, 0.23739, 0.12457, -0.08697, -0.28944, -0.53775, -0.44910, -0.43752, 
--0.38765, -0.40730, -0.35189, -0.04869, 0.12810, 0.11148, 0.09989, 0.11953, -0.09553, -0.38514, 
--0.37103, -0.31513, -0.31513, -0.33830, -0.28037, 0.00823, 0.38950, 0.63780, 0.74559, 0.64989, 
-0.59449, 0.40410, 0.07572, 0.05859, -0.17410, -0.44155, -0.68482, -0.65157, -0.71453, -0.73921, 
--0.63949, -0.43298, -0.23807, 0.10996, 0.41921, 0.57132, 0.77228, 0.68464, 0.43029, 0.36381, 
-0.17997, 0.06363, 0.02384, -0.00185, -0.11316, -0.23404, -0.24612, -0.16201, -0.03761, 0.03139, 
-0.02283, 0.03341, 0.23135, 0.28323, 0.32352, 0.22178, -0.03862, -0.05373, -0.23656, -0.32117, 
--0.53976, -0.57048, -0.48587, -0.24713, -0.20734, -0.11265, -0.04013, 0.22127, 0.45246, 0.28776, 
-0.39806, 0.32453, 0.21926, 0.04902, -0.13633, -0.22749, -0.24109, -0.51055, -0.60322, -0.53019, 
--0.27584, -0.13532, -0.09200, 0.06665, 0.35626, 0.38648, 0.30841, 0.28423, 0.30690, 0.05960, 
--0.13330, -0.32016, -0.39370, -0.32117, -0.35441, -0.25821, -0.12122, 0.07572, 0.11802, 0.11953, 
-0.24394, 0.49023, 0.50333, 0.55218, 0.40964, 0.06161, -0.09956, -0.25217, -0.30505, -0.32016, 
--0.26577, -0.23756, -0.15496, 0.05658, 0.26912, 0.46253, 0.44540, 0.36381, 0.33410, 0.38194, 
-0.37137, 0.28524, 0.15227, -0.12525, -0.18820, -0.24260, -0.45212, -0.32218, -0.13935, -0.20482, 
--0.01444, 0.22631, 0.35374, 0.33661, 0.36633, 0.40159, 0.26711, 0.02031, -0.04315, -0.46018, 
--0.57451, -0.62286, -0.69640, -0.64301, -0.44910, -0.22245, -0.07840, 0.16486, 0.42979, 0.43936, 
-0.53707, 0.46958, 0.18652, -0.11719, -0.25771, -0.18417, -0.22346, -0.34686, -0.34837, -0.20734, 
--0.15748, -0.13532, 0.02837, 0.10996, 0.15932, 0.17997, 0.21120, 0.23739, 0.19508, 0.06363, 
--0.00537, -0.06632, -0.16906, -0.23404, -0.26829, -0.27483, -0.16302, -0.09049, -0.08395, 0.01830, 
-0.09586, 0.17343, 0.26056, 0.34215, 0.27366, 0.21422, 0.04550, -0.04970, -0.15597, -0.25469, 
--0.19223, -0.21238, -0.23001, -0.20432, 0.05960, 0.22631, 0.27668, 0.27416, 0.25603, 0.41670, 
-0.35877, 0.21070, 0.18501, 0.09838, -0.17813, -0.30808, -0.31059, -0.28188, -0.36398, -0.31462, 
--0.28994, -0.17612, -0.12927, -0.16806, -0.14590, -0.15798, -0.20583, -0.14489, 0.07823, 0.04247, 
-0.06967, 0.10543, 0.11500, 0.07773, 0.11500, 0.03945, 0.02535, 0.04247, 0.06161, 0.17947, 
-0.16940, 0.10493, -0.07286, -0.16151, -0.12978, -0.17209, -0.30858, -0.23555, -0.15345, -0.12877, 
--0.08143, 0.10342, 0.24948, 0.20415, 0.19962, 0.19760, 0.11651, 0.08629, 0.05859, 0.06866, 
-0.04550, -0.00185, -0.18669, -0.16403, -0.07135, -0.01696, 0.09888, 0.19105, 0.17192, 0.20969, 
-0.24092, 0.30790, 0.26862, 0.26106, 0.11702, 0.04650, -0.09956, -0.32470, -0.42996, -0.45112, 
--0.42694, -0.36851, -0.22346, -0.09452, -0.05020, 0.06312, 0.02938, 0.06010, 0.11399, 0.15580, 
-0.11299, 0.08176, -0.05221, -0.09251, -0.14388, -0.10711, -0.01797, -0.09553, -0.09805, -0.05221, 
-0.03039, 0.05557, 0.07471, 0.08277, 0.07924, 0.03945, 0.01628, 0.02031, -0.01293, -0.12877, 
--0.24965, -0.23907, -0.24260, -0.29448, -0.22749, -0.18468, -0.16655, -0.09553, 0.06212, 0.10342, 
-0.04298, 0.11752, 0.19760, 0.18501, 0.20969, 0.25804, 0.29380, 0.22329, 0.15832, 0.13918, 
-0.02384, -0.11819, -0.19425, -0.12776, -0.14388, -0.20231, -0.20180, -0.07286, 0.00017, 0.04298, 
-0.14119, 0.19257, 0.15127, 0.09888, 0.09737, 0.03643, 0.02333, -0.02401, -0.16201, -0.24562, 
--0.23605, -0.26677, -0.09503, 0.02283, 0.11853, 0.12910, 0.13414, 0.20818, 0.27517, 0.26157, 
-0.24495, 0.23689, 0.05406, -0.08898, -0.14237, -0.42442, -0.46572, -0.41384, -0.39773, -0.25116, 
--0.20634, -0.14287, -0.15798, -0.11215, -0.02048, 0.11903, 0.17141, 0.16940, 0.03945, -0.02955, 
--0.06682, -0.05121, -0.03660, -0.05725, 0.02686, -0.00940, -0.01343, 0.00621, 0.11702, 0.17393, 
-0.17091, 0.17897, 0.17997, 0.24142, 0.16386, 0.00369, -0.02099, -0.09906, -0.20986, -0.20482, 
--0.16755, -0.17007, -0.22396, -0.20734, -0.15345, -0.04315, 0.05154, 0.27768, 0.27214, 0.28323, 
-0.34618, 0.37237, 0.24696, 0.23487, 0.09083, 0.00772, -0.06279, -0.19525, -0.27030, -0.31412, 
--0.28894, -0.21339, -0.15295, -0.07035, -0.01897, 0.01125, 0.06413, 0.05758, 0.10493, 0.10241, 
-0.05859, -0.04970, -0.11366, -0.16000, -0.17662, -0.21137, -0.16352, -0.07236, -0.04214, -0.01142, 
-0.09687, 0.10896, 0.08680, 0.08831, 0.08478, 0.08881, 0.06665, -0.00537, -0.03610, -0.07286, 
--0.07639, -0.15798, -0.12877, -0.13733, -0.11719, -0.04416, -0.00386, 0.00520, 0.00319, 0.07269, 
-0.07471, 0.07370, 0.07975, 0.03190, 0.04801, 0.04147, -0.06128, -0.06178, -0.03257, -0.03509, 
--0.03459, -0.07740, -0.06632, 0.02233, 0.02988, -0.02602, -0.00588, 0.04600, 0.11853, 0.04247, 
-0.04046, 0.08730, 0.07420, 0.01427, -0.04869, -0.11014, -0.08143, -0.07941, -0.07639, -0.05524, 
--0.09503, -0.06884, -0.01243, 0.00168, 0.05809, 0.06514, 0.07018, 0.06615, 0.03089, 0.01729, 
-0.02132, -0.03912, -0.04819, -0.08092, -0.18317, -0.24461, -0.25217, -0.21389, -0.21188, -0.18619, 
--0.11316, -0.06581, 0.03844, 0.10342, 0.14824, 0.15630, 0.13968, 0.09637, 0.06967, 0.07471, 
-0.03190, -0.04869, -0.11668, -0.16101, -0.12877, -0.09855, -0.05624, 0.04550, 0.05658, 0.09234, 
-0.12457, 0.06715, 0.04701, 0.02434, -0.01998, -0.06279, -0.13330, -0.15597, -0.16302, -0.09906, 
--0.05121, -0.00235, 0.06413, 0.07924, 0.09838, 0.17997, 0.22430, 0.25754, 0.25603, 0.16638, 
-0.05507, -0.05473, -0.07488, -0.08344, -0.11064, -0.06430, -0.05524, -0.06531, -0.01897, -0.00386, 
--0.02905, -0.08092, -0.10258, -0.11971, -0.17561, -0.16403, -0.08646, -0.10107, 0.00823, 0.02636, 
-0.04751, 0.06967, 0.08629, 0.09888, 0.12105, 0.09032, 0.05960, 0.01578, -0.03811, -0.12222, 
--0.17612, -0.18014, -0.11819, -0.10208, -0.10057, -0.05272, 0.00923, 0.04449, 0.05658, 0.02031, 
-0.00369, -0.04617, -0.09351, -0.10762, -0.11265, -0.10208, -0.09906, -0.08546, -0.03710, -0.00991, 
-0.04701, 0.10845, 0.11399, 0.11702, 0.12205, 0.11148, 0.12105, 0.09486, 0.12860, 0.12356, 
-0.10745, -0.02502, -0.10258, -0.13079, -0.15849, -0.20936, -0.18720, -0.16302, -0.06934, -0.04214, 
--0.01293, 0.06363, 0.12306, 0.19911, 0.21271, 0.16083, 0.10090, 0.05355, 0.01175, -0.02653, 
--0.05524, -0.13482, -0.16252, -0.14942, -0.16554, -0.10560, -0.04466, 0.01880, 0.05859, 0.07572, 
-0.07572, 0.08680, 0.09385, 0.07622, 0.05053, -0.04567, -0.09805, -0.16554, -0.21842, -0.25519, 
--0.28340, -0.25217, -0.17460, -0.08797, -0.00991, 0.11853, 0.18249, 0.18904, 0.17695, 0.17292, 
-0.14220, 0.12709, 0.05557, -0.05070, -0.13985, -0.18971, -0.17763, -0.19677, -0.21792, -0.18871, 
--0.13733, -0.11014, -0.03056, 0.04600, 0.13666, 0.13716, 0.12860, 0.12205, 0.10594, 0.07622, 
-0.04298, -0.01696, -0.07236, -0.11568, -0.10460, -0.11014, -0.07689, -0.00588, 0.02636, 0.07370, 
-0.14875, 0.17242, 0.16285, 0.14018, 0.07672, 0.05557, 0.04096, 0.00319, -0.03710, -0.11517, 
--0.16403, -0.19626, -0.14741, -0.08848, -0.07589, -0.06330, -0.03559, 0.00923, 0.03643, 0.02837, 
-0.03744, 0.03794, 0.02333, 0.02031, -0.00588, -0.04617, -0.08898, -0.10208, -0.11064, -0.10963, 
--0.07035, -0.05272, -0.00286, 0.03844, 0.04852, 0.03643, 0.03593, -0.01243, -0.03761, -0.03106, 
--0.04567, -0.06581, -0.07387, -0.08747, -0.09503, -0.09402, -0.07740, -0.04919, -0.00688, -0.01091, 
--0.03106, 0.00621, 0.02283, 0.01074, 0.00369, -0.01192, 0.00420, 0.02031, 0.03039, 0.01931, 
-0.01074, 0.01074, 0.00823, 0.01377, 0.02686, 0.02485, 0.03139, 0.00017, -0.01494, -0.00991, 
-0.00218, -0.02854, -0.04214, -0.03509, -0.00235, -0.00588, -0.02149, -0.00134, 0.02333, 0.03593, 
-0.05607, 0.07018, 0.05355, 0.02333, 0.00067, 0.00117, -0.01243, -0.03862, -0.05826, -0.06682, 
--0.05423, -0.04617, -0.04567, -0.03106, -0.04617, -0.00034, 0.01427, 0.00319, -0.00588, -0.01041, 
--0.03459, -0.09200, -0.10359, -0.10258, -0.07840, -0.08294, -0.11417, -0.11014, -0.10208, -0.10913, 
--0.07639, -0.03106, 0.00520, 0.01377, 0.06161, 0.08680, 0.09788, 0.08025, 0.04902, 0.02233, 
--0.00991, -0.01998, -0.04819, -0.04516, -0.03358, -0.04214, -0.01797, -0.04617, -0.02199, -0.02300, 
--0.02048, -0.01091, -0.04567, -0.06229, -0.06430, -0.03660, -0.00537, 0.00671, 0.02485, 0.04852, 
-0.04852, 0.03039, 0.06464, 0.05658, 0.02988, 0.03492, 0.00420, 0.02182, 0.04247, 0.04650, 
-0.04701, 0.01779, -0.00235, -0.00638, -0.01394, -0.00991, -0.01494, -0.00386, -0.02602, -0.04768, 
--0.05876, -0.07840, -0.09805, -0.07941, -0.06279, -0.09553, -0.07286, -0.04919, -0.05574, -0.07085, 
--0.05524, -0.00840, -0.02854, -0.04617, -0.06229, -0.06330, -0.07387, -0.08143, -0.06682, -0.01746, 
-0.02636, 0.03794, 0.02535, 0.02837, 0.02031, 0.01628, -0.00537, -0.02300, -0.02300, -0.02905, 
--0.04164, -0.06430, -0.07639, -0.06229, -0.06632, -0.06732, -0.04264, -0.02099, 0.00067, 0.01377, 
-0.02636, 0.02736, 0.03996, 0.05708, 0.07471, 0.05910, 0.05658, 0.05557, 0.05053, -0.03710, 
--0.06078, -0.07438, -0.07337, -0.08495, -0.06078, -0.03912, -0.02602, -0.00134, 0.03844, 0.06413, 
-0.07672, 0.08730, 0.07924, 0.04751, 0.03391, 0.00319, -0.03610, -0.08546, -0.09049, -0.09150, 
--0.10762, -0.07790, -0.07286, -0.05373, 0.00420, 0.02787, 0.04046, 0.04751, 0.06161, 0.06766, 
-0.05355, 0.02585, 0.00369, -0.03459, -0.06632, -0.10359, -0.11316, -0.12273, -0.14388, -0.14892, 
--0.12323, -0.08495, -0.02854, 0.02182, 0.04953, 0.05507, 0.06615, 0.07874, 0.06967, 0.06212, 
-0.01981, -0.00537, -0.00588, -0.02300, -0.08848, -0.09503, -0.09654, -0.07840, -0.05272, -0.02351, 
--0.01293, -0.02955, -0.01041, 0.01830, 0.02031, 0.03391, 0.05758, 0.07672, 0.05104, 0.02233, 
-0.01276, -0.00034, -0.01494, -0.04113, -0.03710, -0.03408, -0.02703, -0.02502, -0.04164, -0.03559, 
--0.00386, 0.01125, 0.04046, 0.04600, 0.02837, 0.01931, 0.01377, -0.00890, -0.02955, -0.05373, 
--0.06632, -0.06027, -0.05524, -0.04214, -0.00134, 0.02333, 0.03240, 0.02333, 0.00621, -0.02502, 
--0.02854, -0.04013, -0.04315, -0.04416, -0.07740, -0.06884, -0.06732, -0.07387, -0.07438, -0.06330, 
--0.04315, -0.03962, -0.04516, -0.05826, -0.02754, -0.00537, -0.00235, 0.00268, -0.00084, -0.01696, 
--0.03660, -0.03308, -0.03358, -0.04113, -0.01847, -0.00386, -0.00840, 0.00671, 0.01931, 0.02585, 
-0.03492, 0.02736, 0.03794, 0.01830, 0.00117, -0.00688, -0.01293, -0.01998, -0.05826, -0.04819, 
--0.04315, -0.05574, -0.04869, -0.05221, -0.00991, -0.01041, 0.02283, 0.04801, 0.05104, 0.04751, 
-0.02333, 0.00722, 0.01779, 0.03643, 0.02636, 0.00974, 0.01326, -0.00185, -0.02552, -0.03912, 
--0.02602, -0.03005, -0.03962, -0.04063, -0.03408, -0.03358, -0.03660, -0.03811, -0.05121, -0.02854, 
--0.04919, -0.04315, -0.04264, -0.04164, -0.02300, -0.01343, -0.01192, -0.00437, 0.01981, 0.02132, 
-0.00823, 0.00268, -0.02199, -0.05725, -0.06430, -0.06632, -0.05675, -0.04667, -0.04819, -0.05675, 
--0.03710, -0.02804, -0.03257, -0.03106, -0.02552, -0.01897, -0.01192, -0.00940, -0.01192, -0.02401, 
--0.01696, -0.00890, -0.00789, -0.00940, -0.01192, 0.01125, 0.02132, 0.00923, 0.00168, 0.01125, 
--0.01192, -0.01243, -0.01847, -0.03056, -0.01797, 0.00117, -0.01494, -0.00034, 0.02283, 0.01377, 
-0.01024, 0.01880, 0.02485, 0.02837, -0.00386, -0.02199, -0.02905, -0.05775, -0.06279, -0.06380, 
--0.05524, -0.04466, -0.02905, -0.02905, -0.02955, -0.01293, -0.01142, -0.00940, -0.01897, -0.03761, 
--0.02502, -0.02502, -0.03710, -0.04617, -0.03610, -0.03509, -0.03710, -0.04667, -0.04466, -0.03005, 
--0.03056, -0.03610, -0.03005, -0.02602, -0.04063, -0.03761, -0.04869, -0.06027, -0.06178, -0.05775, 
--0.04466, -0.03459, -0.02250, -0.00235, 0.00671, 0.01427, 0.02384, 0.02233, 0.02585, 0.03643, 
-0.01477, 0.00117, -0.01041, -0.01595, -0.03459, -0.02653, -0.02451, -0.01797, -0.01091, -0.01192, 
--0.00940, -0.00185, 0.00621, 0.00218, -0.00386, -0.00588, -0.01041, -0.01192, -0.02602, -0.03106, 
--0.01847, -0.01797, -0.02905, -0.02854, -0.01494, -0.01394, -0.00588, -0.00034, -0.00739, -0.00437, 
--0.00487, -0.00235, 0.00117, 0.00923, 0.00823, 0.01024, 0.01175, -0.00286, -0.02199, -0.04214, 
--0.04768, -0.05221, -0.04718, -0.05876, -0.06279, -0.06178, -0.05221, -0.04516, -0.03509, -0.01545, 
--0.00789, -0.01595, -0.00991, -0.02300, -0.02149, -0.01746, -0.01797, -0.00840, -0.01343, -0.02149, 
--0.01847, -0.03509, -0.03862, -0.03509, -0.02955, -0.01595, 0.00319, 0.01477, 0.02736, 0.02938, 
-0.02686, 0.02233, 0.01628, 0.01125, 0.00369, -0.01797, -0.04667, -0.05624, -0.06682, -0.05675, 
--0.03660, -0.02048, -0.00789, 0.00369, 0.00823, 0.02182, 0.02736, 0.02736, 0.01981, 0.02031, 
-0.01024, -0.00134, -0.01041, -0.02602, -0.02401, -0.02250, -0.01897, -0.01394, -0.01595, -0.01847, 
--0.01746, -0.01948, -0.01897, -0.02552, -0.04214, -0.03862, -0.04970, -0.04416, -0.04416, -0.04819, 
--0.05373, -0.05524, -0.04516, -0.04113, -0.03710, -0.04567, -0.04365, -0.03660, -0.03710, -0.03459, 
--0.04214, -0.02955, -0.01595, -0.00437, 0.00923, 0.01024, 0.01175, 0.01578, 0.01578, -0.00537, 
--0.01847, -0.04315, -0.05272, -0.06279, -0.06632, -0.05927, -0.05826, -0.05624, -0.04869, -0.02401, 
--0.00688, -0.00739, -0.00185, 0.01578, 0.03492, 0.03442, 0.03391, 0.03442, 0.02636, 0.01528, 
-0.00571, -0.00386, -0.02149, -0.02804, -0.02250, -0.02602, -0.02250, -0.01696, -0.01243, -0.01041, 
--0.00034, 0.01578, 0.01125, -0.00940, -0.01897, -0.02199, -0.02602, -0.05423, -0.05070, -0.05272, 
--0.05373, -0.04617, -0.02854, -0.00840, 0.00017, 0.00974, 0.01931, 0.03442, 0.03542, 0.01578, 
-0.00974, 0.00722, -0.00235, -0.01797, -0.04164, -0.04264, -0.05775, -0.05876, -0.04869, -0.02955, 
--0.02300, -0.01041, 0.00017, 0.00520, 0.00017, -0.00437, -0.01293, -0.00537, -0.01394, -0.02905, 
--0.04013, -0.03509, -0.03710, -0.03660, -0.02955, -0.02804, -0.01494, -0.00991, -0.00235, -0.00134, 
-0.01074, 0.01779, 0.01326, 0.01830, 0.02233, 0.01578, 0.01125, 0.00520, -0.00588, -0.00890, 
--0.01595, -0.02905, -0.02300, -0.01444, -0.00588, -0.01293, -0.00940, 0.00369, 0.01024, 0.02082, 
-0.01830, 0.01628, 0.01175, 0.01125, 0.00571, -0.00437, -0.01041, -0.02653, -0.04113, -0.04466, 
--0.04970, -0.04667, -0.03106, -0.02653, -0.00940, -0.00386, 0.00268, 0.01326, 0.00923, -0.00890, 
--0.01494, -0.01545, -0.05221, -0.04819, -0.03862, -0.03408, -0.04063, -0.04214, -0.05272, -0.04919, 
--0.04264, -0.03610, -0.02502, -0.03811, -0.03358, -0.03509, -0.03408, -0.03056, -0.03106, -0.04214, 
--0.03459, -0.03408, -0.03761, -0.03106, -0.02351, -0.01041, -0.00437, 0.00117, 0.00420, -0.00286, 
--0.01041, -0.02149, -0.01998, -0.01998, -0.02048, -0.03106, -0.03862, -0.04667, -0.04869, -0.03962, 
--0.03005, -0.02905, -0.01897, -0.01897, -0.00991, -0.00185, -0.00386, -0.01394, -0.01494, -0.00890, 
--0.00890, -0.01998, -0.01696, -0.01746, -0.01343, -0.01847, -0.02451, -0.02602, -0.03408, -0.03660, 
--0.03811, -0.03308, -0.02401, -0.02401, -0.02199, -0.01847, -0.01746, -0.02099, -0.02250, -0.02300, 
--0.03056, -0.03811, -0.03308, -0.02703, -0.03308, -0.02552, -0.01847, -0.02250, -0.02199, -0.02250, 
--0.01746, -0.00940, -0.01091, -0.00537, -0.00336, -0.00789, -0.01444, -0.01696, -0.01645, -0.02149, 
--0.01394, -0.01494, -0.01645, -0.01494, -0.02199, -0.01645, -0.01545, -0.00386, -0.00588, -0.00537, 
-0.00067, 0.00369, 0.01024, 0.00017, -0.00185, -0.00940, -0.01494, -0.00638, -0.01444, -0.01394, 
--0.00840, -0.00588, -0.00034, -0.00386, 0.00268, 0.01477, 0.01628, 0.00571, -0.00688, -0.00890, 
--0.01746, -0.01394, -0.02703, -0.02149, -0.02250, -0.02149, -0.03660, -0.04416, -0.03509, -0.02905, 
--0.03005, -0.02199, -0.01091, -0.00789, -0.01091, -0.01645, -0.03056, -0.02149, -0.01645, -0.02149, 
--0.04013, -0.02602, -0.02451, -0.02502, -0.03761, -0.02703, -0.03308, -0.03358, -0.03106, -0.01797, 
--0.01797, -0.01847, -0.01444, -0.01243, -0.02048, -0.01595, -0.02905, -0.03761, -0.02955, -0.02653, 
--0.02602, -0.03005, -0.03710, -0.02955, -0.02451, -0.01243, -0.00991, -0.00034, 0.00117, -0.00134, 
--0.00588, -0.00739, -0.00487, -0.01494, -0.01797, -0.02754, -0.03005, -0.03005, -0.02905, -0.03308, 
--0.04013, -0.03761, -0.02653, -0.02401, -0.01797, -0.00890, -0.00588, -0.01243, -0.01293, -0.00890, 
--0.00588, -0.01192, -0.01394, -0.01545, -0.01847, -0.03710, -0.03509, -0.03358, -0.03005, -0.02905
+// Muestras normalizadas en Q14 (valor * 2^PLANTILLA_Q); al ser const quedan en flash y no se copian a RAM
 
+static const int16_t plantilla_tres_aplausos_q14[PLANTILLA_MUESTRAS] = {
+15756, 16383, 16383, 16383, 4904, -17203, -17203, -14612, -14389, -17203,
+-17211, -17211, -17203, -17203, -17203, -17203, -17186, -17195, 16383, 16383,
+16243, 16383, 16383, 16383, 8799, -17203, -17219, -17203, -17203, -17203,
+-17195, -17203, -17211, 13445, 16383, 16383, 16383, 16383, 16383, 16383,
+16383, 16383, 8676, -17203, -17195, -17195, -17203, -17203, -17236, 5771,
+16383, 16383, 16383, 16383, 16383, 16383, 16383, 6629, 8279, -2052,
+-17211, -17211, -17203, -17203, -17203, -17203, -1260, 9286, 16383, 16383,
+16383, 16383, 16383, 16383, 968, -10461, -17195, -17195, -17203, -6937,
+894, 1620, 8098, 10474, 13462, 11209, 7718, 5672, -3719, -8695,
+-12978, -13266, -15280, -17195, -9413, -5452, -1978, 13024, 16383, 16383,
+15360, 16383, 16383, 10739, 7925, -748, -3149, -5023, -8200, -10898,
+-15684, -12689, -14818, -11352, -4850, -3282, -1590, 6373, 3898, 4459,
+6926, 6745, -1384, -6970, -8472, -7820, -9644, -5081, 3724, 3832,
+2701, 11580, 11003, 8931, -1078, 3774, 415, -8736, -9223, -3306,
+-9371, -13225, -12557, -7564, -11979, -3942, 6233, 9088, 9525, 13866,
+15046, 11531, 415, -1656, -4717, -4924, -8439, -1953, 4863, 7966,
+8403, 7611, 5061, -5378, -5155, -4899, -8093, -5452, -4074, -4742,
+1612, 6571, 4913, 679, 1703, 1901, 2668, 4987, 8222, 6027,
+-47, -4437, -9809, -10519, -8753, -8076, -6549, -4602, 357, 5994,
+13767, 11869, 6200, 4797, 2668, -1326, -10428, -15371, -16056, -10758,
+-5345, 2437, 7322, 7281, 8700, 11498, 11844, 6027, 3386, 102,
+-4363, -8043, -9297, -8810, -6162, -1681, 2866, 3328, 3386, 3989,
+3403, 3056, 2470, 1719, -1103, -2646, -4701, -1994, -1978, 36,
+3419, 6093, 8346, 6794, 4054, 2874, -1186, 52, 1653, 481,
+-30, 985, 3485, 2833, 861, -253, -3339, -6203, -7078, -8059,
+-3381, -2209, -327, 630, 3485, 3856, 4459, 4665, 3592, 4797,
+1818, -657, -558, -2943, -4816, -2489, -1780, -2877, -3240, -1326,
+-1227, -303, -154, -2060, -3438, -2267, -501, -459, -1252, 3196,
+2874, 283, -1755, -4371, -4643, -1012, 3122, 4921, 5367, 7611,
+7380, 6117, 2181, -534, -4759, -12590, -15296, -11690, -4495, 985,
+2668, 7223, 9674, 10590, 10656, 9476, 4871, -418, -5427, -5906,
+-5625, -6706, -8744, -8002, -4701, 1150, 3650, 5804, 7595, 7397,
+6976, 6398, 4360, 2800, -724, -4800, -7993, -8538, -8233, -8942,
+-9165, -7787, -4313, -2407, 4393, 7991, 11234, 10763, 11621, 10928,
+4838, -674, -8192, -10576, -10403, -10362, -8579, -6038, -1920, 234,
+2610, 5020, 4616, 4946, 5325, 4475, 4030, 481, -1565, -2902,
+-3174, -3075, -1722, -1367, -1540, -666, 94, 1513, 1901, 2833,
+4624, 6514, 5763, 5036, 5408, 3914, 1315, -2869, -5386, -10915,
+-11996, -12062, -10221, -8464, -2473, 6002, 10615, 12009, 12034, 8709,
+4929, 2643, -1037, -5081, -7474, -6954, -5765, -4775, -1334, -1516,
+-2159, -2605, 325, 2198, 1991, 2627, 1513, 754, -1334, -2060,
+-1912, -2572, -4404, -1681, 1785, 3584, 5235, 6126, 7256, 5655,
+3609, 440, -4132, -7168, -6838, -6665, -5312, -1458, 3048, 5457,
+6365, 3295, -303, -2126, -3471, -4544, -4049, -2886, -2399, 1249,
+4063, 5647, 6604, 6769, 6093, 1917, -1045, -4882, -6252, -6434,
+-4594, -3587, -3017, -839, 2272, 2206, 836, 349, 803, 283,
+-1103, -2399, -3711, -3636, -3496, -3108, -1285, -195, -47, 1694,
+3188, 4178, 7050, 6769, 5144, 2346, -550, -4858, -7416, -8670,
+-8125, -7375, -4321, 770, 3304, 3196, 3658, 4162, 4451, 4211,
+2742, 3468, 3551, 1521, -2002, -2597, -3183, -4156, -5699, -3009,
+-534, 976, 3634, 4277, 2198, 1744, 1686, 1480, 1125, -6,
+-2836, -2869, -4445, -3851, -3942, -4140, -3933, -3191, -674, 2817,
+5391, 3955, 3163, 3196, 3650, 1893, -105, -1953, -3282, -4759,
+-3810, -3240, -3067, -2126, -1871, 1653, 4071, 3848, 3766, 2462,
+1323, -393, -1763, -3174, -3414, -3760, -3249, -2225, -1854, -1425,
+250, 1298, 2396, 3766, 3881, 3716, 4682, 3658, 1340, -1796,
+-3430, -5056, -6162, -5163, -2786, 308, 1958, 3237, 5333, 6951,
+6307, 3708, -80, -2646, -3595, -5130, -5485, -4742, -2704, 226,
+2965, 4203, 4277, 3221, 2602, 1917, -327, -2696, -4618, -5477,
+-6582, -5179, -3017, -2456, -1120, 943, 1769, 2528, 3997, 3708,
+2874, 1711, 259, -724, -1705, -2687, -2877, -2118, -765, -1499,
+-1681, -1268, -501, 217, 952, 2074, 2701, 2643, 1538, 1744,
+1298, 745, -831, -2531, -4066, -3925, -3034, 3, 1191, 2280,
+3213, 3328, 2313, 1703, 729, -1120, -2011, -2201, -2060, -1780,
+-666, -336, 721, 1562, 1331, 2049, 3237, 2668, 2156, 836,
+44, -657, -1342, -2102, -2423, -2258, -2745, -2687, -2093, -2423,
+-2473, -1062, -39, 1183, 2412, 2965, 2586, 1364, 382, 877,
+-162, -1516, -1474, -1053, -410, -286, 943, 1191, -129, -2481,
+-3009, -2894, -2646, -2341, -1227, 60, 1884, 2841, 3345, 2594,
+1340, 85, -1210, -1862, -1557, -1994, -1739, -336, -105, 523,
+1141, 1760, 1934, 2305, 1983, 1785, 729, 308, -377, -1334,
+-2399, -3892, -3768, -3298, -2283, -1928, -1631, -294, 523, 1034,
+1381, 1249, 919, 993, 457, -624, -1053, -1252, -1714, -2291,
+-2250, -732, 440, 976, 1331, 1901, 2165, 1942, 1562, 745,
+-872, -2613, -2902, -2803, -2737, -2382, -1813, -616, 60, 1150,
+1298, 1100, 547, 655, 960, 1018, 1141, 1043, 1340, 902,
+283, -393, 126, -278, -963, -1557, -1871, -2242, -1458, -567,
+-129, 291, 1315, 1604, 1653, 1612, 1257, 910, -377, -1961,
+-2852, -2687, -2671, -2423, -1516, 993, 1967, 3353, 2940, 1810,
+1406, 1372, 1100, -468, -1268, -1986, -2663, -3958, -4412, -3727,
+-3191, -2597, -1945, -261, 762, 1274, 1868, 1893, 1290, 333,
+60, 94, -344, -1334, -1813, -1788, -1648, -1326, -88, 1232,
+1571, 2066, 2066, 1958, 1059, -311, -1276, -1871, -2019, -2135,
+-2333, -2316, -1771, -872, 201, 1216, 1719, 1835, 1967, 2181,
+2363, 2000, 1472, 275, -1095, -1615, -2976, -3876, -2481, -1309,
+-822, 1092, 1719, 1331, 1175, 1364, 1430, 366, -1210, -1351,
+-1714, -2696, -2068, -1631, -1598, -1689, -889, 432, 374, 366,
+1125, 1034, 498, 151, 160, 217, -410, -839, -674, -1260,
+-1606, -1285, -1392, -1821, -1004, 135, 531, 1133, 1538, 943,
+836, 622, -138, -921, -1871, -1945, -1747, -1318, -484, 69,
+465, 457, 572, 844, 861, 902, 877, 754, -509, -1078,
+-1087, -864, -1268, -2011, -1087, -30, 234, 440, 721, 828,
+613, 60, -80, -360, -814, -245, -600, -501, -435, -1087,
+-1681, -1895, -2011, -1879, -567, 325, 803, 1694, 2363, 2429,
+919, -261, -1895, -2514, -2572, -2580, -2291, -1871, -1087, 267,
+1051, 1521, 1348, 919, 630, -831, -1994, -1961, -2258, -1565,
+-765, -88, 226, 630, 1290, 1628, 976, 564, 729, 638,
+325, 151, 151, -80, -484, -1103, -979, -1342, -1854, -1516,
+-1136, -773, -550, -327, 110, 333, -195, -410, -839, -1260,
+-1458, -1260, -732, 118, 993, 1067, 910, 432, 184, -162,
+-1210, -1631, -2085, -2110, -1557, -905, 547, 1125, 1348, 853,
+325, -113, -1301, -2052, -2151, -1755, -1293, -344, 374, 1125,
+1670, 1406, 407, 102, -39, -88, -435, -426, -509, -616,
+-880, -1557, -1813, -1615, -1400, -1417, -732, 679, 1257, 1480,
+1942, 2016, 1727, 1232, 193, -550, -1483, -1763, -2159, -1829,
+-1342, -690, -501, 357, 993, 1208, 1439, 1372, 952, -113,
+-765, -1095, -1342, -2011, -2390, -2192, -1441, -946, -393, 283,
+688, 960, 1100, 1884, 1884, 968, 333, -657, -1714, -1961,
+-1928, -2283, -2357, -1912, -880, -22, 795, 1290, 1381, 1315,
+1009, 679, 217, -855, -1210, -1689, -2002, -2011, -1582, -724,
+52, 1034, 1744, 1818, 1546, 1241, 440, -756, -1334, -1854,
+-1879, -1450, -666, -476, -369, -138, -47, -245, -286, -30,
+-47, -47, -105, -212, -303, -311, -641, -1045, -1342, -1120,
+-666, -352, -154, 415, 745, 556, 193, -96, -855, -1144,
+-1268, -1474, -1367, -921, -509, -418, -96, 226, -6, -162,
+-237, -303, -889, -938, -765, -699, -278, 110, 110, 226,
+457, 506, 226, -39, -369, -897, -1078, -1012, -855, -707,
+-583, -550, -360, -96, 201, 217, 184, 28, -195, -294,
+-327, -311, -278, -459, -740, -1053, -641, -261, -171, -105,
+-105, 126, 60, -154, -253, -270, -204, -278, -212, -171,
+-228, -657, -938, -1400, -1524, -1458, -1202, -930, -443, 60,
+506, 696, 704, 696, 60, -212, -624, -987, -1161, -1037,
+-872, -616, 19, -72, -80, -14, -179, -443, -732, -724,
+-839, -1029, -674, -278, -96, -80, 201, 325, 259, 217,
+-96, 19, -47, -270, -377, -616, -591, -468, -377, -162,
+3, -105, -162, -179, -261, -435, -402, -237, -418, -583,
+-558, -558, -575, -501, -492, -740, -657, -377, -426, -633,
+-608, -459, -426, -426, -393, -228, -443, -179, 184, 44,
+52, -179, -228, -237, -377, -402, -443, -624, -781, -435,
+-327, -278, -393, -492, -336, -47, 60, 217, 160, 94,
+-39, -72, -327, -344, -261, -426, -575, -657, -608, -591,
+-443, -443, -228, 3, 217, 399, 564, 490, 424, 259,
+160, -468, -567, -996, -1153, -1037, -790, -501, -261, -63,
+118, 448, 465, 341, 374, 291, -88, -352, -657, -724,
+-987, -1087, -1120, -1392, -1053, -732, -451, -286, 94, 597,
+712, 589, 580, 325, -303, -600, -550, -542, -641, -1045,
+-946, -847, -921, -765, -303, -30, 19, -14, -14, 193,
+110, -22, 19, 217, 60, -39, 19, 19, -633, -864,
+-955, -921, -938, -459, -162, 102, 259, 407, 440, 399,
+217, -72, -484, -707, -748, -773, -798, -765, -707, -443,
+-80, 110, 366, 514, 465, 168, -228, -443, -839, -1037,
+-1070, -996, -740, -624, -476, -179, -22, 69, -154, -278,
+-286, -426, -393, -369, -344, -402, -558, -220, -162, -278,
+-220, -171, -88, -96, -96, -22, 201, 126, -22, 19,
+19, -220, -443, -641, -740, -657, -591, -385, -154, 3,
+94, 250, 440, 547, 382, 176, -72, -204, -212, -270,
+-303, -311, -402, -402, -286, -344, -212, -72, 28, -14,
+-14, -195, -294, -303, -220, -105, -72, -220, -261, -138,
+-195, -121, -63, -237, -286, -245, -204, -360, -369, -369,
+-336, -360, -435, -509, -484, -319, -228, -80, -30, 60,
+126, -22, -146, -154, -228, -245, -303, -344, -212, -270,
+-377, -393, -369, -410, -501, -575, -237, -154, 3, 60,
+44, 3, -278, -237, -451, -468, -583, -748, -889, -839,
+-822, -839, -839, -459, -344, -245, -162, -96, -270, -393,
+-418, -699, -798, -963, -1062, -971, -996, -765, -690, -699,
+-790, -798, -1021, -1070, -1120, -1210, -1268, -1268, -1334, -1375,
+-1524, -1747, -1936, -2242, -2407, -2225, -1334, 630, 836, -1598,
+-1829, 655, -22, -2217, -2093, -1276, -311, -212, -550, -558,
+316, 1859, 622, -2044, -2663, -1549, 1199, -756, -963, 679,
+2478, 2363, 1191, 2891, 3031, 4616, 4929, 4261, 4690, 4855,
+5218, 5078, 2899, 5763, 5820, 5168, 6010, 5556, 9055, 9427,
+10978, 7735, 7496, 7496, 11308, 14691, 15756, -1120, -17195, -17195,
+-17211, -17195, -17203, -17211, -17203, -17195, 16383, 16383, 16383, 16383,
+16383, 16383, 754, -17219, -17203, -17195, -17211, -17203, -17203, -2407,
+7702, 16383, 16383, 16383, 16383, 16383, 10326, -15123, -16353, -17203,
+-17211, -17211, -17195, -17161, -17170, -7927, 9592, 16383, 16383, 16383,
+16383, 16383, 16383, 14097, 1158, -6376, -8909, -7275, -8084, -12936,
+-16749, -17170, -17211, -10783, -5254, -138, 7009, 8296, 10623, 15756,
+16383, 11490, 4616, -3372, -11294, -10255, -9834, -9256, -3364, 1818,
+7066, 7182, 6769, 5441, 4558, 4343, 2404, 787, -558, 498,
+-1235, -4750, -2993, -3240, -4164, -3917, -1846, 1628, 910, 1381,
+5235, 5804, 2916, 2940, 1521, 168, 894, 44, -3100, -1656,
+201, -1384, -2440, -2993, -2498, -2481, -3603, -2539, -270, -864,
+1455, 2668, 721, 630, 580, 1125, -1788, -3579, -3933, -2382,
+-2168, -1631, -311, 1769, 3568, 1274, 1810, 5036, 3196, -303,
+-608, 325, -567, -2976, -4618, -1994, -1615, -2580, -2258, 457,
+52, 1059, 1612, 3708, 5606, 1793, 3031, 3345, -212, -4742,
+-3991, -3191, -1689, -649, 613, 1348, 5631, 6390, 3939, 2090,
+-666, -2151, -3216, -1557, -2531, -1095, -765, 968, 3072, 1835,
+1604, 2165, 1488, 1043, 886, 1034, 1455, -1029, -2357, -3224,
+-4115, -4866, -3405, -1128, -889, 1175, 3708, 5078, 5779, 6439,
+4360, -377, -2093, -4363, -5171, -7490, -6054, -4107, -2597, 234,
+2355, 5556, 6175, 5391, 4772, 2478, -88, -1829, -2093, -4330,
+-5039, -4140, -3447, -624, 1059, 1876, 3477, 3328, 3039, 1868,
+1009, 201, -245, -1136, -1895, -1062, -1153, -435, 1075, 1191,
+1018, 1018, 1843, 638, 168, -1408, -1227, -1829, 349, 193,
+811, 745, 1579, 1637, -1021, -2209, -3051, -3777, -4552, -2993,
+-946, -476, 118, 721, 960, 968, 547, -426, -996, -1425,
+-2201, -3017, -657, -600, -1078, -987, 828, -1120, -1697, -1540,
+-1936, -1186, -1103, -1177, -245, -798, 688, 943, 267, -171,
+721, 943, 234, -872, -1862, -1920, -2184, -591, 2000, 2577,
+2594, 3568, 3568, 3708, 1686, 968, -492, -2407, -4544, -4816,
+-2242, -724, 2132, 3221, 3411, 3213, 2536, 2033, 1554, -484,
+-1252, -1450, -2704, -2993, -2135, -2465, -1994, -1739, -1252, -261,
+696, 1604, 1637, 1538, 1678, 547, 531, -509, -2522, -3950,
+-4635, -3546, -3389, -2316, -1342, 19, 1084, 1703, 2231, 2800,
+3006, 3320, 1678, 1199, -641, -2349, -3727, -3513, -2811, -1681,
+-1037, 44, 1141, 1381, 1628, 2107, 2305, 968, 160, 828,
+671, -220, -278, 357, -138, -426, -1334, -1672, -1062, -889,
+-608, -30, 820, 993, 886, 745, 2016, 2107, 1967, 1678,
+1340, -311, -1540, -3042, -3603, -4404, -4742, -4618, -3026, -2126,
+-39, 2090, 3295, 3947, 3799, 3724, 2165, 1571, 19, -1615,
+-2489, -3752, -3859, -3298, -2630, -2217, -1598, -616, 506, 242,
+943, 1224, 1455, 1538, 976, -278, -781, -1285, -2803, -2126,
+-657, -946, -600, -47, 1241, 2421, 2437, 2115, 1893, -303,
+-1590, -2002, -2588, -2547, -2489, -1268, 118, 1043, 1777, 2165,
+2577, 2511, 1793, 688, -1788, -2283, -2770, -2522, -2093, -1400,
+-154, 679, 1389, 2049, 2115, 2247, 1579, 1224, -360, -1606,
+-2696, -3059, -3051, -2663, -2077, -1656, -1111, -195, 613, 679,
+60, -228, -212, -459, -616, -1862, -2316, -2085, -2143, -1805,
+-1153, -575, -179, 811, 2247, 2503, 2148, 1422, 811, 52,
+-666, -2374, -3009, -3579, -3067, -1805, -1499, -96, 1480, 2313,
+2148, 1826, 1430, 1364, 250, -542, -798, -608, -765, -1029,
+-996, -971, -1450, -352, 448, 861, 960, 762, 811, 1018,
+820, 28, -509, -550, -435, -897, -1557, -1722, -1301, -2036,
+-1846, -1169, -1029, -872, -377, 721, 1381, 1678, 1175, 770,
+481, -179, -855, -1722, -2151, -2019, -2060, -2176, -1780, -468,
+11, -22, 118, 1166, 1571, 1472, 688, 506, 481, -278,
+-938, -1524, -1202, -1598, -1763, -1021, -154, 259, 349, 1175,
+1455, 1826, 2058, 1991, 1851, 1315, 1224, 729, -1136, -1862,
+-2217, -2011, -1846, -1532, -278, 1249, 2024, 2602, 2817, 2404,
+976, -311, -1318, -2927, -2960, -2514, -1524, -839, 787, 1546,
+1843, 1810, 1472, 1026, 547, -154, -509, -1400, -2077, -2242,
+-2341, -2382, -1466, -699, 333, 1067, 1051, 1241, 1472, 1414,
+754, -22, -971, -1763, -1516, -1672, -1417, -872, -921, -674,
+151, 135, 308, 465, 399, 440, 498, 399, 275, 193,
+-105, -558, -468, -1144, -1516, -1326, -1070, -756, -542, 291,
+902, 1125, 1430, 1067, 762, 102, -402, -732, -1012, -1392,
+-1227, -930, -336, 267, 374, 448, 481, 448, 242, 28,
+201, -146, -154, -443, -1169, -1285, -1400, -1351, -1458, -1194,
+-1021, -674, -567, -558, -558, -616, -550, -426, -418, -96,
+457, -113, -377, -484, -336, -237, -377, -732, -542, 94,
+69, 283, 424, 193, -162, -682, -1483, -1466, -1169, -476,
+572, 976, 1208, 1315, 1323, 1191, 506, -14, -344, -1285,
+-1021, -872, -616, -245, -14, 242, 506, 622, 679, 745,
+836, 580, 349, -22, -459, -410, -657, -814, -1532, -1788,
+-1326, -1095, -534, -228, -138, 465, 498, 556, 572, 69,
+-138, -179, -212, -542, -831, -831, -855, -690, -591, -212,
+168, 349, 556, 745, 490, 547, 300, -105, -946, -1359,
+-1367, -1252, -773, -360, -80, 94, 325, 440, 193, 118,
+110, 44, 102, -146, 94, 201, 366, 457, 564, 349,
+226, 168, 11, -228, -105, -360, -608, -905, -649, -377,
+-195, 60, 259, 663, 679, 259, -179, -369, -773, -1045,
+-1417, -1623, -1483, -1070, -674, -204, 547, 729, 820, 745,
+531, 135, 28, -212, -839, -1532, -1499, -1854, -1945, -1928,
+-1400, -872, -311, 135, 465, 415, 547, 498, 36, -344,
+-855, -979, -987, -814, -492, -492, -187, 366, 366, 391,
+622, 589, 415, 357, 201, -96, -550, -600, -666, -765,
+-839, -946, -814, -674, -426, -228, 333, 622, 803, 811,
+754, 357, 151, -14, -724, -1053, -1417, -1549, -1384, -822,
+-96, -22, 168, 531, 754, 506, 94, 60, -212, -897,
+-1021, -1045, -905, -1128, -1120, -558, -492, -261, -39, 85,
+19, -113, -121, -47, -195, -286, -63, -105, -171, -426,
+-393, -699, -798, -624, -608, -600, -105, 102, 19, 3,
+60, 325, 135, -14, -129, -393, -724, -1045, -905, -798,
+-633, -443, -294, -14, 300, 283, 85, 94, 85, 28,
+19, -72, -204, -616, -492, -410, -641, -418, -195, -22,
+-245, -204, -377, -633, -426, -492, -550, -550, -352, -369,
+-377, -426, -690, -1120, -1136, -1078, -1161, -1021, -889, -501,
+85, 465, 646, 630, 457, 28, -418, -740, -1037, -1491,
+-1549, -1342, -748, -220, 94, 316, 391, 374, 201, 94,
+-162, -443, -1004, -1070, -831, -699, -600, -360, -88, 102,
+85, 151, 176, 242, -6, -154, -171, -88, -129, -245,
+-294, -435, -600, -608, -558, -567, -806, -509, -245, -146,
+-63, -39, -237, -459, -790, -905, -880, -649, -162, 316,
+440, 399, 391, -30, -327, -765, -1136, -1144, -1144, -889,
+-509, -311, -162, 316, 556, 399, -228, -550, -707, -946,
+-1029, -1144, -930, -484, -30, 102, 357, 481, 399, 316,
+-63, -253, -195, -88, -22, -6, -30, -72, -39, -352,
+-781, -748, -773, -624, -435, 60, 572, 704, 688, 630,
+630, 622, 308, -138, -666, -1012, -897, -921, -905, -806,
+-303, -63, 44, 176, 391, 399, 226, 217, 184, 94,
+-220, -468, -756, -905, -1070, -1095, -1012, -855, -674, -641,
+-435, -88, 184, 217, 160, 193, 36, -146, -633, -765,
+-831, -1120, -1021, -855, -724, -624, -237, -63, 259, 490,
+357, 226, -47, -369, -624, -600, -674, -905, -880, -707,
+-608, -344, 94, 316, 440, 523, 597, 374, 94, -14,
+-336, -690, -872, -831, -740, -550, -237, -22, -47, -6,
+-105, -360, -369, -377, -443, -327, -377, -360, -402, -459,
+-591, -550, -459, -443, -162, -96, 44, -47, -138, -402,
+-476, -509, -822, -748, -707, -443, -220, 3, -14, 52,
+160, 168, -55, -278, -476, -707, -748, -575, -336, -261,
+-113, 52, 94, 69, 118, 52, -129, -270, -245, -204,
+-195, -294, -212, -179, -146, -105, -30, 3, -22, 3,
+-113, -22, -113, -146, -113, -88, -204, -245, -311, -492,
+-402, -278, -311, -303, -204, -113, -138, -171, 3, 69,
+19, -138, -154, -336, -377, -624, -657, -616, -657, -600,
+-468, -253, -6, 69, 176, 242, 217, 52, -72, -377,
+-591, -641, -591, -509, -369, -253, -245, -171, -80, -162,
+-162, -171, -278, -228, -204, -492, -459, -228, 36, 52,
+-171, 3, -204, -360, -352, -468, -129, -105, -162, -96,
+-47, -278, -204, -179, -220, -204, -435, -468, -369, -418,
+-410, -393, -377, -385, -484, -311, -228, -360, -426, -484,
+-501, -608, -657, -608, -476, -558, -435, -410, -377, -426,
+-336, -195, -237, -270, -369, -443, -633, -624, -724, -690,
+-690, -674, -674, -583, -616, -501, -336, -303, -336, -352,
+-377, -567, -583, -699, -674, -715, -641, -641, -608, -674,
+-756, -534, -600, -558, -509, -443, -393, -278, -212, -228,
+-220, -459, -600, -699, -748, -855, -872, -790, -690, -666,
+-402, -303, -237, -327, -501, -567, -608, -897, -1029, -1169,
+-1194, -1161, -1153, -1268, -1301, -1276, -1227, -1227, -1417, -1623,
+-1796, -1961, -2720, -3562, -4198, -5691, -6591, -1186, 2478, -4635,
+-8794, -3257, -146, -459, 811, 1958, 2742, 4071, 7190, 407,
+-7127, -10692, -6071, -8200, -17195, -17203, -17203, -17195, -17203, -9355,
+16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 14559,
+-17203, -17195, -17203, -17195, -17186, -17186, -17195, -17211, -3793, 16383,
+16383, 16383, 16383, 16383, 16383, 16383, 16383, -2399, 2041, -17219,
+-17203, -17203, -17203, -17203, -17195, 2998, 16383, 16383, 16383, 16383,
+16383, 16383, 16383, 432, 5845, -10675, -17236, -17203, -17227, -17227,
+-17195, -16765, -17195, -17170, -5955, 16383, 16383, 16383, 16383, 16383,
+16383, 16383, 9344, 7883, 2858, -13795, -17195, -17211, -17029, 1406,
+2767, 366, 2016, 12323, 16383, 16383, 16383, 3477, -15338, -17203,
+-17203, -17195, -17203, -17211, -17203, -17203, 7463, 16383, 16383, 16383,
+16383, 16383, 16383, 16383, 16383, 16383, 16383, 250, -6690, -5980,
+-11822, -17195, -17211, -17203, -17195, -14224, -11979, -5716, 3246, 2536,
+-484, 2140, 6637, 2990, -897, 547, -3669, -14430, -3843, -3298,
+1463, 7050, 10417, 14270, 10103, 12513, 16383, 16383, 16383, 16383,
+9509, 4896, -9982, -16708, -11666, -17203, -17195, -17203, -14620, -10626,
+-6731, 1694, 4583, 12876, 15665, 4385, 5416, 8700, 4451, 3460,
+2544, 3931, 2156, 1744, 4517, 5614, 3708, 7240, 5086, 4550,
+16383, 16383, 3708, 8073, 3213, -831, -3183, -12821, -17211, -15948,
+-12367, -8753, 1150, 10400, 16383, 16383, 16383, 16383, 16276, 12711,
+8444, -6335, -11550, -13192, -17203, -17203, -17170, -9462, -2143, 2470,
+7198, 16309, 16383, 16383, 12670, 399, -7144, -8002, -10873, -16988,
+-17195, -16039, -15032, -5922, 3675, 5606, 11176, 14774, 13297, 11225,
+7232, 8024, 2891, 1117, -4264, -5600, -5543, -6021, -3983, -1210,
+-6104, -4767, 3246, -1417, 4129, 3155, 564, -748, -1656, 5391,
+1719, 160, 4154, 2817, 201, -2531, 1711, 4310, 6497, 9798,
+11729, 10227, 5548, 8519, -154, -3471, 3, 1356, 1760, -476,
+-2143, -3001, 102, -8051, -12045, -9347, -11888, -17186, -9281, 547,
+5185, 9393, 10780, 12991, 9674, 5523, 2156, -2044, -8381, -6285,
+-6549, -11831, -6294, -3999, -5765, -4907, -129, -4742, -1722, -476,
+-6698, -5947, -2489, -3901, -7540, -4990, -4090, 69, 3353, 5878,
+10664, 14741, 13685, 11003, 8486, 8865, 5985, 3832, 3518, 2908,
+-2786, -10056, -10387, -11649, -10659, -10246, -9776, -4825, 110, 4838,
+6406, 12100, 13255, 13643, 16383, 16383, 1199, -4107, -9008, -13159,
+-17203, -16741, -15099, -6904, -121, 5012, 11514, 16383, 14815, 13726,
+11490, 6794, 3394, 1538, -7696, -9966, -17227, -17195, -17195, -12483,
+-9924, -9190, -1219, 4087, 7091, 15253, 16383, 9369, 11085, 11118,
+7322, 1670, -1037, -6780, -12978, -14067, -17211, -17161, -13159, -14281,
+-9421, 102, 4706, 5721, 11085, 9039, 6893, 9625, 8486, 6646,
+4484, 2932, 1348, -2283, -6360, -5881, -5097, -1936, 762, 250,
+2429, 10169, 8370, 7718, 13701, 10037, 5135, 3361, 3559, -2968,
+-11798, -15247, -17203, -17203, -13481, -13382, -9801, -5658, -3768, 7429,
+12785, 15516, 16325, 16383, 13957, 9369, 1876, -2786, -4519, -10651,
+-9462, -10048, -12681, -8200, -3042, 1884, 4484, 5515, -484, -7490,
+-6937, -6500, -10073, -4404, -4247, -5378, -2778, -360, 6580, 7991,
+10722, 9146, 13437, 9253, -286, 1150, 1455, -1210, -4437, -4899,
+-3933, -4660, -2176, -1243, 135, 36, -930, 1942, 1917, -3207,
+-4750, -3901, -3051, -4173, -5427, 1216, 5771, 8040, 10070, 13420,
+8874, 6893, 5622, 3889, 2041, -1425, -4742, -8810, -7358, -7168,
+-6351, -6673, -5765, -798, 2099, 1826, 1637, 1958, -1565, -6310,
+-6079, -5163, -5163, -5543, -4594, 135, 6382, 10450, 12216, 10648,
+9740, 6621, 1241, 960, -2852, -7234, -11220, -10675, -11707, -12111,
+-10477, -7094, -3901, 1802, 6868, 9361, 12653, 11217, 7050, 5961,
+2949, 1043, 391, -30, -1854, -3835, -4032, -2654, -616, 514,
+374, 547, 3790, 4640, 5301, 3634, -633, -880, -3876, -5262,
+-8843, -9347, -7960, -4049, -3397, -1846, -657, 3625, 7413, 4715,
+6522, 5317, 3592, 803, -2234, -3727, -3950, -8365, -9883, -8687,
+-4519, -2217, -1507, 1092, 5837, 6332, 5053, 4657, 5028, 976,
+-2184, -5246, -6450, -5262, -5807, -4231, -1986, 1241, 1934, 1958,
+3997, 8032, 8247, 9047, 6712, 1009, -1631, -4132, -4998, -5246,
+-4354, -3892, -2539, 927, 4409, 7578, 7297, 5961, 5474, 6258,
+6085, 4673, 2495, -2052, -3083, -3975, -7408, -5279, -2283, -3356,
+-237, 3708, 5796, 5515, 6002, 6580, 4376, 333, -707, -7540,
+-9413, -10205, -11410, -10535, -7358, -3645, -1285, 2701, 7042, 7198,
+8799, 7694, 3056, -1920, -4222, -3017, -3661, -5683, -5708, -3397,
+-2580, -2217, 465, 1802, 2610, 2949, 3460, 3889, 3196, 1043,
+-88, -1087, -2770, -3835, -4396, -4503, -2671, -1483, -1375, 300,
+1571, 2841, 4269, 5606, 4484, 3510, 745, -814, -2555, -4173,
+-3149, -3480, -3768, -3348, 976, 3708, 4533, 4492, 4195, 6827,
+5878, 3452, 3031, 1612, -2918, -5048, -5089, -4618, -5963, -5155,
+-4750, -2886, -2118, -2753, -2390, -2588, -3372, -2374, 1282, 696,
+1141, 1727, 1884, 1274, 1884, 646, 415, 696, 1009, 2940,
+2775, 1719, -1194, -2646, -2126, -2820, -5056, -3859, -2514, -2110,
+-1334, 1694, 4087, 3345, 3271, 3237, 1909, 1414, 960, 1125,
+745, -30, -3059, -2687, -1169, -278, 1620, 3130, 2817, 3436,
+3947, 5045, 4401, 4277, 1917, 762, -1631, -5320, -7044, -7391,
+-6995, -6038, -3661, -1549, -822, 1034, 481, 985, 1868, 2553,
+1851, 1340, -855, -1516, -2357, -1755, -294, -1565, -1606, -855,
+498, 910, 1224, 1356, 1298, 646, 267, 333, -212, -2110,
+-4090, -3917, -3975, -4825, -3727, -3026, -2729, -1565, 1018, 1694,
+704, 1925, 3237, 3031, 3436, 4228, 4814, 3658, 2594, 2280,
+391, -1936, -3183, -2093, -2357, -3315, -3306, -1194, 3, 704,
+2313, 3155, 2478, 1620, 1595, 597, 382, -393, -2654, -4024,
+-3867, -4371, -1557, 374, 1942, 2115, 2198, 3411, 4508, 4286,
+4013, 3881, 886, -1458, -2333, -6954, -7630, -6780, -6516, -4115,
+-3381, -2341, -2588, -1837, -336, 1950, 2808, 2775, 646, -484,
+-1095, -839, -600, -938, 440, -154, -220, 102, 1917, 2850,
+2800, 2932, 2949, 3955, 2685, 60, -344, -1623, -3438, -3356,
+-2745, -2786, -3669, -3397, -2514, -707, 844, 4550, 4459, 4640,
+5672, 6101, 4046, 3848, 1488, 126, -1029, -3199, -4429, -5147,
+-4734, -3496, -2506, -1153, -311, 184, 1051, 943, 1719, 1678,
+960, -814, -1862, -2621, -2894, -3463, -2679, -1186, -690, -187,
+1587, 1785, 1422, 1447, 1389, 1455, 1092, -88, -591, -1194,
+-1252, -2588, -2110, -2250, -1920, -724, -63, 85, 52, 1191,
+1224, 1208, 1307, 523, 787, 679, -1004, -1012, -534, -575,
+-567, -1268, -1087, 366, 490, -426, -96, 754, 1942, 696,
+663, 1430, 1216, 234, -798, -1805, -1334, -1301, -1252, -905,
+-1557, -1128, -204, 28, 952, 1067, 1150, 1084, 506, 283,
+349, -641, -790, -1326, -3001, -4008, -4132, -3504, -3471, -3051,
+-1854, -1078, 630, 1694, 2429, 2561, 2289, 1579, 1141, 1224,
+523, -798, -1912, -2638, -2110, -1615, -921, 745, 927, 1513,
+2041, 1100, 770, 399, -327, -1029, -2184, -2555, -2671, -1623,
+-839, -39, 1051, 1298, 1612, 2949, 3675, 4220, 4195, 2726,
+902, -897, -1227, -1367, -1813, -1053, -905, -1070, -311, -63,
+-476, -1326, -1681, -1961, -2877, -2687, -1417, -1656, 135, 432,
+778, 1141, 1414, 1620, 1983, 1480, 976, 259, -624, -2002,
+-2886, -2951, -1936, -1672, -1648, -864, 151, 729, 927, 333,
+60, -756, -1532, -1763, -1846, -1672, -1623, -1400, -608, -162,
+770, 1777, 1868, 1917, 2000, 1826, 1983, 1554, 2107, 2024,
+1760, -410, -1681, -2143, -2597, -3430, -3067, -2671, -1136, -690,
+-212, 1043, 2016, 3262, 3485, 2635, 1653, 877, 193, -435,
+-905, -2209, -2663, -2448, -2712, -1730, -732, 308, 960, 1241,
+1241, 1422, 1538, 1249, 828, -748, -1606, -2712, -3579, -4181,
+-4643, -4132, -2861, -1441, -162, 1942, 2990, 3097, 2899, 2833,
+2330, 2082, 910, -831, -2291, -3108, -2910, -3224, -3570, -3092,
+-2250, -1805, -501, 754, 2239, 2247, 2107, 2000, 1736, 1249,
+704, -278, -1186, -1895, -1714, -1805, -1260, -96, 432, 1208,
+2437, 2825, 2668, 2297, 1257, 910, 671, 52, -608, -1887,
+-2687, -3216, -2415, -1450, -1243, -1037, -583, 151, 597, 465,
+613, 622, 382, 333, -96, -756, -1458, -1672, -1813, -1796,
+-1153, -864, -47, 630, 795, 597, 589, -204, -616, -509,
+-748, -1078, -1210, -1433, -1557, -1540, -1268, -806, -113, -179,
+-509, 102, 374, 176, 60, -195, 69, 333, 498, 316,
+176, 176, 135, 226, 440, 407, 514, 3, -245, -162,
+36, -468, -690, -575, -39, -96, -352, -22, 382, 589,
+919, 1150, 877, 382, 11, 19, -204, -633, -955, -1095,
+-889, -756, -748, -509, -756, -6, 234, 52, -96, -171,
+-567, -1507, -1697, -1681, -1285, -1359, -1871, -1805, -1672, -1788,
+-1252, -509, 85, 226, 1009, 1422, 1604, 1315, 803, 366,
+-162, -327, -790, -740, -550, -690, -294, -756, -360, -377,
+-336, -179, -748, -1021, -1053, -600, -88, 110, 407, 795,
+795, 498, 1059, 927, 490, 572, 69, 357, 696, 762,
+770, 291, -39, -105, -228, -162, -245, -63, -426, -781,
+-963, -1285, -1606, -1301, -1029, -1565, -1194, -806, -913, -1161,
+-905, -138, -468, -756, -1021, -1037, -1210, -1334, -1095, -286,
+432, 622, 415, 465, 333, 267, -88, -377, -377, -476,
+-682, -1053, -1252, -1021, -1087, -1103, -699, -344, 11, 226,
+432, 448, 655, 935, 1224, 968, 927, 910, 828, -608,
+-996, -1219, -1202, -1392, -996, -641, -426, -22, 630, 1051,
+1257, 1430, 1298, 778, 556, 52, -591, -1400, -1483, -1499,
+-1763, -1276, -1194, -880, 69, 457, 663, 778, 1009, 1109,
+877, 424, 60, -567, -1087, -1697, -1854, -2011, -2357, -2440,
+-2019, -1392, -468, 357, 811, 902, 1084, 1290, 1141, 1018,
+325, -88, -96, -377, -1450, -1557, -1582, -1285, -864, -385,
+-212, -484, -171, 300, 333, 556, 943, 1257, 836, 366,
+209, -6, -245, -674, -608, -558, -443, -410, -682, -583,
+-63, 184, 663, 754, 465, 316, 226, -146, -484, -880,
+-1087, -987, -905, -690, -22, 382, 531, 382, 102, -410,
+-468, -657, -707, -724, -1268, -1128, -1103, -1210, -1219, -1037,
+-707, -649, -740, -955, -451, -88, -39, 44, -14, -278,
+-600, -542, -550, -674, -303, -63, -138, 110, 316, 424,
+572, 448, 622, 300, 19, -113, -212, -327, -955, -790,
+-707, -913, -798, -855, -162, -171, 374, 787, 836, 778,
+382, 118, 291, 597, 432, 160, 217, -30, -418, -641,
+-426, -492, -649, -666, -558, -550, -600, -624, -839, -468,
+-806, -707, -699, -682, -377, -220, -195, -72, 325, 349,
+135, 44, -360, -938, -1053, -1087, -930, -765, -790, -930,
+-608, -459, -534, -509, -418, -311, -195, -154, -195, -393,
+-278, -146, -129, -154, -195, 184, 349, 151, 28, 184,
+-195, -204, -303, -501, -294, 19, -245, -6, 374, 226,
+168, 308, 407, 465, -63, -360, -476, -946, -1029, -1045,
+-905, -732, -476, -476, -484, -212, -187, -154, -311, -616,
+-410, -410, -608, -756, -591, -575, -608, -765, -732, -492,
+-501, -591, -492, -426, -666, -616, -798, -987, -1012, -946,
+-732, -567, -369, -39, 110, 234, 391, 366, 424, 597,
+242, 19, -171, -261, -567, -435, -402, -294, -179, -195,
+-154, -30, 102, 36, -63, -96, -171, -195, -426, -509,
+-303, -294, -476, -468, -245, -228, -96, -6, -121, -72,
+-80, -39, 19, 151, 135, 168, 193, -47, -360, -690,
+-781, -855, -773, -963, -1029, -1012, -855, -740, -575, -253,
+-129, -261, -162, -377, -352, -286, -294, -138, -220, -352,
+-303, -575, -633, -575, -484, -261, 52, 242, 448, 481,
+440, 366, 267, 184, 60, -294, -765, -921, -1095, -930,
+-600, -336, -129, 60, 135, 357, 448, 448, 325, 333,
+168, -22, -171, -426, -393, -369, -311, -228, -261, -303,
+-286, -319, -311, -418, -690, -633, -814, -724, -724, -790,
+-880, -905, -740, -674, -608, -748, -715, -600, -608, -567,
+-690, -484, -261, -72, 151, 168, 193, 259, 259, -88,
+-303, -707, -864, -1029, -1087, -971, -955, -921, -798, -393,
+-113, -121, -30, 259, 572, 564, 556, 564, 432, 250,
+94, -63, -352, -459, -369, -426, -369, -278, -204, -171,
+-6, 259, 184, -154, -311, -360, -426, -889, -831, -864,
+-880, -756, -468, -138, 3, 160, 316, 564, 580, 259,
+160, 118, -39, -294, -682, -699, -946, -963, -798, -484,
+-377, -171, 3, 85, 3, -72, -212, -88, -228, -476,
+-657, -575, -608, -600, -484, -459, -245, -162, -39, -22,
+176, 291, 217, 300, 366, 259, 184, 85, -96, -146,
+-261, -476, -377, -237, -96, -212, -154, 60, 168, 341,
+300, 267, 193, 184, 94, -72, -171, -435, -674, -732,
+-814, -765, -509, -435, -154, -63, 44, 217, 151, -146,
+-245, -253, -855, -790, -633, -558, -666, -690, -864, -806,
+-699, -591, -410, -624, -550, -575, -558, -501, -509, -690,
+-567, -558, -616, -509, -385, -171, -72, 19, 69, -47,
+-171, -352, -327, -327, -336, -509, -633, -765, -798, -649,
+-492, -476, -311, -311, -162, -30, -63, -228, -245, -146,
+-146, -327, -278, -286, -220, -303, -402, -426, -558, -600,
+-624, -542, -393, -393, -360, -303, -286, -344, -369, -377,
+-501, -624, -542, -443, -542, -418, -303, -369, -360, -369,
+-286, -154, -179, -88, -55, -129, -237, -278, -270, -352,
+-228, -245, -270, -245, -360, -270, -253, -63, -96, -88,
+11, 60, 168, 3, -30, -154, -245, -105, -237, -228,
+-138, -96, -6, -63, 44, 242, 267, 94, -113, -146,
+-286, -228, -443, -352, -369, -352, -600, -724, -575, -476,
+-492, -360, -179, -129, -179, -270, -501, -352, -270, -352,
+-657, -426, -402, -410, -616, -443, -542, -550, -509, -294,
+-294, -303, -237, -204, -336, -261, -476, -616, -484, -435,
+-426, -492, -608, -484, -402, -204, -162, -6, 19, -22,
+-96, -121, -80, -245, -294, -451, -492, -492, -476, -542,
+-657, -616, -435, -393, -294, -146, -96, -204, -212, -146,
+-96, -195, -228, -253, -303, -608, -575, -550, -492, -476,
 };
 
-float Datos_dos_aplausos_1[] = {
-0.44994, -0.39672, -0.80519, -0.67525, -0.35643, -0.28994, 0.18249, 0.99994, 0.99994, -0.31110, 
--1.05148, -1.05249, -0.33124, 0.05204, -0.48536, -1.05249, -1.05199, -1.05249, -1.05199, -1.05199, 
--1.05148, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.64637, -1.05148, -1.05199, -1.05199, -1.05148, -1.05148, -1.04040, -1.05148, -1.05199, 
--1.05148, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, -1.05199, 
--1.05199, -1.05199, -1.05299, -1.05148, -1.05199, -1.05249, 0.59348, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.94605, -1.05148, -1.05148, -1.05098, -1.05199, 
--1.05249, -1.05148, -1.05148, -1.05148, -1.05199, -0.15093, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.22631, -0.61380, -0.50400, -0.18770, 0.32150, -0.47227, -0.75080, 
--0.52667, 0.22631, 0.53405, 0.67608, 0.71134, 0.79545, 0.66198, 0.22782, -0.19173, -1.05199, 
--1.05199, -1.05199, -1.05199, -1.05249, -1.05148, -1.05199, -0.31865, -0.13381, 0.99994, 0.99994, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.81509, 0.75062, 0.49376, -0.03660, 0.11601, 
-0.00117, -0.13129, -0.36902, -1.05199, -1.01774, -1.05199, -1.05148, -1.05601, -1.04594, -0.41485, 
-0.09486, 0.44641, 0.37187, 0.52498, 0.69623, 0.27416, -0.44205, -0.67827, -1.00263, 0.31193, 
-0.05859, -0.25217, -0.48688, -0.34031, -0.01746, 0.67457, 0.77732, 0.74055, 0.79847, 0.75163, 
-0.72746, 0.17645, 0.58844, -0.11870, -0.78253, -0.32721, -0.53623, -0.96888, -0.78907, -0.92254, 
--0.57199, -0.15798, -0.23656, -0.09553, 0.14774, 0.56981, 0.57333, 0.38446, 0.20314, 0.79998, 
-0.45548, 0.11853, 0.31143, 0.37791, 0.05456, -0.05272, 0.28272, 0.23135, -0.10460, 0.22379, 
--0.18569, -0.51861, -0.43752, -0.13482, -0.32167, -0.18770, 0.06363, 0.02233, -0.11920, 0.00218, 
-0.22782, 0.23034, 0.27416, -0.08092, -0.40579, -0.34484, -0.16705, -0.14388, -0.23958, -0.48889, 
--0.38816, -0.02451, 0.14824, 0.46555, 0.56477, 0.52146, 0.74962, 0.45649, 0.40058, -0.30505, 
--0.29599, -0.95075, -0.81526, -0.59919, -0.72209, -0.46723, 0.05456, 0.08680, 0.08680, 0.22833, 
-0.28927, 0.32150, 0.26862, 0.09284, 0.19760, 0.10896, 0.34820, 0.10241, -0.20432, -0.10661, 
-0.07823, 0.10442, -0.34434, -0.10862, 0.15177, 0.01074, 0.05910, -0.06833, 0.10896, -0.03660, 
-0.07370, 0.11903, 0.21573, 0.15932, 0.23588, 0.16486, 0.25955, 0.19257, 0.39504, 0.04801, 
-0.08831, -0.21087, -0.01041, -0.09049, -0.20231, -0.05373, 0.13011, 0.09234, 0.09989, -0.10157, 
-0.03945, 0.23588, 0.16688, 0.39605, 0.14925, -0.28188, -0.47630, -0.44759, -0.46471, -0.58106, 
--0.13431, 0.37489, -0.01494, 0.17846, 0.61615, 0.51592, 0.47714, 0.47764, 0.19962, -0.23202, 
--0.13381, -0.35038, -0.63697, -0.60927, -0.25267, 0.05658, 0.01427, 0.04147, 0.16386, -0.10460, 
-0.25099, 0.35575, -0.02905, -0.01192, -0.10661, -0.15194, -0.15496, 0.13968, 0.27819, 0.56931, 
-0.34417, 0.24444, 0.08478, -0.03912, 0.01729, 0.16285, 0.21876, 0.18350, 0.11802, -0.39974, 
--0.33326, -0.23101, -0.20885, 0.09032, -0.14388, 0.06715, 0.31647, 0.32503, 0.51290, 0.63176, 
-0.58391, 0.42778, 0.57333, 0.15832, -0.25469, -0.65006, -0.90794, -0.74727, -0.53623, -0.50803, 
--0.21540, 0.35323, 0.37388, 0.41317, 0.60758, 0.96871, 0.70781, 0.34366, 0.15026, -0.28642, 
--0.75080, -0.67323, -1.04645, -0.93060, -0.52465, -0.39722, -0.07387, -0.13985, 0.10040, 0.23286, 
-0.61967, 0.63277, 0.37842, 0.51692, 0.37691, 0.29733, 0.32855, 0.13515, -0.02149, -0.26728, 
--0.63042, -0.74576, -0.79512, -0.87319, -0.32721, 0.09334, 0.29431, 0.26358, 0.40310, 0.53052, 
-0.32805, 0.39403, 0.40461, 0.21573, 0.07018, -0.42090, -0.45666, -0.12071, 0.02938, 0.09183, 
-0.12205, 0.22782, 0.26006, 0.19307, 0.01377, 0.28776, 0.50534, 0.76523, 0.47260, 0.17594, 
-0.12659, 0.00823, -0.13532, -0.66064, -1.05249, -0.89031, -0.96586, -0.92204, -0.41384, -0.25519, 
--0.08898, 0.43382, 0.90777, 0.99994, 0.83977, 0.60406, 0.14421, 0.01779, -0.05322, -0.08848, 
--0.27534, -0.48889, -0.55739, -0.28491, -0.18417, 0.01276, 0.16889, 0.29582, 0.23538, 0.12507, 
--0.14892, -0.25116, -0.19475, -0.07941, -0.20936, -0.25015, -0.20382, 0.00268, -0.03509, 0.03240, 
-0.07269, 0.04399, 0.18551, 0.19710, 0.28272, 0.38446, 0.23689, 0.22631, 0.26157, 0.37439, 
-0.20062, 0.06061, -0.12625, -0.27433, -0.16504, -0.22245, -0.22296, -0.11668, -0.28440, -0.20231, 
--0.00940, 0.00621, 0.07521, -0.14036, -0.07438, -0.00034, 0.11047, 0.40007, 0.29279, 0.31042, 
-0.23588, 0.21624, -0.05423, -0.17763, -0.27080, -0.16957, -0.11215, -0.17612, -0.21288, -0.26577, 
--0.26577, 0.09032, 0.06816, 0.07471, 0.09284, 0.05154, 0.08428, -0.09100, -0.14791, -0.22346, 
--0.44255, -0.41183, -0.28138, -0.29851, -0.41737, -0.41838, 0.04298, 0.17443, 0.45296, 0.50736, 
-0.56024, 0.50584, 0.46505, 0.23034, 0.06816, 0.06312, 0.04298, -0.05574, -0.40276, -0.48536, 
--0.37960, -0.40679, -0.40377, -0.47177, -0.48385, -0.03710, 0.23538, 0.26912, 0.56528, 0.70127, 
-0.58844, 0.53707, 0.29128, 0.07622, -0.18518, -0.33880, -0.43500, -0.56091, -0.46169, -0.13985, 
--0.02199, 0.11551, 0.32150, 0.49980, 0.56528, 0.58693, 0.53556, 0.31999, -0.01847, -0.35945, 
--0.62790, -0.64351, -0.65107, -0.60574, -0.41737, -0.15547, -0.20432, -0.08546, 0.07471, 0.39856, 
-0.32805, 0.29028, 0.27718, 0.28625, 0.29179, 0.33510, 0.30992, 0.11500, -0.04869, -0.28088, 
--0.33225, -0.43500, -0.44960, -0.44910, -0.44104, -0.03862, 0.37338, 0.38799, 0.41116, 0.22631, 
-0.22379, 0.16486, 0.04197, -0.11870, -0.24461, -0.31613, -0.46320, -0.30606, -0.06581, 0.08327, 
-0.24142, 0.31143, 0.35726, 0.37590, 0.44994, 0.47059, 0.14321, -0.01343, -0.19425, -0.30707, 
--0.24764, -0.39118, -0.25569, -0.13280, -0.12726, -0.00185, 0.24948, 0.29934, 0.34064, 0.32050, 
-0.35122, 0.34064, 0.10694, -0.15295, -0.05725, -0.07790, -0.08898, 0.01931, -0.00789, -0.04264, 
--0.12927, -0.10913, 0.01125, 0.12105, -0.01595, -0.03257, -0.14287, -0.14086, -0.11870, -0.16453, 
--0.10157, -0.13179, -0.31462, -0.39471, -0.16201, -0.03308, 0.04801, 0.22631, 0.29380, 0.15882, 
-0.10442, 0.10040, -0.09251, -0.02955, -0.01595, -0.00084, -0.07035, -0.00688, -0.02099, -0.08848, 
-0.00974, 0.06967, 0.09586, -0.01293, -0.01998, -0.12122, 0.01477, 0.03542, 0.00017, -0.00840, 
-0.11903, 0.07975, 0.09838, 0.10493, -0.05574, 0.05204, 0.16436, 0.00823, 0.00520, -0.15949, 
--0.07941, -0.03862, -0.12525, -0.17108, -0.23253, -0.14187, 0.04197, 0.03190, 0.05910, 0.15580, 
-0.28020, 0.31042, 0.22732, 0.16889, 0.22631, 0.21271, -0.00034, -0.13985, -0.23101, -0.34484, 
--0.34887, -0.40679, -0.33124, -0.11568, 0.01427, 0.10745, 0.11399, 0.20314, 0.21070, 0.10594, 
-0.00420, -0.05473, -0.16504, -0.20835, -0.22396, -0.14036, -0.11668, -0.01041, -0.01343, 0.07672, 
-0.15832, 0.21725, 0.14018, 0.22027, 0.14573, 0.01175, -0.06531, -0.14086, -0.24310, -0.17511, 
--0.22950, -0.10762, -0.11114, -0.04063, 0.11500, 0.23588, 0.21221, 0.10594, 0.12709, 0.09687, 
-0.00420, 0.04852, -0.02199, -0.10711, -0.02653, -0.05524, 0.00923, 0.00218, 0.05154, 0.13313, 
-0.12205, 0.09637, 0.11702, 0.13011, 0.07269, -0.01243, -0.05775, -0.20331, -0.26677, -0.15043, 
--0.18518, -0.14942, -0.17612, -0.18921, -0.16554, -0.07689, -0.06984, -0.00991, 0.04650, 0.14975, 
-0.19660, 0.13464, 0.19055, 0.18300, -0.00890, -0.11568, -0.19475, -0.23253, -0.30203, -0.26224, 
--0.17712, -0.09402, 0.07823, 0.18703, 0.14371, 0.16335, 0.13918, 0.17040, 0.16386, -0.03610, 
--0.14086, -0.22447, -0.26073, -0.21036, -0.13330, -0.17964, -0.15345, -0.08697, 0.00571, 0.04298, 
-0.11903, 0.18300, 0.25250, 0.25905, 0.15328, 0.12256, 0.09989, 0.06312, 0.08126, -0.07438, 
--0.28944, -0.24310, -0.23656, -0.16504, -0.12776, -0.03459, 0.08579, 0.19307, 0.21876, 0.20919, 
-0.16889, 0.15429, 0.07672, 0.02988, -0.02048, -0.08999, -0.15144, -0.12273, -0.19425, -0.21641, 
--0.14539, -0.17108, -0.04617, -0.04869, 0.00117, 0.12860, 0.10442, 0.15026, 0.20113, 0.14724, 
-0.01074, -0.09553, -0.12776, -0.16504, -0.23756, -0.20130, -0.22145, -0.09704, -0.07337, -0.02099, 
--0.03912, -0.04718, 0.00923, 0.07420, 0.01024, 0.00520, -0.02149, 0.00722, -0.01897, -0.10057, 
--0.13834, -0.10460, -0.03761, 0.06464, -0.02552, 0.02837, 0.05859, 0.11148, 0.12810, 0.18149, 
-0.16083, 0.17040, 0.05255, -0.06229, -0.14590, -0.15899, -0.17561, -0.07840, -0.06128, -0.03408, 
--0.01797, 0.04550, 0.11198, 0.16889, 0.17040, 0.11500, 0.10845, 0.03744, 0.02535, 0.00772, 
--0.02602, -0.08646, -0.08495, -0.07286, -0.13582, -0.06934, 0.02182, 0.11349, 0.10745, 0.06967, 
-0.07219, 0.06010, 0.04953, 0.01427, -0.11165, -0.06027, 0.02182, 0.01679, -0.06732, -0.08294, 
--0.04013, 0.01225, -0.01343, -0.10107, -0.17561, -0.17561, -0.09503, -0.08898, -0.04919, 0.02132, 
-0.09284, 0.07370, 0.07622, 0.03139, 0.02837, 0.01125, 0.02384, 0.00621, 0.00369, 0.06161, 
-0.04953, 0.01578, 0.01125, 0.00671, 0.05960, -0.03610, -0.01293, -0.03358, -0.08143, -0.08747, 
--0.05070, -0.03308, -0.09049, -0.01192, 0.03139, 0.02182, 0.01779, 0.01024, -0.00890, 0.03744, 
-0.03643, 0.04852, 0.05053, 0.06061, 0.13062, 0.14925, 0.15932, 0.17846, 0.10896, 0.07219, 
--0.00185, -0.03408, -0.08596, -0.17460, -0.20432, -0.16856, -0.09503, -0.03610, 0.00470, -0.05524, 
-0.03039, 0.08730, 0.12507, 0.12004, 0.09133, 0.06816, 0.05758, 0.02837, 0.02384, -0.01595, 
--0.04718, -0.09452, -0.15043, -0.14489, -0.11265, -0.12877, -0.14237, -0.09553, -0.01293, -0.00638, 
-0.00319, 0.08277, 0.08780, 0.03844, 0.00923, -0.00084, 0.00974, -0.00487, -0.00537, -0.03005, 
--0.07286, -0.09301, -0.11316, -0.10460, -0.08546, -0.03005, 0.06363, 0.09486, 0.08831, 0.08982, 
-0.11752, 0.08075, 0.03391, -0.06531, -0.12273, -0.09855, -0.06279, -0.17410, -0.13280, -0.03912, 
-0.01477, 0.02535, 0.08780, 0.15026, 0.17544, 0.22027, 0.17141, 0.16738, 0.09536, 0.07773, 
-0.03341, -0.00134, -0.06229, -0.14489, -0.18367, -0.15395, -0.05020, -0.06581, -0.02300, -0.00386, 
-0.02837, 0.00772, -0.01847, 0.00520, -0.00890, -0.02250, -0.03459, -0.03358, -0.00739, 0.00017, 
-0.02283, -0.00487, -0.00185, 0.00117, -0.04869, -0.04113, -0.00890, -0.00084, 0.01830, 0.00823, 
-0.01074, 0.00974, 0.02535, 0.00621, -0.04718, -0.04919, -0.08243, -0.11769, -0.08294, -0.06531, 
--0.05927, -0.07337, -0.05070, -0.04315, -0.05725, -0.03761, -0.00537, 0.06564, 0.08126, 0.03442, 
-0.03341, -0.00739, 0.00520, 0.07572, 0.10644, 0.14573, 0.14673, 0.11450, 0.03996, -0.00487, 
--0.05070, -0.06229, -0.07790, -0.12474, -0.13431, -0.14237, -0.13582, -0.03660, -0.00235, 0.14522, 
-0.17292, 0.09939, 0.11551, 0.14119, 0.12860, 0.10896, 0.03844, -0.04718, -0.04416, -0.04013, 
--0.06178, -0.10107, -0.09956, -0.05927, -0.02804, -0.01494, 0.01125, 0.05557, 0.07823, 0.08478, 
-0.07269, 0.03240, -0.00034, -0.04113, -0.08747, -0.09704, -0.11064, -0.12625, -0.10560, -0.08445, 
--0.06481, -0.03710, 0.00772, 0.03643, 0.01628, 0.07370, 0.04902, 0.06816, 0.07672, 0.08579, 
-0.06061, 0.02736, -0.00537, -0.06984, -0.06380, -0.07236, -0.08243, -0.12323, -0.12474, -0.07135, 
--0.03308, -0.07035, -0.02955, -0.01343, 0.00571, -0.01091, -0.02048, 0.02636, 0.05003, 0.06262, 
-0.05910, 0.06816, 0.02837, 0.04298, 0.07118, 0.05406, 0.05456, 0.05204, 0.01830, 0.00420, 
--0.02602, -0.07941, -0.04113, -0.03005, -0.04718, -0.02955, -0.02703, -0.04567, -0.00487, 0.02787, 
-0.04197, -0.00789, -0.02653, -0.06531, -0.11366, -0.12323, -0.13683, -0.10510, -0.08596, -0.09049, 
--0.03509, 0.02333, 0.06514, 0.07269, 0.07975, 0.07521, 0.08730, 0.06967, 0.08428, 0.06262, 
--0.03459, -0.04214, -0.06531, -0.08042, -0.13079, -0.16050, -0.14590, -0.13582, -0.04164, 0.01225, 
-0.04399, 0.05154, 0.05053, 0.03744, 0.04550, 0.05607, 0.02736, -0.01091, -0.06229, -0.07840, 
--0.12625, -0.09100, -0.06229, 0.00823, 0.01225, 0.02233, 0.06010, 0.05809, 0.05557, 0.08680, 
-0.09183, 0.07672, 0.04247, 0.01477, 0.00823, -0.01746, -0.05775, -0.08646, -0.08143, -0.09956, 
--0.06884, -0.02955, 0.01377, 0.06212, 0.08478, 0.07773, 0.07773, 0.06665, 0.05809, 0.07622, 
-0.02132, -0.01696, -0.04718, -0.05070, -0.05070, -0.05473, -0.08697, -0.07337, -0.05775, -0.04567, 
--0.02351, -0.00638, 0.02031, 0.05910, 0.04701, 0.02535, -0.00638, -0.04013, -0.06581, -0.08646, 
--0.09452, -0.12071, -0.14489, -0.07891, -0.09553, -0.07740, 0.03089, 0.07420, 0.06615, 0.07672, 
-0.09637, 0.07975, 0.06665, 0.04046, -0.02199, -0.06078, -0.07236, -0.10308, -0.07740, -0.07438, 
--0.07337, -0.07085, -0.00286, 0.01528, 0.01024, 0.02333, 0.02132, -0.01041, -0.01494, -0.00537, 
-0.02132, 0.01326, -0.02653, -0.03257, -0.05524, -0.03962, -0.01243, -0.00437, 0.03391, 0.01830, 
-0.05053, 0.07874, 0.07471, 0.07622, 0.07471, 0.08377, 0.06010, 0.03391, -0.02703, -0.08143, 
--0.05322, -0.03862, -0.05272, -0.05876, -0.06934, -0.05121, -0.02703, -0.02955, 0.01326, 0.02283, 
-0.02233, 0.03391, -0.02703, -0.05020, -0.04919, -0.04063, -0.03459, -0.02250, -0.01746, -0.03912, 
--0.07135, -0.07286, -0.06682, -0.04970, -0.02955, -0.01243, 0.02434, 0.02333, 0.02333, 0.04550, 
-0.06363, 0.04247, 0.04298, 0.03744, -0.00739, -0.01897, -0.05473, -0.09452, -0.12373, -0.13028, 
--0.07740, -0.06279, 0.00823, 0.01729, 0.00671, 0.02434, 0.05053, 0.05204, 0.01477, 0.01880, 
-0.00923, -0.02401, -0.01545, -0.01192, -0.01897, -0.03308, -0.04869, -0.04264, -0.03610, -0.02854, 
--0.00034, 0.01729, 0.03996, 0.05507, 0.06212, 0.06464, 0.03945, 0.04197, 0.04046, 0.01326, 
--0.00588, -0.07337, -0.07840, -0.05524, -0.06027, -0.05473, -0.05624, -0.02552, 0.01377, 0.01477, 
-0.01679, 0.05507, 0.08428, 0.08579, 0.07169, 0.07169, 0.06766, 0.02585, 0.00671, -0.04869, 
--0.07740, -0.10157, -0.10460, -0.09754, -0.09553, -0.08949, -0.06027, -0.04113, -0.02401, 0.02938, 
-0.05003, 0.08277, 0.09637, 0.08982, 0.09687, 0.09234, 0.05910, 0.02636, -0.03862, -0.08243, 
--0.08848, -0.07135, -0.08747, -0.07790, -0.03660, -0.01645, 0.02434, 0.03139, 0.03996, 0.05003, 
-0.04650, 0.05255, 0.03844, 0.03643, 0.04197, 0.00117, -0.00286, -0.00487, -0.02854, -0.02300, 
--0.02552, -0.03257, -0.03308, -0.01746, -0.01041, -0.00688, -0.02451, -0.00084, 0.00571, 0.00520, 
-0.00621, 0.01125, 0.00571, 0.02182, 0.02736, 0.02938, 0.03190, 0.03945, 0.02988, 0.01427, 
-0.00017, -0.01041, -0.02804, -0.01494, -0.03106, -0.05775, -0.05423, -0.03509, -0.03358, -0.01494, 
--0.02552, -0.02552, -0.03912, -0.02048, -0.01394, -0.00890, -0.00940, -0.02099, -0.02703, -0.01998, 
--0.00940, 0.00974, 0.00571, -0.03509, -0.02300, -0.02300, -0.04013, -0.04013, -0.01645, 0.00117, 
--0.00487, -0.00437, 0.00420, 0.01427, 0.02535, 0.02787, 0.00621, -0.00537, -0.01343, -0.02250, 
--0.03358, -0.05322, -0.04164, -0.01897, -0.02048, 0.00369, 0.00520, 0.01326, 0.02686, 0.01528, 
-0.03391, 0.02686, 0.01528, 0.00017, 0.00369, 0.01125, -0.00034, -0.01746, -0.00739, -0.00688, 
--0.02905, -0.02502, -0.02905, -0.03862, -0.04819, -0.00991, 0.00671, 0.03341, 0.06161, 0.06766, 
-0.07975, 0.07521, 0.07521, 0.05355, 0.02686, -0.02502, -0.06934, -0.10208, -0.12927, -0.12323, 
--0.10661, -0.10661, -0.07790, -0.01797, 0.02233, 0.02988, 0.05003, 0.06665, 0.07471, 0.06413, 
-0.00218, -0.01091, -0.01998, -0.03106, -0.06078, -0.05624, -0.08092, -0.10460, -0.08546, -0.06430, 
--0.05322, -0.02300, 0.02132, 0.04902, 0.04449, 0.03794, 0.04852, 0.04852, 0.03039, 0.01024, 
--0.01243, -0.03912, -0.05725, -0.10258, -0.09100, -0.09754, -0.10460, -0.08848, -0.04516, -0.01394, 
-0.00823, 0.01427, 0.04046, 0.06615, 0.05456, 0.04348, 0.02938, 0.02132, -0.00688, -0.02602, 
--0.03660, -0.04667, -0.04516, -0.04516, -0.03761, -0.02300, 0.01074, 0.02434, 0.03593, 0.03542, 
-0.04499, 0.02787, 0.03139, 0.02132, 0.00268, -0.02099, -0.05121, -0.07236, -0.09301, -0.08092, 
--0.07488, -0.06934, -0.03559, 0.00218, 0.00621, 0.02333, 0.01377, 0.01528, 0.01225, 0.01779, 
-0.01477, 0.00671, -0.01847, -0.02048, -0.04819, -0.04315, -0.07035, -0.08294, -0.08445, -0.07035, 
--0.06430, -0.05473, -0.01494, 0.00117, 0.01377, 0.01830, 0.03089, 0.02233, 0.02283, 0.00722, 
--0.00084, -0.01847, -0.02653, -0.03459, -0.04063, -0.05221, -0.05473, -0.03308, -0.02602, -0.00537, 
-0.00571, 0.01578, 0.02636, 0.03391, 0.04550, 0.02938, 0.01225, 0.01125, 0.00117, -0.04164, 
--0.04567, -0.04919, -0.05775, -0.02250, -0.01494, -0.01192, -0.00537, 0.00218, 0.00017, 0.00621, 
-0.01175, 0.02182, 0.02636, 0.01628, -0.00890, -0.01343, -0.00437, 0.01628, -0.00185, -0.01091, 
--0.02401, -0.04466, -0.05070, -0.04516, -0.02199, -0.00386, -0.00286, 0.00520, 0.01024, 0.01830, 
-0.01880, -0.00286, -0.00487, 0.00823, 0.00772, 0.00117, -0.01293, -0.00940, -0.00437, -0.00437, 
--0.01041, -0.02502, -0.02552, -0.01897, -0.03459, -0.03912, -0.01746, -0.02048, -0.01595, -0.01595, 
--0.01494, 0.00218, 0.00923, 0.00319, -0.00034, 0.00571, 0.00117, -0.00185, -0.00235, 0.01125, 
-0.02535, 0.02233, 0.02182, 0.01830, 0.02132, 0.00319, -0.00840, -0.01293, -0.01293, -0.02199, 
--0.04768, -0.03106, -0.02199, -0.02552, -0.00940, 0.01125, 0.01477, 0.02434, 0.01931, 0.01880, 
-0.01074, 0.00369, 0.00067, 0.00420, 0.00823, 0.00520, 0.00923, 0.01024, 0.00974, 0.00319, 
-0.00772, 0.02031, 0.01830, -0.00185, -0.00688, -0.00991, -0.01192, -0.00940, -0.00991, -0.00991, 
--0.01696, -0.01696, -0.01243, -0.01444, -0.00336, -0.00235, -0.01343, -0.00185, 0.00319, -0.00034, 
--0.00840, -0.01847, -0.03710, -0.04113, -0.04466, -0.04567, -0.04264, -0.02955, 0.00218, 0.02535, 
-0.03039, 0.04197, 0.04751, 0.03895, 0.02736, 0.01679, 0.00923, -0.00286, -0.03308, -0.05423, 
--0.06632, -0.06632, -0.06884, -0.04819, -0.03509, -0.03811, -0.03459, -0.00386, 0.01175, 0.01880, 
-0.02585, 0.02182, 0.01729, 0.00722, -0.00386, -0.01091, -0.02401, -0.03005, -0.04164, -0.05020, 
--0.03710, -0.02502, -0.01091, -0.00991, -0.00890, -0.00084, 0.01528, 0.01880, 0.00117, -0.00638, 
--0.02300, -0.02804, -0.02905, -0.03761, -0.04315, -0.05675, -0.05221, -0.05070, -0.03862, -0.02199, 
--0.01494, -0.00235, 0.01628, 0.01981, 0.01477, 0.01477, 0.00017, 0.00319, 0.00319, -0.01494, 
--0.02199, -0.03106, -0.03912, -0.03660, -0.02502, -0.01293, -0.02149, -0.01847, -0.02602, -0.01645, 
--0.01444, -0.01847, -0.01645, -0.01394, -0.00286, -0.00487, -0.00890, -0.00386, 0.01326, 0.01628, 
-0.01024, -0.00034, -0.00588, -0.02300, -0.02502, -0.03056, -0.02552, -0.00437, 0.00772, 0.00319, 
-0.01628, 0.02233, 0.01931, 0.01880, 0.01427, 0.00369, -0.00840, -0.01897, -0.01746, -0.02199, 
--0.02199, -0.01797, -0.00789, -0.00688, -0.00487, -0.00084, 0.00722, 0.00067, 0.00420, 0.00571, 
-0.00319, 0.00671, 0.00923, 0.01427, 0.01779, 0.00671, 0.01175, -0.00084, -0.03459, -0.03912, 
--0.04214, -0.04164, -0.03106, -0.03005, -0.04063, -0.02300, -0.00286, -0.00185, 0.00218, 0.01427, 
-0.02082, 0.02132, 0.01377, -0.00638, -0.02602, -0.03761, -0.05876, -0.05775, -0.06027, -0.05675, 
--0.03660, -0.02300, -0.01343, -0.00286, 0.01779, 0.01578, 0.02233, 0.01175, 0.00319, -0.00134, 
--0.01645, -0.03459, -0.05020, -0.04416, -0.04416, -0.04315, -0.02401, -0.02149, -0.02149, -0.01091, 
-0.00520, 0.01628, 0.01528, 0.01225, 0.01125, 0.00772, 0.00671, 0.00369, 0.00520, -0.02099, 
--0.03408, -0.03862, -0.04416, -0.04113, -0.04063, -0.03106, -0.01897, -0.00688, 0.00722, 0.02233, 
-0.03391, 0.03139, 0.03139, 0.02686, 0.00772, -0.01394, -0.02653, -0.02804, -0.04667, -0.04819, 
--0.04617, -0.03811, -0.02602, -0.01797, -0.00890, 0.00017, 0.00420, 0.00823, 0.01024, 0.01377, 
-0.01276, 0.00420, 0.00772, 0.00218, -0.01394, -0.02300, -0.02905, -0.02300, -0.02552, -0.01847, 
--0.02099, -0.02149, -0.02199, -0.01847, -0.01293, -0.00235, 0.00268, 0.00923, 0.00823, 0.01427, 
--0.00789, -0.01696, -0.01192, -0.01192, -0.01746, -0.01696, -0.01847, -0.03005, -0.01595, -0.01645, 
--0.00840, -0.00034, 0.00974, 0.01125, 0.01175, 0.00621, 0.00168, 0.00520, -0.00840, -0.00991, 
--0.01293, -0.01645, -0.01746, -0.00487, -0.00588, -0.01293, -0.00286, -0.00386, -0.00588, 0.00520, 
-0.01125, 0.01528, 0.01377, 0.01427, 0.01326, 0.00117, -0.00134, -0.00789, -0.00235, -0.00638, 
--0.01243, -0.02048, -0.02451, -0.02250, -0.02955, -0.00638, 0.00268, 0.00017, 0.00420, -0.00034, 
-0.00168, -0.00235, 0.00168, 0.00823, 0.00420, 0.00420, -0.00487, -0.01343, -0.01998, -0.02149, 
--0.01847, -0.02300, -0.01998, -0.01243, 0.00168, -0.00034, 0.00923, 0.01326, 0.01175, 0.01024, 
-0.01175, 0.01175, 0.01326, -0.00890, -0.01444, -0.02905, -0.03459, -0.02955, -0.01797, -0.02451, 
--0.02602, -0.02048, -0.01847, -0.00537, -0.00235, 0.00017, 0.00319, 0.01225, 0.02283, 0.00974, 
-0.00017, -0.00487, -0.01998, -0.01998, -0.03509, -0.03912, -0.03660, -0.03862, -0.03862, -0.02955, 
--0.02048, -0.00789, -0.00789, -0.01394, -0.01394, -0.02099, -0.02703, -0.02502, -0.02250, -0.01494, 
--0.01091, -0.01595, -0.01897, -0.01998, -0.01948, -0.02099, -0.02502, -0.01797, -0.01494, -0.00840, 
--0.00840, -0.00991, -0.00840, -0.00487, -0.01041, -0.01998, -0.02099, -0.02602, -0.03005, -0.02854, 
--0.02451, -0.02250, -0.02502, -0.02703, -0.01645, -0.01091, -0.00688, -0.00286, 0.00369, 0.00268, 
--0.00286, -0.00688, -0.01394, -0.02199, -0.02199, -0.01696, -0.00991, 0.00520, 0.00923, 0.02132, 
-0.01830, 0.00923, 0.01125, -0.00386, -0.00286, -0.00588, -0.01797, -0.01444, -0.02300, -0.02451, 
--0.02250, -0.01595, -0.00991, -0.00688, -0.00235, -0.01293, 0.00117, 0.00369, 0.00621, 0.01225, 
-0.00621, 0.01024, 0.00621, 0.00218, -0.00386, -0.01041, -0.01394, -0.01394, -0.02502, -0.01897, 
--0.01847, -0.01243, -0.00991, -0.00638, -0.00487, 0.00621, 0.01779, 0.01628, 0.01528, 0.00571, 
--0.00336, -0.01041, -0.02149, -0.02250, -0.03308, -0.02905, -0.03005, -0.02300, -0.02048, -0.00537, 
--0.00034, 0.00722, 0.00873, 0.01074, 0.01074, -0.00185, 0.00168, 0.00117, -0.00084, -0.00940, 
--0.01394, -0.01494, -0.02401, -0.01696, -0.01998, -0.02048, -0.02250, -0.01595, -0.01343, -0.00739, 
-0.00268, 0.00520, 0.01225, 0.00974, 0.00722, 0.00268, -0.00034, -0.00437, -0.00688, -0.01091, 
--0.01847, -0.02149, -0.02199, -0.02199, -0.01645, -0.02199, -0.00789, -0.00537, -0.00688, -0.00588, 
--0.00588, -0.00789, -0.01041, -0.00739, -0.01041, -0.01041, -0.01645, -0.02451, -0.02905, -0.03761, 
--0.03408, -0.04063, -0.03408, -0.02602, -0.02451, -0.01797, -0.00840, -0.00134, 0.00420, 0.00218, 
-0.00520, -0.00235, -0.00537, -0.00688, -0.00991, -0.01696, -0.03005, -0.03056, -0.03308, -0.03459, 
--0.02602, -0.02653, -0.02653, -0.01494, -0.00940, -0.00588, -0.00286, -0.00034, -0.00638, -0.00688, 
--0.01645, -0.01494, -0.02502, -0.02653, -0.02502, -0.02905, -0.02804, -0.02401, -0.02401, -0.01243, 
--0.00789, -0.00235, 0.00168, 0.00168, 0.00168, 0.00268, -0.00739, -0.00537, -0.00789, -0.01243, 
--0.01545, -0.02351, -0.02401, -0.02703, -0.02199, -0.02300, -0.01696, -0.00688, -0.00588, -0.00437, 
--0.00386, 0.00117, 0.00117, -0.00185, 0.00168, -0.00134, -0.00437, -0.01494, -0.02602, -0.03005, 
--0.03257, -0.02955, -0.02300, -0.02048, -0.01595, -0.01192, -0.01091, -0.00386, 0.00017, 0.00369, 
-0.00168, 0.00117, 0.00319, 0.00369, -0.00386, -0.00134, -0.00840, -0.00890, -0.01243, -0.01746, 
--0.02602, -0.02804, -0.02199, -0.01847, -0.01293, -0.00840, -0.00487, -0.00638, 0.00319, 0.00520, 
-0.00823, 0.01175, 0.00923, -0.00386, -0.00840, -0.02300, -0.02250, -0.03308, -0.03056, -0.02804, 
--0.02300, -0.02199, -0.01847, -0.00688, -0.00336, 0.00621, 0.00823, 0.01175, 0.00873, 0.00319, 
-0.00268, 0.00117, -0.01243, -0.01696, -0.01998, -0.02451, -0.02199, -0.02955, -0.02703, -0.02552, 
--0.01645, -0.01394, -0.00487, 0.00268, 0.00117, 0.00420, 0.00621, 0.00319, -0.00386, -0.00789, 
--0.01343, -0.02300, -0.02401, -0.02199, -0.02552, -0.02149, -0.01243, -0.01192, -0.00487, 0.00319, 
-0.00621, 0.00671, 0.00520, 0.00621, 0.00571, 0.00571, 0.00017, -0.00991, -0.01545, -0.01797, 
--0.01897, -0.02804, -0.03408, -0.02854, -0.02905, -0.02149, -0.01746, -0.01192, -0.00588, -0.00185, 
--0.00437, -0.00437, -0.00084, -0.00638, -0.00940, -0.02048, -0.02099, -0.02955, -0.02602, -0.02149, 
--0.02754, -0.02905, -0.02502, -0.02602, -0.01998, -0.01897, -0.01394, -0.01746, -0.01444, -0.01444, 
--0.01696, -0.01595, -0.01545, -0.01394, -0.02401, -0.02250, -0.02552, -0.02653, -0.03358, -0.02552, 
--0.01746, -0.01545, -0.01897, -0.01847, -0.00991, -0.00588, -0.00638, -0.01394, -0.01494, -0.01797, 
--0.01797, -0.01797, -0.01494, -0.01394, -0.01293, -0.01645, -0.01545, -0.01797, -0.02199, -0.02199, 
--0.02099, -0.01444, -0.01545, -0.01343, -0.01192, -0.00890, -0.00890, -0.01192, -0.00638, -0.00688, 
--0.00688, -0.01243, -0.01091, -0.01494, -0.01645, -0.01041, -0.01041, -0.00991, -0.00991, -0.01293, 
--0.01293, -0.00991, -0.01343, -0.00991, -0.01091, -0.01142, -0.00789, -0.00386, -0.00286, -0.00437, 
--0.00286, -0.00588, 0.00067, -0.00286, -0.00789, -0.00789, -0.01091, -0.01041, -0.00638, -0.00235, 
--0.00386, 0.00369, 0.00218, -0.00487, -0.00789, -0.01192, -0.00991, -0.00991, -0.00739, -0.01797, 
--0.01343, -0.00890, -0.00588, -0.00134, -0.00386, -0.00840, -0.00789, -0.00638, -0.00840, -0.01243, 
--0.01091, -0.01746, -0.01595, -0.00789, 0.00168, 0.00571, 0.00823, 0.01024, 0.00621, 0.01074, 
-0.00873, 0.00722, 0.00218, 0.00017, -0.00487, -0.00638, -0.00840, -0.00840, -0.01645, -0.01293, 
--0.01494, -0.01091, -0.00940, -0.00437, 0.00168, 0.00319, 0.00671, 0.00218, 0.01024, 0.00923, 
-0.00520, 0.00520, -0.00185, 0.00268, 0.00117, 0.00117, 0.00520, -0.00134, -0.00034, 0.00369, 
--0.00235, -0.00084, 0.00420, 0.00420, 0.00671, 0.00571, 0.00571, 0.00319, 0.00369, 0.00268, 
--0.00286, -0.00588, -0.00890, -0.01394, -0.01494, -0.02048, -0.01494, -0.01091, -0.01192, -0.00638, 
--0.00185, 0.00268, 0.00621, 0.00823, 0.00923, 0.01074, 0.01125, 0.00823, -0.00034, -0.00235, 
--0.00991, -0.01243, -0.01041, -0.01494, -0.01293, -0.01192, -0.00789, -0.00437, -0.00437, -0.00487, 
--0.00386, -0.00134, -0.00537, -0.00688, -0.01041, -0.01041, -0.01091, -0.01041, -0.01293, -0.01243, 
--0.01041, -0.01645, -0.01091, -0.00991, -0.00940, -0.00386, -0.00084, -0.00840, -0.00840, -0.00688, 
--0.00991, -0.00890, -0.01444, -0.01394, -0.02048, -0.01847, -0.02250, -0.02099, -0.01595, -0.01797, 
--0.01243, -0.01293, -0.01091, -0.01041, -0.01444, -0.01444, -0.02048, -0.02149, -0.02250, -0.02300, 
--0.02199, -0.02502, -0.02401, -0.01897, -0.01444, -0.01091, -0.00688, -0.00386, -0.00890, -0.00991, 
--0.01444, -0.01091, -0.01948, -0.01998, -0.02703, -0.02804, -0.02653, -0.02854, -0.02099, -0.01897, 
--0.01394, -0.00890, -0.00991, -0.00185, 0.00017, -0.00588, -0.00286, -0.00134, -0.00134, -0.00991, 
--0.01343, -0.01394, -0.00890, -0.01293, -0.00739, -0.00437, -0.00940, -0.00588, -0.00789, 0.00017, 
-0.00017, -0.00638, -0.00286, -0.00286, -0.00286, -0.00084, -0.00940, -0.00789, -0.01394, -0.01192, 
--0.01696, -0.01394, -0.01444, -0.01192, -0.00638, -0.00991, -0.00235, -0.00588, -0.00386, -0.00840, 
--0.00688, -0.00688, -0.01041, -0.01243, -0.01494, -0.00991, -0.00890, -0.00789, -0.01041, -0.00437, 
--0.00487, -0.00235, -0.00185, 0.00017, -0.00286, -0.00638, -0.01041, -0.00840, -0.00638, -0.01192, 
--0.01293, -0.01444, -0.00991, -0.01091, -0.01243, -0.00437, -0.00487, -0.00336, -0.00890, -0.00537, 
--0.00437, -0.00638, -0.00185, -0.00537, -0.00588, -0.00537, -0.00588, -0.00286, -0.00185, -0.00034, 
--0.00588, -0.00840, -0.01293, -0.01243, -0.01091, -0.01041, -0.00890, -0.00940, -0.00638, -0.00688, 
--0.00386, -0.00840, -0.00688, -0.00890, -0.00638, -0.00940, -0.00537, -0.00537, -0.00185, 0.00117, 
--0.00286, -0.00386, 0.00067, -0.00235, -0.00386, -0.01091, -0.00890, -0.00890, -0.00688, -0.00386, 
--0.00688, -0.00437, -0.00286, -0.00185, 0.00571, 0.00117, 0.00017, 0.00117, 0.00168, 0.00168, 
--0.00487, 0.00067, -0.00185, 0.00268, -0.00286, 0.00017, 0.00571, 0.00923, 0.00823, 0.01074, 
-0.00168, 0.00722, 0.01326, 0.00974, 0.01074, 0.00571, 0.00923, 0.01125, 0.00772, 0.00823, 
-0.01024, 0.00722, 0.00823, 0.01175, 0.01225, 0.01074, 0.01377, 0.01377, 0.01477, 0.01578, 
-0.01830, 0.01377, 0.01830, 0.01326, 0.01326, 0.01528, 0.01074, 0.01074, 0.00923, 0.00974, 
-0.00369, 0.00117, 0.00369, 0.00268, 0.00671, 0.01024, 0.01477, 0.01931, 0.01830, 0.02233, 
-0.02736, 0.02132, 0.02535, 0.02585, 0.02031, 0.02233, 0.01981, 0.01427, 0.01477, 0.01125, 
-0.01528, 0.01024, 0.01578, 0.01528, 0.01729, 0.02233, 0.02736, 0.02787, 0.03190, 0.03492, 
-0.03744, 0.03542, 0.03139, 0.03139, 0.02686, 0.02636, 0.02585, 0.01729, 0.01326, 0.00621, 
-0.01326, 0.01125, 0.02888, 0.03391, 0.02988, 0.03341, 0.04399, 0.04348, 0.04197, 0.03643, 
-0.03945, 0.07320, -0.17460, 0.34870, 0.30539, -0.55437, -0.45917, 0.99994, 0.99994, 0.63831, 
--0.81224, -1.04544, 0.99238, 0.99994, -1.05148, -1.05199, -0.95730, -1.05199, -0.63646, -1.05199, 
--1.05199, -1.05047, -1.05199, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.99994, -1.05299, -1.05199, -1.05148, -1.05148, -1.05199, -1.05199, -1.05199, -1.05199, -1.05148, 
-0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, -1.05199, 
--1.05199, -1.05148, -1.05249, -1.05148, -0.96586, 0.08327, 0.22027, 0.22631, 0.99994, 0.99994, 
-0.99994, 0.99994, -0.26829, -0.22346, 0.97475, 0.73149, 0.02736, -1.05299, -1.05199, -1.05199, 
--1.05148, -1.05249, -1.05249, -1.05199, -0.47630, 0.99994, 0.99994, 0.99994, 0.99994, 0.77379, 
-0.76120, 0.74307, -0.07589, -0.89081, -1.05148, -1.05199, -0.27634, -0.19324, -0.56444, -1.04745, 
--0.57300, 0.39101, 0.51692, 0.88460, 0.69321, 0.51138, -0.07941, -0.11517, -1.05199, -1.05148, 
--1.05199, -1.05249, -1.05249, -0.68784, 0.37137, 0.99994, 0.99994, 0.99994, 0.99994, 0.99994, 
-0.69724, 0.87755, 0.99994, 0.99994, 0.60859, 0.59197, 0.15127, -0.00638, -0.01797, -0.31664, 
--1.05148, -1.05199, -1.05199, -1.05148, -1.05249, -0.80972, -0.08344, 0.66198, 0.49678, 0.27718, 
-0.19206, 0.68616, 0.97022, 0.99994, 0.74206, -0.26677, -0.96435, -0.97946, -0.27685, 0.15731, 
-0.08680, -0.19525, 0.00520, 0.01175, 0.52347, 0.74206, 0.56175, 0.37388, 0.20868, 0.15479, 
-0.15177, 0.10996, -0.03106, -0.29347, -0.69237, -0.89535, -0.89686, -0.68834, -0.68683, -0.64805, 
--0.26829, 0.37489, 0.53657, 0.34769, 0.42979, 0.63075, 0.79948, 0.63730, 0.10694, 0.03341, 
-0.22681, 0.48771, 0.19458, -0.02653, 0.55520, 0.24444, 0.13565, 0.20113, -0.01494, -0.03005, 
--0.07740, -0.41938, -0.32671, -0.25972, -0.46371, -0.31563, -0.06531, -0.10661, 0.27617, 0.30891, 
-0.17594, 0.19760, 0.20717, 0.60809, 0.56175, 0.16789, 0.09183, 0.10996, -0.27282, -0.46824, 
--0.47378, -0.50904, -0.59768, -0.36096, -0.14942, 0.18551, 0.74206, 0.71940, 0.63428, 0.59650, 
-0.59197, 0.30992, 0.16688, -0.05826, -0.32067, -0.71050, -0.71906, -0.78656, -0.75583, -0.57804, 
--0.27937, -0.06178, 0.44037, 0.46908, 0.61514, 0.58341, 0.41518, 0.28020, 0.18098, -0.04214, 
--0.07085, 0.00621, 0.15630, -0.02502, 0.05406, 0.06967, 0.00722, -0.01494, -0.15748, 0.13817, 
--0.14136, -0.08646, 0.18753, 0.16537, 0.23790, 0.22631, 0.24696, 0.34266, 0.35525, 0.40007, 
-0.22833, 0.10040, 0.16335, 0.18098, 0.10090, -0.01595, 0.06363, 0.04701, -0.11215, -0.20835, 
--0.00286, -0.13028, -0.00890, 0.42123, 0.33410, 0.22480, 0.16083, 0.14069, 0.07269, 0.22631, 
--0.31513, -0.40982, -0.53623, -0.56091, -0.33578, -0.40478, -0.23353, 0.25754, 0.31596, 0.39252, 
-0.51541, 0.45800, 0.60960, 0.20163, -0.07337, -0.12071, -0.46623, -0.34837, -0.34938, -0.60020, 
--0.38967, -0.50753, -0.25620, 0.09486, 0.34870, 0.00974, -0.02099, 0.14421, -0.02804, 0.15227, 
-0.30841, 0.17544, -0.05221, -0.09956, -0.13280, 0.28423, 0.44289, 0.26660, 0.12256, 0.05355, 
-0.15630, 0.36986, 0.11097, -0.10611, 0.08277, 0.08881, 0.04701, 0.30438, -0.05473, -0.27483, 
--0.51609, -0.08848, -0.03358, 0.00923, -0.16101, -0.02703, 0.12054, 0.56175, 0.68112, 0.57333, 
-0.26006, 0.13716, 0.04247, -0.09553, -0.10762, -0.11668, -0.70798, -0.78051, -0.82634, -0.41536, 
--0.14287, 0.11953, 0.23437, 0.45346, 0.51844, 0.84431, 0.95007, 0.71638, 0.33964, -0.18166, 
--0.47378, -0.57351, -0.79864, -0.57099, -0.95579, -0.89333, -0.38312, -0.26980, 0.07823, -0.01595, 
-0.13112, 0.33359, 0.40058, 0.51944, 0.62370, 0.59852, 0.47714, 0.31798, 0.15580, -0.00789, 
--0.10359, -0.32117, -0.29851, -0.63949, -0.66769, -0.67575, -0.54983, -0.39370, -0.08445, -0.01444, 
-0.34820, 0.35323, 0.53455, 0.48469, 0.38144, 0.32150, 0.07572, -0.03862, -0.01444, 0.00520, 
--0.12172, -0.17108, 0.01225, -0.12927, -0.16302, 0.05809, 0.18753, 0.09083, 0.38245, 0.50534, 
-0.29028, 0.29934, 0.52599, 0.24344, 0.14220, 0.06363, -0.13582, -0.51458, -0.82786, -1.05199, 
--1.05148, -1.03436, -0.49342, -0.10510, 0.00974, 0.56326, 0.99994, 0.99994, 0.99994, 0.88007, 
-0.69220, 0.51441, 0.27265, -0.03308, -0.28944, -0.39068, -0.42593, -0.64402, -0.71906, -0.62689, 
--0.44608, -0.38614, -0.23001, -0.09956, 0.19660, 0.09888, 0.04701, 0.01427, -0.02199, -0.06581, 
--0.02199, -0.20432, -0.22648, -0.18417, -0.01444, 0.18350, 0.29028, 0.42475, 0.47109, 0.34215, 
-0.21976, 0.39252, 0.32805, 0.22430, 0.14774, 0.11903, 0.04751, -0.00185, -0.08697, -0.01243, 
--0.08999, -0.16957, -0.28037, -0.29699, -0.11265, -0.02653, -0.07488, -0.19626, -0.25469, -0.07689, 
--0.04768, 0.14220, 0.21523, 0.11198, 0.14824, 0.17695, 0.23689, 0.38144, 0.37791, 0.29431, 
-0.17846, 0.16436, -0.14539, -0.32520, -0.30908, -0.32621, -0.37758, -0.25066, -0.28894, -0.06732, 
--0.02854, 0.01578, 0.05658, 0.13011, 0.01074, -0.10006, -0.26325, -0.07085, -0.04264, -0.01797, 
--0.06481, -0.37557, -0.31311, -0.34786, -0.32520, -0.20634, 0.00520, 0.06967, 0.18652, 0.27416, 
-0.39101, 0.48620, 0.63478, 0.47865, 0.33863, 0.17443, -0.15798, -0.16554, -0.11265, -0.28390, 
--0.27383, -0.45917, -0.64351, -0.38514, -0.27030, -0.22699, -0.16302, -0.08092, 0.27768, 0.49879, 
-0.62723, 0.84733, 0.76976, 0.60658, 0.36683, -0.10913, -0.37254, -0.37053, -0.46018, -0.38715, 
--0.35441, -0.28944, -0.13129, 0.09788, 0.28524, 0.43231, 0.34417, 0.22581, 0.38094, 0.32805, 
-0.17746, 0.07269, 0.00268, -0.10510, -0.60725, -0.63546, -0.61833, -0.75432, -0.56243, -0.16957, 
--0.04013, 0.06967, 0.13213, 0.31798, 0.40612, 0.44490, 0.29431, 0.06615, 0.22833, 0.20969, 
-0.15983, 0.09939, -0.02199, -0.42341, -0.54026, -0.53221, -0.49090, -0.41082, -0.34938, -0.24058, 
-0.02636, 0.35827, 0.48922, 0.43634, 0.43382, 0.21473, 0.01326, 0.03139, -0.13028, -0.26325, 
--0.36046, -0.25670, -0.21993, -0.11920, -0.03408, 0.13112, 0.35726, 0.40612, 0.44087, 0.41267, 
-0.26963, 0.24847, 0.26560, 0.21221, -0.02854, -0.24008, -0.53724, -0.48486, -0.48637, -0.40427, 
-0.04399, 0.14018, 0.17645, 0.37993, 0.42324, 0.25703, 0.28423, 0.26006, 0.21523, 0.03240, 
--0.00034, -0.26577, -0.17813, -0.05070, -0.09100, -0.10157, -0.09654, -0.04970, -0.03559, -0.10510, 
--0.02804, -0.07387, 0.00772, -0.03358, -0.01645, -0.04970, -0.17914, -0.23253, -0.21188, -0.26627, 
--0.25872, -0.14287, 0.09183, 0.22732, 0.21775, 0.23437, 0.33007, 0.23588, 0.20969, 0.15630, 
-0.02283, -0.19626, -0.21691, -0.16906, -0.14690, -0.05272, 0.03895, -0.03308, -0.03509, 0.05557, 
--0.04264, -0.02653, -0.05272, -0.13733, -0.09855, 0.01326, 0.23689, 0.23588, -0.01293, -0.01243, 
-0.01779, 0.00823, 0.00369, 0.10392, 0.08277, 0.04197, -0.04466, 0.11198, 0.17746, 0.10442, 
--0.16755, -0.23051, -0.17209, -0.12474, -0.11819, -0.17209, -0.16957, -0.09956, 0.04147, 0.09788, 
-0.15429, 0.05104, 0.08780, 0.13112, 0.20818, 0.28574, 0.22631, 0.19861, 0.20667, 0.08730, 
--0.10611, -0.35139, -0.41082, -0.48788, -0.53221, -0.34686, -0.21792, -0.03761, 0.09838, 0.23185, 
-0.16083, 0.08226, 0.09284, 0.05960, -0.12575, -0.17360, -0.16755, -0.23353, -0.21036, -0.07790, 
--0.04113, -0.03610, 0.00369, 0.09637, 0.21070, 0.16789, 0.16839, 0.16486, 0.19156, 0.11802, 
--0.13330, -0.17460, -0.17712, -0.21137, -0.24109, -0.16957, -0.13985, -0.06884, 0.19508, 0.28171, 
-0.34971, 0.35223, 0.22782, 0.12608, 0.06665, -0.01494, 0.03139, -0.04768, -0.00890, 0.02182, 
-0.00772, -0.01645, -0.06481, 0.03039, 0.01931, -0.00185, 0.02233, 0.07723, 0.09183, -0.00588, 
-0.00168, 0.03895, 0.01074, -0.14237, -0.21087, -0.28491, -0.26426, -0.12122, -0.13884, -0.07689, 
--0.06884, -0.13582, 0.06363, 0.06665, 0.00923, 0.06363, 0.16033, 0.16486, 0.28373, 0.24847, 
-0.13213, -0.00134, -0.12827, -0.26174, -0.19324, -0.35542, -0.22598, -0.04214, 0.02686, 0.13767, 
-0.25502, 0.20314, 0.12759, 0.12457, 0.06816, 0.13112, 0.06161, 0.01578, -0.00537, -0.17914, 
--0.14690, -0.19525, -0.23001, -0.12575, -0.16705, -0.14690, 0.04046, 0.06363, 0.08780, 0.10745, 
-0.28222, 0.24696, 0.23236, 0.16940, 0.14270, 0.05406, -0.00185, -0.05070, -0.06178, -0.08294, 
--0.04970, -0.19223, -0.21842, -0.10762, -0.12474, -0.11769, 0.04650, 0.17242, 0.19206, 0.18551, 
-0.21725, 0.18300, 0.11702, 0.14119, 0.10291, 0.05758, -0.04113, -0.15597, -0.16604, -0.16101, 
--0.17964, -0.18014, -0.19475, -0.16604, -0.09200, -0.07135, 0.06161, 0.20314, 0.20868, 0.15983, 
-0.19962, 0.18451, 0.13565, 0.01628, -0.15345, -0.12877, -0.21188, -0.24159, -0.23202, -0.18720, 
--0.09251, -0.02250, 0.02082, 0.04046, 0.00420, -0.06128, -0.02048, 0.03492, 0.04046, -0.02451, 
--0.05020, 0.01024, -0.04365, -0.07840, -0.03811, -0.02099, 0.01024, 0.02837, 0.03643, 0.07370, 
-0.15429, 0.10896, 0.15278, 0.14573, 0.06212, 0.05607, 0.06665, -0.08294, -0.11064, -0.17914, 
--0.19374, -0.16755, -0.05775, 0.02535, 0.07975, 0.07370, 0.05255, 0.11399, 0.20314, 0.19861, 
-0.10896, 0.02233, -0.00890, -0.03308, -0.00688, -0.00739, -0.02502, -0.10057, -0.10560, -0.14287, 
--0.17964, -0.06934, -0.01293, 0.02132, 0.08881, 0.11551, 0.12205, 0.02434, 0.02585, 0.00168, 
--0.09402, -0.04416, -0.07236, -0.02300, -0.03912, -0.03459, 0.03492, 0.06866, -0.01394, -0.17410, 
--0.21087, -0.11114, -0.08344, -0.01847, 0.05456, 0.07975, 0.11198, 0.10594, 0.08327, 0.07672, 
-0.06363, -0.03005, -0.02099, 0.04600, 0.04046, 0.02938, 0.05658, 0.05355, 0.01830, -0.02854, 
--0.07236, -0.07337, -0.10510, -0.11971, -0.03459, -0.03509, -0.04315, -0.03005, -0.01595, -0.01897, 
--0.07639, -0.00386, 0.02233, 0.06816, 0.11047, 0.10090, 0.07320, 0.13062, 0.09687, 0.07169, 
-0.02333, -0.01897, -0.05221, -0.06732, -0.06783, -0.07286, -0.13079, -0.12122, 0.00420, 0.03240, 
--0.00235, -0.00386, -0.01595, 0.04449, 0.06564, 0.08629, 0.05406, 0.03139, 0.03139, 0.05960, 
-0.04247, 0.04953, 0.02031, -0.06078, -0.18014, -0.23958, -0.18669, -0.14489, -0.09553, -0.07941, 
--0.05574, -0.01091, 0.01125, 0.07420, 0.07018, 0.14069, 0.10745, 0.02938, 0.00520, 0.02585, 
-0.00168, -0.03912, 0.01125, -0.05524, -0.09351, -0.10208, -0.01746, 0.02686, 0.01981, 0.01981, 
-0.03593, 0.09385, 0.06615, 0.08529, 0.07118, 0.00168, -0.03962, -0.13280, -0.08243, -0.10057, 
--0.11064, -0.12373, -0.04013, 0.00571, 0.13313, 0.14321, 0.09133, 0.13817, 0.17242, 0.19508, 
-0.20113, 0.12054, 0.08428, 0.02031, -0.05121, -0.04416, -0.12776, -0.20231, -0.22547, -0.23807, 
--0.18720, -0.09503, -0.06833, 0.06061, 0.05557, 0.01628, 0.02636, -0.00840, -0.06581, -0.07135, 
--0.04768, -0.03056, 0.00319, 0.00873, 0.03089, 0.04953, 0.03492, 0.00873, -0.02250, -0.01394, 
--0.04617, -0.04416, -0.00336, 0.05456, 0.01981, -0.01998, -0.03912, -0.06481, -0.08243, -0.07286, 
--0.05977, -0.09855, -0.10510, -0.05373, -0.03660, 0.00873, 0.00621, -0.01293, -0.02099, -0.06732, 
--0.00437, 0.08377, 0.08629, 0.03895, 0.04801, 0.03844, 0.03593, 0.06010, 0.05507, 0.08831, 
-0.07672, -0.03056, -0.05624, -0.04365, -0.07286, -0.12927, -0.17410, -0.13834, -0.13079, -0.14388, 
--0.06934, 0.01427, 0.10291, 0.17443, 0.15882, 0.16083, 0.10896, 0.10191, 0.07773, -0.00386, 
--0.03610, -0.07538, -0.10208, -0.11114, -0.12424, -0.08999, -0.04315, -0.01897, 0.00772, -0.02099, 
-0.00571, 0.03039, 0.05910, 0.07118, 0.05809, 0.02132, -0.07538, -0.11114, -0.10308, -0.11719, 
--0.10208, -0.03761, -0.05121, -0.06128, -0.05373, -0.02250, 0.00974, 0.02434, 0.04701, 0.07773, 
-0.07219, 0.04247, 0.04348, 0.04449, 0.04348, 0.04953, 0.04852, 0.00823, -0.02300, -0.07236, 
--0.08747, -0.07085, -0.08294, -0.10258, -0.10258, -0.09452, -0.06732, 0.00017, -0.01192, -0.02451, 
--0.02602, 0.00974, 0.04449, 0.03039, 0.02283, 0.05406, 0.07370, 0.05758, 0.06312, 0.07773, 
-0.07471, 0.06615, 0.04852, 0.04147, 0.00420, -0.00688, -0.00084, -0.02451, -0.06884, -0.09251, 
--0.10862, -0.07286, -0.06178, -0.03912, -0.00437, -0.00739, 0.00571, 0.02535, 0.04751, 0.03744, 
--0.00185, -0.09553, -0.07689, -0.13834, -0.13582, -0.12071, -0.08495, -0.04164, -0.01142, 0.07219, 
-0.09586, 0.10241, 0.09234, 0.07118, 0.04801, 0.02787, 0.08126, 0.04953, 0.06816, 0.00017, 
--0.08495, -0.11316, -0.13431, -0.12575, -0.13028, -0.13633, -0.07740, -0.03106, 0.07018, 0.09536, 
-0.09183, 0.07622, 0.06061, 0.04298, 0.05255, 0.00117, -0.02300, -0.05221, -0.08344, -0.10107, 
--0.09150, -0.00286, 0.00923, 0.00268, 0.04096, 0.04147, 0.07068, 0.08478, 0.10090, 0.05154, 
-0.02182, 0.01729, 0.00823, -0.09251, -0.09704, -0.10107, -0.08193, -0.06330, -0.00235, 0.02233, 
-0.03190, 0.05053, 0.11148, 0.10594, 0.06564, 0.05456, 0.06363, 0.01225, -0.03408, -0.05020, 
--0.06481, -0.06078, -0.08294, -0.07538, -0.09452, -0.08546, -0.05070, -0.03106, 0.00923, 0.01981, 
-0.03089, 0.06665, 0.03945, 0.02938, -0.00638, -0.04768, -0.09956, -0.12373, -0.12978, -0.10460, 
--0.08193, -0.03459, 0.02837, 0.05910, 0.06010, 0.10040, 0.08629, 0.09888, 0.09888, 0.09888, 
-0.02988, -0.01897, -0.06027, -0.09150, -0.06229, -0.06481, -0.06934, -0.05322, -0.01645, 0.00369, 
-0.01326, 0.02535, 0.02787, 0.02434, 0.03744, 0.01578, 0.00420, 0.01931, 0.03945, 0.04953, 
-0.04751, 0.03039, 0.01628, 0.01578, 0.01225, -0.00638, -0.02703, -0.03710, -0.04113, -0.02502, 
--0.01243, -0.01746, -0.02451, -0.00487, 0.03895, 0.05658, 0.05809, 0.05507, 0.04852, 0.05507, 
-0.06816, 0.06715, 0.04600, 0.04701, 0.04399, 0.03341, 0.01477, -0.00386, -0.05070, -0.04869, 
--0.07538, -0.09049, -0.07891, -0.07438, -0.01243, -0.01696, -0.00940, -0.00235, -0.00840, 0.00319, 
-0.00772, -0.01797, -0.01444, -0.02250, -0.03710, -0.04315, -0.02552, -0.05272, -0.04970, -0.06078, 
--0.07941, -0.05070, -0.05524, -0.02754, 0.00974, 0.03190, 0.04902, 0.08680, 0.10090, 0.09133, 
-0.04600, -0.03660, -0.06330, -0.08848, -0.09150, -0.10208, -0.10057, -0.08243, -0.06128, -0.00789, 
--0.00034, 0.02182, 0.01175, 0.01175, 0.01729, 0.03391, 0.05507, 0.03442, 0.01326, 0.00772, 
--0.01797, -0.05221, -0.04315, -0.04516, -0.05775, -0.04264, -0.03610, -0.01797, 0.01880, 0.04902, 
-0.05758, 0.05104, 0.04751, 0.03039, 0.00520, -0.00185, -0.02250, -0.06732, -0.09553, -0.08898, 
--0.07085, -0.03459, -0.01444, -0.03761, 0.00923, 0.02233, 0.01931, 0.03593, 0.06866, 0.09838, 
-0.07370, 0.04751, 0.04247, 0.01225, -0.02552, -0.05070, -0.09402, -0.12071, -0.08898, -0.11971, 
--0.11265, -0.08747, -0.05675, -0.02199, 0.00974, 0.01175, 0.04298, 0.07320, 0.09737, 0.08277, 
-0.08327, 0.07169, 0.01225, -0.03912, -0.07135, -0.10510, -0.09049, -0.07740, -0.07891, -0.07286, 
--0.04819, -0.02602, 0.02434, 0.04550, 0.02938, 0.00571, 0.01578, 0.02736, 0.01074, 0.01225, 
-0.01981, -0.01645, -0.05020, -0.05473, -0.03459, -0.05322, -0.05423, -0.03056, -0.01091, 0.00420, 
--0.00437, 0.00772, 0.01175, 0.00923, -0.00487, -0.03408, 0.00319, -0.00890, 0.01427, 0.03039, 
-0.03593, 0.01628, -0.00386, -0.03710, -0.04667, -0.03811, -0.06884, -0.07286, -0.06279, -0.02754, 
--0.01897, -0.00688, -0.04013, -0.05624, -0.03056, -0.04013, -0.01494, -0.00386, -0.00437, -0.03005, 
-0.00520, -0.00336, -0.01797, -0.01998, -0.00840, -0.02502, -0.01847, -0.00890, -0.02048, -0.02955, 
--0.01746, -0.01494, 0.00923, 0.00218, 0.01125, 0.02585, 0.02636, 0.00772, -0.00235, -0.01897, 
--0.03710, -0.03962, -0.06128, -0.04617, -0.04718, -0.04416, -0.03005, -0.01293, 0.02333, 0.04801, 
-0.03744, 0.01024, 0.01528, 0.00923, -0.00487, -0.01041, -0.00688, -0.02199, -0.03811, -0.02552, 
--0.02502, -0.02653, -0.04013, -0.05221, -0.05272, -0.03912, -0.02653, 0.01225, 0.04449, 0.05960, 
-0.06212, 0.05607, 0.05910, 0.05960, 0.04298, 0.02233, -0.01343, -0.06128, -0.07941, -0.11366, 
--0.11719, -0.10460, -0.07286, -0.04516, -0.01797, 0.00772, 0.03039, 0.06413, 0.07874, 0.08176, 
-0.07068, 0.06615, 0.02031, -0.00991, -0.03257, -0.04416, -0.05373, -0.06229, -0.05927, -0.06330, 
--0.03912, -0.04013, -0.01897, 0.00319, 0.02384, 0.04449, 0.06514, 0.06212, 0.06262, 0.06917, 
-0.06464, 0.04399, 0.02837, -0.00638, -0.03459, -0.05927, -0.07740, -0.06732, -0.06833, -0.07085, 
--0.04416, -0.01293, 0.05960, 0.08831, 0.10241, 0.10795, 0.11198, 0.08377, 0.07622, 0.04399, 
-0.02233, 0.00117, -0.02905, -0.02854, -0.01897, -0.02653, -0.00487, 0.01175, 0.00319, 0.01326, 
-0.04600, 0.05053, 0.04247, 0.05255, 0.04902, 0.01225, -0.00537, -0.00789, -0.03811, -0.04315, 
--0.06229, -0.06229, -0.06430, -0.04718, -0.02149, -0.00890, 0.01074, 0.02938, 0.02283, 0.02132, 
-0.01477, 0.01779, 0.02736, 0.01830, 0.01225, -0.01394, -0.02955, -0.04164, -0.06128, -0.07438, 
--0.07236, -0.06682, -0.04264, -0.02602, -0.01444, 0.02686, 0.04751, 0.06212, 0.06061, 0.05658, 
-0.01326, -0.00034, -0.02300, -0.03610, -0.05373, -0.04264, -0.03459, -0.03660, -0.01847, 0.00621, 
-0.00671, 0.02132, 0.01578, 0.01729, -0.00235, -0.01041, 0.00823, 0.01074, -0.00588, -0.01545, 
--0.04416, -0.04667, -0.04013, -0.03811, -0.01041, -0.00840, -0.00235, 0.01175, 0.02031, 0.02636, 
-0.02787, 0.03190, 0.00671, -0.00688, -0.00840, 0.00117, -0.00991, -0.02653, -0.04264, -0.05322, 
--0.05322, -0.04013, -0.03257, -0.00890, -0.00638, 0.01225, 0.00268, -0.00134, -0.00537, -0.02199, 
--0.02602, -0.01746, -0.01696, -0.02199, -0.03106, -0.02401, -0.01243, -0.02602, -0.02905, -0.05020, 
--0.05221, -0.05927, -0.04315, -0.02653, -0.00991, -0.01041, -0.02048, -0.01293, -0.00991, -0.00487, 
--0.00638, 0.01024, 0.00571, -0.00185, -0.01293, 0.00017, 0.01779, 0.02585, 0.00873, 0.00571, 
-0.00571, -0.00840, -0.02099, -0.03408, -0.02854, -0.02905, -0.04164, -0.04667, -0.04365, -0.02552, 
--0.01293, 0.00369, 0.01779, 0.02283, 0.02333, 0.01628, 0.00571, -0.01696, -0.02300, -0.00789, 
--0.00437, -0.00638, -0.01897, -0.00588, 0.00319, 0.00571, -0.00134, -0.01293, -0.02804, -0.02854, 
--0.02451, -0.03056, -0.01696, -0.03106, -0.04819, -0.03106, -0.02804, -0.02804, -0.02250, -0.00235, 
--0.00638, -0.00789, -0.01142, 0.00218, 0.00420, -0.00034, -0.01444, -0.03660, -0.04315, -0.05675, 
--0.05775, -0.04617, -0.03106, -0.01595, 0.00722, 0.02585, 0.04600, 0.04449, 0.03542, 0.02988, 
-0.01326, 0.00420, -0.01847, -0.02804, -0.04667, -0.08193, -0.07387, -0.06632, -0.05725, -0.04063, 
--0.02300, -0.02300, -0.01091, 0.00369, 0.01377, 0.02333, 0.02031, 0.00823, 0.02333, 0.01981, 
--0.00487, 0.00117, -0.01394, -0.02502, -0.02149, -0.04013, -0.04617, -0.03710, -0.03811, -0.02703, 
-0.00168, 0.00722, 0.00017, 0.00823, 0.00923, 0.01024, 0.02082, 0.01779, 0.00017, -0.00185, 
--0.01998, -0.02905, -0.04567, -0.05070, -0.03710, -0.03005, -0.02401, -0.01494, 0.00117, 0.00974, 
-0.01024, 0.01125, 0.02233, 0.03089, 0.03139, 0.01276, 0.00571, -0.00688, -0.01293, -0.01444, 
--0.02401, -0.02602, -0.02451, -0.01746, -0.02401, -0.01847, -0.01494, -0.02703, -0.02401, -0.01494, 
--0.00286, -0.00134, 0.00067, 0.00017, 0.01931, 0.02333, 0.01628, 0.01074, 0.01427, 0.00671, 
--0.00537, -0.01041, -0.02451, -0.02199, -0.02955, -0.01696, 0.01175, 0.01125, 0.02636, 0.02787, 
-0.02837, 0.02535, 0.01729, 0.00772, -0.00487, -0.02401, -0.03005, -0.02502, -0.02602, -0.01645, 
--0.01091, -0.00487, -0.00235, 0.00268, -0.00386, -0.01192, -0.01041, -0.01041, -0.00034, 0.00319, 
--0.00134, -0.01192, -0.00386, -0.01797, -0.02250, -0.03358, -0.04718, -0.05322, -0.04667, -0.04315, 
--0.05373, -0.03408, -0.02905, -0.00588, 0.01377, 0.01528, 0.01931, 0.02787, 0.02535, 0.01779, 
-0.00772, -0.00890, -0.02905, -0.03912, -0.05221, -0.05322, -0.04063, -0.02199, -0.01293, -0.00537, 
-0.00923, 0.02182, 0.02333, 0.02283, 0.01578, 0.00772, -0.01494, -0.02905, -0.03459, -0.03660, 
--0.03408, -0.04013, -0.03811, -0.03459, -0.02703, -0.00840, -0.00134, 0.00923, 0.01427, 0.02132, 
-0.02988, 0.02434, 0.01628, 0.01830, 0.00923, 0.01225, 0.00671, -0.00336, -0.01091, -0.03106, 
--0.03106, -0.02905, -0.02149, -0.02502, -0.00638, 0.00772, 0.02132, 0.03341, 0.04701, 0.05809, 
-0.05960, 0.04399, 0.01729, -0.00991, -0.02602, -0.03056, -0.03358, -0.03358, -0.04264, -0.02905, 
--0.01998, -0.00789, 0.00218, 0.00571, 0.01175, 0.01326, 0.01477, 0.00873, -0.00185, -0.01192, 
--0.01343, -0.02300, -0.02502, -0.02804, -0.02552, -0.02451, -0.02703, -0.02250, -0.01394, -0.01041, 
--0.01091, -0.00437, 0.00117, 0.00117, 0.00369, 0.00117, 0.00319, -0.00688, -0.01595, -0.01897, 
--0.02552, -0.02401, -0.02199, -0.02401, -0.02804, -0.02300, -0.01998, -0.01192, -0.00890, -0.01394, 
--0.00386, -0.00789, -0.01293, -0.01847, -0.01696, -0.01897, -0.01746, -0.01746, -0.03056, -0.02955, 
--0.02502, -0.02199, -0.01797, -0.01041, -0.00840, -0.00688, -0.00940, -0.00185, -0.00084, -0.00688, 
--0.00789, -0.00789, -0.01897, -0.02199, -0.02804, -0.02955, -0.02703, -0.03056, -0.03056, -0.02149, 
--0.02099, -0.01192, -0.00991, -0.00537, -0.00789, 0.00571, 0.00117, -0.00235, -0.00235, -0.00890, 
--0.01444, -0.02199, -0.02502, -0.02300, -0.02300, -0.01998, -0.01595, -0.01343, -0.00739, 0.00319, 
-0.00621, 0.00268, 0.00117, -0.01243, -0.01293, -0.00487, -0.00437, -0.03559, -0.04113, -0.03761, 
--0.03005, -0.02804, -0.02602, -0.02401, -0.01595, -0.00437, 0.00571, 0.00923, 0.01528, 0.01628, 
-0.01628, 0.01779, 0.01024, -0.00487, -0.01595, -0.02048, -0.02552, -0.02552, -0.02250, -0.02653, 
--0.02250, -0.01192, -0.00890, -0.00386, 0.00117, -0.00134, -0.01293, -0.00890, -0.00789, -0.00437, 
--0.00638, -0.01243, -0.00940, -0.00336, 0.00017, -0.01243, -0.00840, -0.01293, -0.01545, -0.01847, 
--0.01897, -0.00789, 0.00067, 0.00218, 0.00117, 0.00017, 0.00369, 0.00117, 0.00218, -0.00588, 
--0.00588, -0.01293, -0.01746, -0.01696, -0.01394, -0.01797, -0.00940, -0.01746, -0.00588, 0.00420, 
-0.00923, 0.01175, 0.01175, 0.01326, 0.00067, 0.00268, -0.00034, -0.00840, -0.01746, -0.02451, 
--0.01494, -0.01343, -0.00840, 0.00319, 0.00974, 0.01225, 0.00923, 0.00722, -0.00084, -0.02199, 
--0.02602, -0.02250, -0.03056, -0.02955, -0.02250, -0.01494, -0.01746, -0.01243, -0.00487, -0.00688, 
--0.00688, -0.00588, 0.01175, 0.00621, 0.00671, 0.00420, -0.00134, -0.00286, -0.01645, -0.01645, 
--0.02300, -0.02804, -0.02602, -0.02703, -0.02703, -0.02250, -0.01343, -0.01847, -0.01645, -0.00688, 
--0.00638, 0.00369, 0.00823, 0.00470, -0.00134, -0.01645, -0.02300, -0.03459, -0.04063, -0.04214, 
--0.03912, -0.02804, -0.01897, -0.01444, -0.00688, -0.00185, 0.00671, 0.01074, 0.00823, 0.00168, 
--0.00437, -0.00437, 0.00168, -0.00588, -0.00638, -0.01645, -0.02703, -0.02854, -0.03509, -0.02955, 
--0.02300, -0.01545, -0.01545, -0.00789, -0.00185, 0.00420, 0.00772, 0.01024, 0.00369, 0.00823, 
-0.00621, 0.00017, -0.00537, -0.01696, -0.02300, -0.02250, -0.02451, -0.02854, -0.01998, -0.01444
+static const int16_t plantilla_dos_aplausos_q14[PLANTILLA_MUESTRAS] = {
+7372, -6500, -13192, -11063, -5840, -4750, 2990, 16383, 16383, -5097,
+-17227, -17244, -5427, 853, -7952, -17244, -17236, -17244, -17236, -17236,
+-17227, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383,
+16383, 10590, -17227, -17236, -17236, -17227, -17227, -17046, -17227, -17236,
+-17227, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, -17236,
+-17236, -17236, -17252, -17227, -17236, -17244, 9724, 16383, 16383, 16383,
+16383, 16383, 16383, 16383, 16383, 15500, -17227, -17227, -17219, -17236,
+-17244, -17227, -17227, -17227, -17236, -2473, 16383, 16383, 16383, 16383,
+16383, 16383, 16383, 3708, -10056, -8258, -3075, 5267, -7738, -12301,
+-8629, 3708, 8750, 11077, 11655, 13033, 10846, 3733, -3141, -17236,
+-17236, -17236, -17236, -17244, -17227, -17236, -5221, -2192, 16383, 16383,
+16383, 16383, 16383, 16383, 16383, 13354, 12298, 8090, -600, 1901,
+19, -2151, -6046, -17236, -16675, -17236, -17227, -17302, -17137, -6797,
+1554, 7314, 6093, 8601, 11407, 4492, -7243, -11113, -16427, 5111,
+960, -4132, -7977, -5576, -286, 11052, 12736, 12133, 13082, 12315,
+11919, 2891, 9641, -1945, -12821, -5361, -8786, -15874, -12928, -15115,
+-9371, -2588, -3876, -1565, 2421, 9336, 9393, 6299, 3328, 13107,
+7463, 1942, 5102, 6192, 894, -864, 4632, 3790, -1714, 3667,
+-3042, -8497, -7168, -2209, -5270, -3075, 1043, 366, -1953, 36,
+3733, 3774, 4492, -1326, -6648, -5650, -2737, -2357, -3925, -8010,
+-6360, -402, 2429, 7628, 9253, 8544, 12282, 7479, 6563, -4998,
+-4850, -15577, -13357, -9817, -11831, -7655, 894, 1422, 1422, 3741,
+4739, 5267, 4401, 1521, 3237, 1785, 5705, 1678, -3348, -1747,
+1282, 1711, -5642, -1780, 2487, 176, 968, -1120, 1785, -600,
+1208, 1950, 3535, 2610, 3865, 2701, 4252, 3155, 6472, 787,
+1447, -3455, -171, -1483, -3315, -880, 2132, 1513, 1637, -1664,
+646, 3865, 2734, 6489, 2445, -4618, -7804, -7333, -7614, -9520,
+-2201, 6142, -245, 2924, 10095, 8453, 7817, 7826, 3271, -3801,
+-2192, -5741, -10436, -9982, -4140, 927, 234, 679, 2685, -1714,
+4112, 5829, -476, -195, -1747, -2489, -2539, 2289, 4558, 9328,
+5639, 4005, 1389, -641, 283, 2668, 3584, 3006, 1934, -6549,
+-5460, -3785, -3422, 1480, -2357, 1100, 5185, 5325, 8403, 10351,
+9567, 7009, 9393, 2594, -4173, -10651, -14876, -12243, -8786, -8324,
+-3529, 5787, 6126, 6769, 9955, 15871, 11597, 5631, 2462, -4693,
+-12301, -11030, -17145, -15247, -8596, -6508, -1210, -2291, 1645, 3815,
+10153, 10367, 6200, 8469, 6175, 4871, 5383, 2214, -352, -4379,
+-10329, -12219, -13027, -14306, -5361, 1529, 4822, 4318, 6604, 8692,
+5375, 6456, 6629, 3535, 1150, -6896, -7482, -1978, 481, 1505,
+2000, 3733, 4261, 3163, 226, 4715, 8279, 12538, 7743, 2883,
+2074, 135, -2217, -10824, -17244, -14587, -15825, -15107, -6780, -4181,
+-1458, 7108, 14873, 16383, 13759, 9897, 2363, 291, -872, -1450,
+-4511, -8010, -9132, -4668, -3017, 209, 2767, 4847, 3856, 2049,
+-2440, -4115, -3191, -1301, -3430, -4098, -3339, 44, -575, 531,
+1191, 721, 3039, 3229, 4632, 6299, 3881, 3708, 4286, 6134,
+3287, 993, -2068, -4495, -2704, -3645, -3653, -1912, -4660, -3315,
+-154, 102, 1232, -2300, -1219, -6, 1810, 6555, 4797, 5086,
+3865, 3543, -889, -2910, -4437, -2778, -1837, -2886, -3488, -4354,
+-4354, 1480, 1117, 1224, 1521, 844, 1381, -1491, -2423, -3661,
+-7251, -6747, -4610, -4891, -6838, -6855, 704, 2858, 7421, 8313,
+9179, 8288, 7619, 3774, 1117, 1034, 704, -913, -6599, -7952,
+-6219, -6665, -6615, -7729, -7927, -608, 3856, 4409, 9262, 11490,
+9641, 8799, 4772, 1249, -3034, -5551, -7127, -9190, -7564, -2291,
+-360, 1893, 5267, 8189, 9262, 9616, 8775, 5243, -303, -5889,
+-10288, -10543, -10667, -9924, -6838, -2547, -3348, -1400, 1224, 6530,
+5375, 4756, 4541, 4690, 4781, 5490, 5078, 1884, -798, -4602,
+-5444, -7127, -7366, -7358, -7226, -633, 6117, 6357, 6736, 3708,
+3667, 2701, 688, -1945, -4008, -5179, -7589, -5014, -1078, 1364,
+3955, 5102, 5853, 6159, 7372, 7710, 2346, -220, -3183, -5031,
+-4057, -6409, -4189, -2176, -2085, -30, 4087, 4904, 5581, 5251,
+5754, 5581, 1752, -2506, -938, -1276, -1458, 316, -129, -699,
+-2118, -1788, 184, 1983, -261, -534, -2341, -2308, -1945, -2696,
+-1664, -2159, -5155, -6467, -2654, -542, 787, 3708, 4814, 2602,
+1711, 1645, -1516, -484, -261, -14, -1153, -113, -344, -1450,
+160, 1141, 1571, -212, -327, -1986, 242, 580, 3, -138,
+1950, 1307, 1612, 1719, -913, 853, 2693, 135, 85, -2613,
+-1301, -633, -2052, -2803, -3810, -2324, 688, 523, 968, 2553,
+4591, 5086, 3724, 2767, 3708, 3485, -6, -2291, -3785, -5650,
+-5716, -6665, -5427, -1895, 234, 1760, 1868, 3328, 3452, 1736,
+69, -897, -2704, -3414, -3669, -2300, -1912, -171, -220, 1257,
+2594, 3559, 2297, 3609, 2388, 193, -1070, -2308, -3983, -2869,
+-3760, -1763, -1821, -666, 1884, 3865, 3477, 1736, 2082, 1587,
+69, 795, -360, -1755, -435, -905, 151, 36, 844, 2181,
+2000, 1579, 1917, 2132, 1191, -204, -946, -3331, -4371, -2465,
+-3034, -2448, -2886, -3100, -2712, -1260, -1144, -162, 762, 2454,
+3221, 2206, 3122, 2998, -146, -1895, -3191, -3810, -4948, -4297,
+-2902, -1540, 1282, 3064, 2355, 2676, 2280, 2792, 2685, -591,
+-2308, -3678, -4272, -3447, -2184, -2943, -2514, -1425, 94, 704,
+1950, 2998, 4137, 4244, 2511, 2008, 1637, 1034, 1331, -1219,
+-4742, -3983, -3876, -2704, -2093, -567, 1406, 3163, 3584, 3427,
+2767, 2528, 1257, 490, -336, -1474, -2481, -2011, -3183, -3546,
+-2382, -2803, -756, -798, 19, 2107, 1711, 2462, 3295, 2412,
+176, -1565, -2093, -2704, -3892, -3298, -3628, -1590, -1202, -344,
+-641, -773, 151, 1216, 168, 85, -352, 118, -311, -1648,
+-2267, -1714, -616, 1059, -418, 465, 960, 1826, 2099, 2974,
+2635, 2792, 861, -1021, -2390, -2605, -2877, -1285, -1004, -558,
+-294, 745, 1835, 2767, 2792, 1884, 1777, 613, 415, 126,
+-426, -1417, -1392, -1194, -2225, -1136, 357, 1859, 1760, 1141,
+1183, 985, 811, 234, -1829, -987, 357, 275, -1103, -1359,
+-657, 201, -220, -1656, -2877, -2877, -1557, -1458, -806, 349,
+1521, 1208, 1249, 514, 465, 184, 391, 102, 60, 1009,
+811, 259, 184, 110, 976, -591, -212, -550, -1334, -1433,
+-831, -542, -1483, -195, 514, 357, 291, 168, -146, 613,
+597, 795, 828, 993, 2140, 2445, 2610, 2924, 1785, 1183,
+-30, -558, -1408, -2861, -3348, -2762, -1557, -591, 77, -905,
+498, 1430, 2049, 1967, 1496, 1117, 943, 465, 391, -261,
+-773, -1549, -2465, -2374, -1846, -2110, -2333, -1565, -212, -105,
+52, 1356, 1439, 630, 151, -14, 160, -80, -88, -492,
+-1194, -1524, -1854, -1714, -1400, -492, 1043, 1554, 1447, 1472,
+1925, 1323, 556, -1070, -2011, -1615, -1029, -2852, -2176, -641,
+242, 415, 1439, 2462, 2874, 3609, 2808, 2742, 1562, 1274,
+547, -22, -1021, -2374, -3009, -2522, -822, -1078, -377, -63,
+465, 126, -303, 85, -146, -369, -567, -550, -121, 3,
+374, -80, -30, 19, -798, -674, -146, -14, 300, 135,
+176, 160, 415, 102, -773, -806, -1351, -1928, -1359, -1070,
+-971, -1202, -831, -707, -938, -616, -88, 1075, 1331, 564,
+547, -121, 85, 1241, 1744, 2388, 2404, 1876, 655, -80,
+-831, -1021, -1276, -2044, -2201, -2333, -2225, -600, -39, 2379,
+2833, 1628, 1893, 2313, 2107, 1785, 630, -773, -724, -657,
+-1012, -1656, -1631, -971, -459, -245, 184, 910, 1282, 1389,
+1191, 531, -6, -674, -1433, -1590, -1813, -2068, -1730, -1384,
+-1062, -608, 126, 597, 267, 1208, 803, 1117, 1257, 1406,
+993, 448, -88, -1144, -1045, -1186, -1351, -2019, -2044, -1169,
+-542, -1153, -484, -220, 94, -179, -336, 432, 820, 1026,
+968, 1117, 465, 704, 1166, 886, 894, 853, 300, 69,
+-426, -1301, -674, -492, -773, -484, -443, -748, -80, 457,
+688, -129, -435, -1070, -1862, -2019, -2242, -1722, -1408, -1483,
+-575, 382, 1067, 1191, 1307, 1232, 1430, 1141, 1381, 1026,
+-567, -690, -1070, -1318, -2143, -2630, -2390, -2225, -682, 201,
+721, 844, 828, 613, 745, 919, 448, -179, -1021, -1285,
+-2068, -1491, -1021, 135, 201, 366, 985, 952, 910, 1422,
+1505, 1257, 696, 242, 135, -286, -946, -1417, -1334, -1631,
+-1128, -484, 226, 1018, 1389, 1274, 1274, 1092, 952, 1249,
+349, -278, -773, -831, -831, -897, -1425, -1202, -946, -748,
+-385, -105, 333, 968, 770, 415, -105, -657, -1078, -1417,
+-1549, -1978, -2374, -1293, -1565, -1268, 506, 1216, 1084, 1257,
+1579, 1307, 1092, 663, -360, -996, -1186, -1689, -1268, -1219,
+-1202, -1161, -47, 250, 168, 382, 349, -171, -245, -88,
+349, 217, -435, -534, -905, -649, -204, -72, 556, 300,
+828, 1290, 1224, 1249, 1224, 1372, 985, 556, -443, -1334,
+-872, -633, -864, -963, -1136, -839, -443, -484, 217, 374,
+366, 556, -443, -822, -806, -666, -567, -369, -286, -641,
+-1169, -1194, -1095, -814, -484, -204, 399, 382, 382, 745,
+1043, 696, 704, 613, -121, -311, -897, -1549, -2027, -2135,
+-1268, -1029, 135, 283, 110, 399, 828, 853, 242, 308,
+151, -393, -253, -195, -311, -542, -798, -699, -591, -468,
+-6, 283, 655, 902, 1018, 1059, 646, 688, 663, 217,
+-96, -1202, -1285, -905, -987, -897, -921, -418, 226, 242,
+275, 902, 1381, 1406, 1175, 1175, 1109, 424, 110, -798,
+-1268, -1664, -1714, -1598, -1565, -1466, -987, -674, -393, 481,
+820, 1356, 1579, 1472, 1587, 1513, 968, 432, -633, -1351,
+-1450, -1169, -1433, -1276, -600, -270, 399, 514, 655, 820,
+762, 861, 630, 597, 688, 19, -47, -80, -468, -377,
+-418, -534, -542, -286, -171, -113, -402, -14, 94, 85,
+102, 184, 94, 357, 448, 481, 523, 646, 490, 234,
+3, -171, -459, -245, -509, -946, -889, -575, -550, -245,
+-418, -418, -641, -336, -228, -146, -154, -344, -443, -327,
+-154, 160, 94, -575, -377, -377, -657, -657, -270, 19,
+-80, -72, 69, 234, 415, 457, 102, -88, -220, -369,
+-550, -872, -682, -311, -336, 60, 85, 217, 440, 250,
+556, 440, 250, 3, 60, 184, -6, -286, -121, -113,
+-476, -410, -476, -633, -790, -162, 110, 547, 1009, 1109,
+1307, 1232, 1232, 877, 440, -410, -1136, -1672, -2118, -2019,
+-1747, -1747, -1276, -294, 366, 490, 820, 1092, 1224, 1051,
+36, -179, -327, -509, -996, -921, -1326, -1714, -1400, -1053,
+-872, -377, 349, 803, 729, 622, 795, 795, 498, 168,
+-204, -641, -938, -1681, -1491, -1598, -1714, -1450, -740, -228,
+135, 234, 663, 1084, 894, 712, 481, 349, -113, -426,
+-600, -765, -740, -740, -616, -377, 176, 399, 589, 580,
+737, 457, 514, 349, 44, -344, -839, -1186, -1524, -1326,
+-1227, -1136, -583, 36, 102, 382, 226, 250, 201, 291,
+242, 110, -303, -336, -790, -707, -1153, -1359, -1384, -1153,
+-1053, -897, -245, 19, 226, 300, 506, 366, 374, 118,
+-14, -303, -435, -567, -666, -855, -897, -542, -426, -88,
+94, 259, 432, 556, 745, 481, 201, 184, 19, -682,
+-748, -806, -946, -369, -245, -195, -88, 36, 3, 102,
+193, 357, 432, 267, -146, -220, -72, 267, -30, -179,
+-393, -732, -831, -740, -360, -63, -47, 85, 168, 300,
+308, -47, -80, 135, 126, 19, -212, -154, -72, -72,
+-171, -410, -418, -311, -567, -641, -286, -336, -261, -261,
+-245, 36, 151, 52, -6, 94, 19, -30, -39, 184,
+415, 366, 357, 300, 349, 52, -138, -212, -212, -360,
+-781, -509, -360, -418, -154, 184, 242, 399, 316, 308,
+176, 60, 11, 69, 135, 85, 151, 168, 160, 52,
+126, 333, 300, -30, -113, -162, -195, -154, -162, -162,
+-278, -278, -204, -237, -55, -39, -220, -30, 52, -6,
+-138, -303, -608, -674, -732, -748, -699, -484, 36, 415,
+498, 688, 778, 638, 448, 275, 151, -47, -542, -889,
+-1087, -1087, -1128, -790, -575, -624, -567, -63, 193, 308,
+424, 357, 283, 118, -63, -179, -393, -492, -682, -822,
+-608, -410, -179, -162, -146, -14, 250, 308, 19, -105,
+-377, -459, -476, -616, -707, -930, -855, -831, -633, -360,
+-245, -39, 267, 325, 242, 242, 3, 52, 52, -245,
+-360, -509, -641, -600, -410, -212, -352, -303, -426, -270,
+-237, -303, -270, -228, -47, -80, -146, -63, 217, 267,
+168, -6, -96, -377, -410, -501, -418, -72, 126, 52,
+267, 366, 316, 308, 234, 60, -138, -311, -286, -360,
+-360, -294, -129, -113, -80, -14, 118, 11, 69, 94,
+52, 110, 151, 234, 291, 110, 193, -14, -567, -641,
+-690, -682, -509, -492, -666, -377, -47, -30, 36, 234,
+341, 349, 226, -105, -426, -616, -963, -946, -987, -930,
+-600, -377, -220, -47, 291, 259, 366, 193, 52, -22,
+-270, -567, -822, -724, -724, -707, -393, -352, -352, -179,
+85, 267, 250, 201, 184, 126, 110, 60, 85, -344,
+-558, -633, -724, -674, -666, -509, -311, -113, 118, 366,
+556, 514, 514, 440, 126, -228, -435, -459, -765, -790,
+-756, -624, -426, -294, -146, 3, 69, 135, 168, 226,
+209, 69, 126, 36, -228, -377, -476, -377, -418, -303,
+-344, -352, -360, -303, -212, -39, 44, 151, 135, 234,
+-129, -278, -195, -195, -286, -278, -303, -492, -261, -270,
+-138, -6, 160, 184, 193, 102, 28, 85, -138, -162,
+-212, -270, -286, -80, -96, -212, -47, -63, -96, 85,
+184, 250, 226, 234, 217, 19, -22, -129, -39, -105,
+-204, -336, -402, -369, -484, -105, 44, 3, 69, -6,
+28, -39, 28, 135, 69, 69, -80, -220, -327, -352,
+-303, -377, -327, -204, 28, -6, 151, 217, 193, 168,
+193, 193, 217, -146, -237, -476, -567, -484, -294, -402,
+-426, -336, -303, -88, -39, 3, 52, 201, 374, 160,
+3, -80, -327, -327, -575, -641, -600, -633, -633, -484,
+-336, -129, -129, -228, -228, -344, -443, -410, -369, -245,
+-179, -261, -311, -327, -319, -344, -410, -294, -245, -138,
+-138, -162, -138, -80, -171, -327, -344, -426, -492, -468,
+-402, -369, -410, -443, -270, -179, -113, -47, 60, 44,
+-47, -113, -228, -360, -360, -278, -162, 85, 151, 349,
+300, 151, 184, -63, -47, -96, -294, -237, -377, -402,
+-369, -261, -162, -113, -39, -212, 19, 60, 102, 201,
+102, 168, 102, 36, -63, -171, -228, -228, -410, -311,
+-303, -204, -162, -105, -80, 102, 291, 267, 250, 94,
+-55, -171, -352, -369, -542, -476, -492, -377, -336, -88,
+-6, 118, 143, 176, 176, -30, 28, 19, -14, -154,
+-228, -245, -393, -278, -327, -336, -369, -261, -220, -121,
+44, 85, 201, 160, 118, 44, -6, -72, -113, -179,
+-303, -352, -360, -360, -270, -360, -129, -88, -113, -96,
+-96, -129, -171, -121, -171, -171, -270, -402, -476, -616,
+-558, -666, -558, -426, -402, -294, -138, -22, 69, 36,
+85, -39, -88, -113, -162, -278, -492, -501, -542, -567,
+-426, -435, -435, -245, -154, -96, -47, -6, -105, -113,
+-270, -245, -410, -435, -410, -476, -459, -393, -393, -204,
+-129, -39, 28, 28, 28, 44, -121, -88, -129, -204,
+-253, -385, -393, -443, -360, -377, -278, -113, -96, -72,
+-63, 19, 19, -30, 28, -22, -72, -245, -426, -492,
+-534, -484, -377, -336, -261, -195, -179, -63, 3, 60,
+28, 19, 52, 60, -63, -22, -138, -146, -204, -286,
+-426, -459, -360, -303, -212, -138, -80, -105, 52, 85,
+135, 193, 151, -63, -138, -377, -369, -542, -501, -459,
+-377, -360, -303, -113, -55, 102, 135, 193, 143, 52,
+44, 19, -204, -278, -327, -402, -360, -484, -443, -418,
+-270, -228, -80, 44, 19, 69, 102, 52, -63, -129,
+-220, -377, -393, -360, -418, -352, -204, -195, -80, 52,
+102, 110, 85, 102, 94, 94, 3, -162, -253, -294,
+-311, -459, -558, -468, -476, -352, -286, -195, -96, -30,
+-72, -72, -14, -105, -154, -336, -344, -484, -426, -352,
+-451, -476, -410, -426, -327, -311, -228, -286, -237, -237,
+-278, -261, -253, -228, -393, -369, -418, -435, -550, -418,
+-286, -253, -311, -303, -162, -96, -105, -228, -245, -294,
+-294, -294, -245, -228, -212, -270, -253, -294, -360, -360,
+-344, -237, -253, -220, -195, -146, -146, -195, -105, -113,
+-113, -204, -179, -245, -270, -171, -171, -162, -162, -212,
+-212, -162, -220, -162, -179, -187, -129, -63, -47, -72,
+-47, -96, 11, -47, -129, -129, -179, -171, -105, -39,
+-63, 60, 36, -80, -129, -195, -162, -162, -121, -294,
+-220, -146, -96, -22, -63, -138, -129, -105, -138, -204,
+-179, -286, -261, -129, 28, 94, 135, 168, 102, 176,
+143, 118, 36, 3, -80, -105, -138, -138, -270, -212,
+-245, -179, -154, -72, 28, 52, 110, 36, 168, 151,
+85, 85, -30, 44, 19, 19, 85, -22, -6, 60,
+-39, -14, 69, 69, 110, 94, 94, 52, 60, 44,
+-47, -96, -146, -228, -245, -336, -245, -179, -195, -105,
+-30, 44, 102, 135, 151, 176, 184, 135, -6, -39,
+-162, -204, -171, -245, -212, -195, -129, -72, -72, -80,
+-63, -22, -88, -113, -171, -171, -179, -171, -212, -204,
+-171, -270, -179, -162, -154, -63, -14, -138, -138, -113,
+-162, -146, -237, -228, -336, -303, -369, -344, -261, -294,
+-204, -212, -179, -171, -237, -237, -336, -352, -369, -377,
+-360, -410, -393, -311, -237, -179, -113, -63, -146, -162,
+-237, -179, -319, -327, -443, -459, -435, -468, -344, -311,
+-228, -146, -162, -30, 3, -96, -47, -22, -22, -162,
+-220, -228, -146, -212, -121, -72, -154, -96, -129, 3,
+3, -105, -47, -47, -47, -14, -154, -129, -228, -195,
+-278, -228, -237, -195, -105, -162, -39, -96, -63, -138,
+-113, -113, -171, -204, -245, -162, -146, -129, -171, -72,
+-80, -39, -30, 3, -47, -105, -171, -138, -105, -195,
+-212, -237, -162, -179, -204, -72, -80, -55, -146, -88,
+-72, -105, -30, -88, -96, -88, -96, -47, -30, -6,
+-96, -138, -212, -204, -179, -171, -146, -154, -105, -113,
+-63, -138, -113, -146, -105, -154, -88, -88, -30, 19,
+-47, -63, 11, -39, -63, -179, -146, -146, -113, -63,
+-113, -72, -47, -30, 94, 19, 3, 19, 28, 28,
+-80, 11, -30, 44, -47, 3, 94, 151, 135, 176,
+28, 118, 217, 160, 176, 94, 151, 184, 126, 135,
+168, 118, 135, 193, 201, 176, 226, 226, 242, 259,
+300, 226, 300, 217, 217, 250, 176, 176, 151, 160,
+60, 19, 60, 44, 110, 168, 242, 316, 300, 366,
+448, 349, 415, 424, 333, 366, 325, 234, 242, 184,
+250, 168, 259, 250, 283, 366, 448, 457, 523, 572,
+613, 580, 514, 514, 440, 432, 424, 283, 217, 102,
+217, 184, 473, 556, 490, 547, 721, 712, 688, 597,
+646, 1199, -2861, 5713, 5004, -9083, -7523, 16383, 16383, 10458,
+-13308, -17128, 16259, 16383, -17227, -17236, -15684, -17236, -10428, -17236,
+-17236, -17211, -17236, 16383, 16383, 16383, 16383, 16383, 16383, 16383,
+16383, -17252, -17236, -17227, -17227, -17236, -17236, -17236, -17236, -17227,
+16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, 16383, -17236,
+-17236, -17227, -17244, -17227, -15825, 1364, 3609, 3708, 16383, 16383,
+16383, 16383, -4396, -3661, 15970, 11985, 448, -17252, -17236, -17236,
+-17227, -17244, -17244, -17236, -7804, 16383, 16383, 16383, 16383, 12678,
+12472, 12174, -1243, -14595, -17227, -17236, -4528, -3166, -9248, -17161,
+-9388, 6406, 8469, 14493, 11358, 8378, -1301, -1887, -17236, -17227,
+-17236, -17244, -17244, -11270, 6085, 16383, 16383, 16383, 16383, 16383,
+11424, 14378, 16383, 16383, 9971, 9699, 2478, -105, -294, -5188,
+-17227, -17236, -17236, -17227, -17244, -13266, -1367, 10846, 8139, 4541,
+3147, 11242, 15896, 16383, 12158, -4371, -15800, -16047, -4536, 2577,
+1422, -3199, 85, 193, 8577, 12158, 9204, 6126, 3419, 2536,
+2487, 1802, -509, -4808, -11344, -14669, -14694, -11278, -11253, -10618,
+-4396, 6142, 8791, 5697, 7042, 10334, 13099, 10442, 1752, 547,
+3716, 7991, 3188, -435, 9096, 4005, 2222, 3295, -245, -492,
+-1268, -6871, -5353, -4255, -7597, -5171, -1070, -1747, 4525, 5061,
+2883, 3237, 3394, 9963, 9204, 2751, 1505, 1802, -4470, -7672,
+-7762, -8340, -9792, -5914, -2448, 3039, 12158, 11787, 10392, 9773,
+9699, 5078, 2734, -955, -5254, -11641, -11781, -12887, -12384, -9471,
+-4577, -1012, 7215, 7685, 10078, 9559, 6802, 4591, 2965, -690,
+-1161, 102, 2561, -410, 886, 1141, 118, -245, -2580, 2264,
+-2316, -1417, 3072, 2709, 3898, 3708, 4046, 5614, 5820, 6555,
+3741, 1645, 2676, 2965, 1653, -261, 1043, 770, -1837, -3414,
+-47, -2135, -146, 6901, 5474, 3683, 2635, 2305, 1191, 3708,
+-5163, -6714, -8786, -9190, -5501, -6632, -3826, 4220, 5177, 6431,
+8444, 7504, 9988, 3304, -1202, -1978, -7639, -5708, -5724, -9834,
+-6384, -8315, -4198, 1554, 5713, 160, -344, 2363, -459, 2495,
+5053, 2874, -855, -1631, -2176, 4657, 7256, 4368, 2008, 877,
+2561, 6060, 1818, -1739, 1356, 1455, 770, 4987, -897, -4503,
+-8456, -1450, -550, 151, -2638, -443, 1975, 9204, 11159, 9393,
+4261, 2247, 696, -1565, -1763, -1912, -11600, -12788, -13539, -6805,
+-2341, 1958, 3840, 7429, 8494, 13833, 15566, 11737, 5565, -2976,
+-7762, -9396, -13085, -9355, -15660, -14636, -6277, -4420, 1282, -261,
+2148, 5466, 6563, 8511, 10219, 9806, 7817, 5210, 2553, -129,
+-1697, -5262, -4891, -10477, -10939, -11071, -9008, -6450, -1384, -237,
+5705, 5787, 8758, 7941, 6250, 5267, 1241, -633, -237, 85,
+-1994, -2803, 201, -2118, -2671, 952, 3072, 1488, 6266, 8279,
+4756, 4904, 8618, 3989, 2330, 1043, -2225, -8431, -13564, -17236,
+-17227, -16947, -8084, -1722, 160, 9228, 16383, 16383, 16383, 14419,
+11341, 8428, 4467, -542, -4742, -6401, -6978, -10552, -11781, -10271,
+-7309, -6327, -3768, -1631, 3221, 1620, 770, 234, -360, -1078,
+-360, -3348, -3711, -3017, -237, 3006, 4756, 6959, 7718, 5606,
+3601, 6431, 5375, 3675, 2421, 1950, 778, -30, -1425, -204,
+-1474, -2778, -4594, -4866, -1846, -435, -1227, -3216, -4173, -1260,
+-781, 2330, 3526, 1835, 2429, 2899, 3881, 6250, 6192, 4822,
+2924, 2693, -2382, -5328, -5064, -5345, -6186, -4107, -4734, -1103,
+-468, 259, 927, 2132, 176, -1639, -4313, -1161, -699, -294,
+-1062, -6153, -5130, -5699, -5328, -3381, 85, 1141, 3056, 4492,
+6406, 7966, 10400, 7842, 5548, 2858, -2588, -2712, -1846, -4651,
+-4486, -7523, -10543, -6310, -4429, -3719, -2671, -1326, 4550, 8172,
+10277, 13883, 12612, 9938, 6010, -1788, -6104, -6071, -7540, -6343,
+-5807, -4742, -2151, 1604, 4673, 7083, 5639, 3700, 6241, 5375,
+2908, 1191, 44, -1722, -9949, -10411, -10131, -12359, -9215, -2778,
+-657, 1141, 2165, 5210, 6654, 7289, 4822, 1084, 3741, 3436,
+2619, 1628, -360, -6937, -8852, -8720, -8043, -6731, -5724, -3942,
+432, 5870, 8015, 7149, 7108, 3518, 217, 514, -2135, -4313,
+-5906, -4206, -3603, -1953, -558, 2148, 5853, 6654, 7223, 6761,
+4418, 4071, 4352, 3477, -468, -3933, -8802, -7944, -7969, -6624,
+721, 2297, 2891, 6225, 6934, 4211, 4657, 4261, 3526, 531,
+-6, -4354, -2918, -831, -1491, -1664, -1582, -814, -583, -1722,
+-459, -1210, 126, -550, -270, -814, -2935, -3810, -3471, -4363,
+-4239, -2341, 1505, 3724, 3568, 3840, 5408, 3865, 3436, 2561,
+374, -3216, -3554, -2770, -2407, -864, 638, -542, -575, 910,
+-699, -435, -864, -2250, -1615, 217, 3881, 3865, -212, -204,
+291, 135, 60, 1703, 1356, 688, -732, 1835, 2908, 1711,
+-2745, -3777, -2820, -2044, -1936, -2820, -2778, -1631, 679, 1604,
+2528, 836, 1439, 2148, 3411, 4682, 3708, 3254, 3386, 1430,
+-1739, -5757, -6731, -7993, -8720, -5683, -3570, -616, 1612, 3799,
+2635, 1348, 1521, 976, -2060, -2844, -2745, -3826, -3447, -1276,
+-674, -591, 60, 1579, 3452, 2751, 2759, 2701, 3139, 1934,
+-2184, -2861, -2902, -3463, -3950, -2778, -2291, -1128, 3196, 4616,
+5730, 5771, 3733, 2066, 1092, -245, 514, -781, -146, 357,
+126, -270, -1062, 498, 316, -30, 366, 1265, 1505, -96,
+28, 638, 176, -2333, -3455, -4668, -4330, -1986, -2275, -1260,
+-1128, -2225, 1043, 1092, 151, 1043, 2627, 2701, 4649, 4071,
+2165, -22, -2102, -4288, -3166, -5823, -3702, -690, 440, 2256,
+4178, 3328, 2090, 2041, 1117, 2148, 1009, 259, -88, -2935,
+-2407, -3199, -3768, -2060, -2737, -2407, 663, 1043, 1439, 1760,
+4624, 4046, 3807, 2775, 2338, 886, -30, -831, -1012, -1359,
+-814, -3149, -3579, -1763, -2044, -1928, 762, 2825, 3147, 3039,
+3559, 2998, 1917, 2313, 1686, 943, -674, -2555, -2720, -2638,
+-2943, -2951, -3191, -2720, -1507, -1169, 1009, 3328, 3419, 2619,
+3271, 3023, 2222, 267, -2514, -2110, -3471, -3958, -3801, -3067,
+-1516, -369, 341, 663, 69, -1004, -336, 572, 663, -402,
+-822, 168, -715, -1285, -624, -344, 168, 465, 597, 1208,
+2528, 1785, 2503, 2388, 1018, 919, 1092, -1359, -1813, -2935,
+-3174, -2745, -946, 415, 1307, 1208, 861, 1868, 3328, 3254,
+1785, 366, -146, -542, -113, -121, -410, -1648, -1730, -2341,
+-2943, -1136, -212, 349, 1455, 1893, 2000, 399, 424, 28,
+-1540, -724, -1186, -377, -641, -567, 572, 1125, -228, -2852,
+-3455, -1821, -1367, -303, 894, 1307, 1835, 1736, 1364, 1257,
+1043, -492, -344, 754, 663, 481, 927, 877, 300, -468,
+-1186, -1202, -1722, -1961, -567, -575, -707, -492, -261, -311,
+-1252, -63, 366, 1117, 1810, 1653, 1199, 2140, 1587, 1175,
+382, -311, -855, -1103, -1111, -1194, -2143, -1986, 69, 531,
+-39, -63, -261, 729, 1075, 1414, 886, 514, 514, 976,
+696, 811, 333, -996, -2951, -3925, -3059, -2374, -1565, -1301,
+-913, -179, 184, 1216, 1150, 2305, 1760, 481, 85, 424,
+28, -641, 184, -905, -1532, -1672, -286, 440, 325, 325,
+589, 1538, 1084, 1397, 1166, 28, -649, -2176, -1351, -1648,
+-1813, -2027, -657, 94, 2181, 2346, 1496, 2264, 2825, 3196,
+3295, 1975, 1381, 333, -839, -724, -2093, -3315, -3694, -3901,
+-3067, -1557, -1120, 993, 910, 267, 432, -138, -1078, -1169,
+-781, -501, 52, 143, 506, 811, 572, 143, -369, -228,
+-756, -724, -55, 894, 325, -327, -641, -1062, -1351, -1194,
+-979, -1615, -1722, -880, -600, 143, 102, -212, -344, -1103,
+-72, 1372, 1414, 638, 787, 630, 589, 985, 902, 1447,
+1257, -501, -921, -715, -1194, -2118, -2852, -2267, -2143, -2357,
+-1136, 234, 1686, 2858, 2602, 2635, 1785, 1670, 1274, -63,
+-591, -1235, -1672, -1821, -2036, -1474, -707, -311, 126, -344,
+94, 498, 968, 1166, 952, 349, -1235, -1821, -1689, -1920,
+-1672, -616, -839, -1004, -880, -369, 160, 399, 770, 1274,
+1183, 696, 712, 729, 712, 811, 795, 135, -377, -1186,
+-1433, -1161, -1359, -1681, -1681, -1549, -1103, 3, -195, -402,
+-426, 160, 729, 498, 374, 886, 1208, 943, 1034, 1274,
+1224, 1084, 795, 679, 69, -113, -14, -402, -1128, -1516,
+-1780, -1194, -1012, -641, -72, -121, 94, 415, 778, 613,
+-30, -1565, -1260, -2267, -2225, -1978, -1392, -682, -187, 1183,
+1571, 1678, 1513, 1166, 787, 457, 1331, 811, 1117, 3,
+-1392, -1854, -2201, -2060, -2135, -2234, -1268, -509, 1150, 1562,
+1505, 1249, 993, 704, 861, 19, -377, -855, -1367, -1656,
+-1499, -47, 151, 44, 671, 679, 1158, 1389, 1653, 844,
+357, 283, 135, -1516, -1590, -1656, -1342, -1037, -39, 366,
+523, 828, 1826, 1736, 1075, 894, 1043, 201, -558, -822,
+-1062, -996, -1359, -1235, -1549, -1400, -831, -509, 151, 325,
+506, 1092, 646, 481, -105, -781, -1631, -2027, -2126, -1714,
+-1342, -567, 465, 968, 985, 1645, 1414, 1620, 1620, 1620,
+490, -311, -987, -1499, -1021, -1062, -1136, -872, -270, 60,
+217, 415, 457, 399, 613, 259, 69, 316, 646, 811,
+778, 498, 267, 259, 201, -105, -443, -608, -674, -410,
+-204, -286, -402, -80, 638, 927, 952, 902, 795, 902,
+1117, 1100, 754, 770, 721, 547, 242, -63, -831, -798,
+-1235, -1483, -1293, -1219, -204, -278, -154, -39, -138, 52,
+126, -294, -237, -369, -608, -707, -418, -864, -814, -996,
+-1301, -831, -905, -451, 160, 523, 803, 1422, 1653, 1496,
+754, -600, -1037, -1450, -1499, -1672, -1648, -1351, -1004, -129,
+-6, 357, 193, 193, 283, 556, 902, 564, 217, 126,
+-294, -855, -707, -740, -946, -699, -591, -294, 308, 803,
+943, 836, 778, 498, 85, -30, -369, -1103, -1565, -1458,
+-1161, -567, -237, -616, 151, 366, 316, 589, 1125, 1612,
+1208, 778, 696, 201, -418, -831, -1540, -1978, -1458, -1961,
+-1846, -1433, -930, -360, 160, 193, 704, 1199, 1595, 1356,
+1364, 1175, 201, -641, -1169, -1722, -1483, -1268, -1293, -1194,
+-790, -426, 399, 745, 481, 94, 259, 448, 176, 201,
+325, -270, -822, -897, -567, -872, -889, -501, -179, 69,
+-72, 126, 193, 151, -80, -558, 52, -146, 234, 498,
+589, 267, -63, -608, -765, -624, -1128, -1194, -1029, -451,
+-311, -113, -657, -921, -501, -657, -245, -63, -72, -492,
+85, -55, -294, -327, -138, -410, -303, -146, -336, -484,
+-286, -245, 151, 36, 184, 424, 432, 126, -39, -311,
+-608, -649, -1004, -756, -773, -724, -492, -212, 382, 787,
+613, 168, 250, 151, -80, -171, -113, -360, -624, -418,
+-410, -435, -657, -855, -864, -641, -435, 201, 729, 976,
+1018, 919, 968, 976, 704, 366, -220, -1004, -1301, -1862,
+-1920, -1714, -1194, -740, -294, 126, 498, 1051, 1290, 1340,
+1158, 1084, 333, -162, -534, -724, -880, -1021, -971, -1037,
+-641, -657, -311, 52, 391, 729, 1067, 1018, 1026, 1133,
+1059, 721, 465, -105, -567, -971, -1268, -1103, -1120, -1161,
+-724, -212, 976, 1447, 1678, 1769, 1835, 1372, 1249, 721,
+366, 19, -476, -468, -311, -435, -80, 193, 52, 217,
+754, 828, 696, 861, 803, 201, -88, -129, -624, -707,
+-1021, -1021, -1053, -773, -352, -146, 176, 481, 374, 349,
+242, 291, 448, 300, 201, -228, -484, -682, -1004, -1219,
+-1186, -1095, -699, -426, -237, 440, 778, 1018, 993, 927,
+217, -6, -377, -591, -880, -699, -567, -600, -303, 102,
+110, 349, 259, 283, -39, -171, 135, 176, -96, -253,
+-724, -765, -657, -624, -171, -138, -39, 193, 333, 432,
+457, 523, 110, -113, -138, 19, -162, -435, -699, -872,
+-872, -657, -534, -146, -105, 201, 44, -22, -88, -360,
+-426, -286, -278, -360, -509, -393, -204, -426, -476, -822,
+-855, -971, -707, -435, -162, -171, -336, -212, -162, -80,
+-105, 168, 94, -30, -212, 3, 291, 424, 143, 94,
+94, -138, -344, -558, -468, -476, -682, -765, -715, -418,
+-212, 60, 291, 374, 382, 267, 94, -278, -377, -129,
+-72, -105, -311, -96, 52, 94, -22, -212, -459, -468,
+-402, -501, -278, -509, -790, -509, -459, -459, -369, -39,
+-105, -129, -187, 36, 69, -6, -237, -600, -707, -930,
+-946, -756, -509, -261, 118, 424, 754, 729, 580, 490,
+217, 69, -303, -459, -765, -1342, -1210, -1087, -938, -666,
+-377, -377, -179, 60, 226, 382, 333, 135, 382, 325,
+-80, 19, -228, -410, -352, -657, -756, -608, -624, -443,
+28, 118, 3, 135, 151, 168, 341, 291, 3, -30,
+-327, -476, -748, -831, -608, -492, -393, -245, 19, 160,
+168, 184, 366, 506, 514, 209, 94, -113, -212, -237,
+-393, -426, -402, -286, -393, -303, -245, -443, -393, -245,
+-47, -22, 11, 3, 316, 382, 267, 176, 234, 110,
+-88, -171, -402, -360, -484, -278, 193, 184, 432, 457,
+465, 415, 283, 126, -80, -393, -492, -410, -426, -270,
+-179, -80, -39, 44, -63, -195, -171, -171, -6, 52,
+-22, -195, -63, -294, -369, -550, -773, -872, -765, -707,
+-880, -558, -476, -96, 226, 250, 316, 457, 415, 291,
+126, -146, -476, -641, -855, -872, -666, -360, -212, -88,
+151, 357, 382, 374, 259, 126, -245, -476, -567, -600,
+-558, -657, -624, -567, -443, -138, -22, 151, 234, 349,
+490, 399, 267, 300, 151, 201, 110, -55, -179, -509,
+-509, -476, -352, -410, -105, 126, 349, 547, 770, 952,
+976, 721, 283, -162, -426, -501, -550, -550, -699, -476,
+-327, -129, 36, 94, 193, 217, 242, 143, -30, -195,
+-220, -377, -410, -459, -418, -402, -443, -369, -228, -171,
+-179, -72, 19, 19, 60, 19, 52, -113, -261, -311,
+-418, -393, -360, -393, -459, -377, -327, -195, -146, -228,
+-63, -129, -212, -303, -278, -311, -286, -286, -501, -484,
+-410, -360, -294, -171, -138, -113, -154, -30, -14, -113,
+-129, -129, -311, -360, -459, -484, -443, -501, -501, -352,
+-344, -195, -162, -88, -129, 94, 19, -39, -39, -146,
+-237, -360, -410, -377, -377, -327, -261, -220, -121, 52,
+102, 44, 19, -204, -212, -80, -72, -583, -674, -616,
+-492, -459, -426, -393, -261, -72, 94, 151, 250, 267,
+267, 291, 168, -80, -261, -336, -418, -418, -369, -435,
+-369, -195, -146, -63, 19, -22, -212, -146, -129, -72,
+-105, -204, -154, -55, 3, -204, -138, -212, -253, -303,
+-311, -129, 11, 36, 19, 3, 60, 19, 36, -96,
+-96, -212, -286, -278, -228, -294, -154, -286, -96, 69,
+151, 193, 193, 217, 11, 44, -6, -138, -286, -402,
+-245, -220, -138, 52, 160, 201, 151, 118, -14, -360,
+-426, -369, -501, -484, -369, -245, -286, -204, -80, -113,
+-113, -96, 193, 102, 110, 69, -22, -47, -270, -270,
+-377, -459, -426, -443, -443, -369, -220, -303, -270, -113,
+-105, 60, 135, 77, -22, -270, -377, -567, -666, -690,
+-641, -459, -311, -237, -113, -30, 110, 176, 135, 28,
+-72, -72, 28, -96, -105, -270, -443, -468, -575, -484,
+-377, -253, -253, -129, -30, 69, 126, 168, 60, 135,
+102, 3, -88, -278, -377, -369, -402, -468, -327, -237,
+};
 
+static const struct Plantilla_almacenada almacen[] = {
+    {"tres aplausos", plantilla_tres_aplausos_q14, PLANTILLA_MUESTRAS},
+    {"dos aplausos", plantilla_dos_aplausos_q14, PLANTILLA_MUESTRAS},
 };
+
+int almacen_cantidad(void)
+{
+    return (int)(sizeof(almacen) / sizeof(almacen[0]));
+}
+
+const struct Plantilla_almacenada *almacen_plantilla(int indice)
+{
+    if ((indice < 0) || (indice >= almacen_cantidad()))
+    {
+        return NULL;
+    }
+    return &almacen[indice];
+}
+
+void plantilla_decodificar(const struct Plantilla_almacenada *p, float *destino)
+{
+    for (int i = 0; i < p->num_muestras; i++)
+    {
+        destino[i] = plantilla_muestra(p, i);
+    }
+}
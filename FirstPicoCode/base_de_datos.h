@@ -3,30 +3,77 @@
 
 /**
  * @file base_de_datos.h
- * @brief Declaración de arrays de datos para el análisis de señales.
+ * @brief Almacén de las señales de referencia (plantillas) para el análisis de señales.
  *
- * Este archivo contiene las declaraciones externas de los arrays que almacenan los datos de las señales
- * de tres aplausos y dos aplausos, utilizados en el análisis de señales.
- * Los datos de estas señales se procesan en funciones de análisis como FFT y DTW, las cuales sirven como
- * comparacion para las muestras capturadas por el adc.
+ * Las señales de tres aplausos y dos aplausos se guardan como constantes cuantizadas en Q14 (int16),
+ * de modo que el enlazador las deja en la flash: no ocupan RAM ni se copian en el arranque. Los datos
+ * se procesan en funciones de análisis como FFT y DTW, las cuales sirven como comparacion para las
+ * muestras capturadas por el adc, y se leen únicamente a través de las funciones de este archivo.
  */
 
-/** 
- * @extern float Datos_tres_aplausos_1[5120]; 
- * @brief Array que contiene los datos de la señal de tres aplausos.
- * 
- * Este array almacena los 5120 datos correspondientes a la señal de tres aplausos,
- * que se utilizan para análisis en el dominio del tiempo y la frecuencia.
+#include <stdint.h>        /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include <stddef.h>        /**< Definición de NULL */
+
+/**
+ * @def PLANTILLA_Q
+ * @brief Bits fraccionarios de las muestras almacenadas (las señales normalizadas llegan a +-1.06).
+ */
+#define PLANTILLA_Q 14
+
+/**
+ * @def PLANTILLA_MUESTRAS
+ * @brief Muestras de cada señal de referencia, grabadas a 8 kHz.
+ */
+#define PLANTILLA_MUESTRAS 5120
+
+/**
+ * @brief Señal de referencia almacenada en flash.
+ */
+struct Plantilla_almacenada
+{
+    const char *etiqueta;    /**< Nombre del patrón. */
+    const int16_t *muestras; /**< Muestras normalizadas en Q14. */
+    int num_muestras;        /**< Cantidad de muestras. */
+};
+
+/**
+ * @brief Índices de las señales del almacén.
  */
-extern float Datos_tres_aplausos_1[];  // Declarar como externo
+enum
+{
+    PLANTILLA_TRES_APLAUSOS = 0, /**< Señal de tres aplausos. */
+    PLANTILLA_DOS_APLAUSOS = 1   /**< Señal de dos aplausos. */
+};
 
-/** 
- * @extern float Datos_dos_aplausos_1[5120]; 
- * @brief Array que contiene los datos de la señal de dos aplausos.
- * 
- * Este array almacena los 5120 datos correspondientes a la señal de dos aplausos,
- * utilizados para análisis y comparación con otras señales, capturadas por el adc.
+/**
+ * @brief Cantidad de señales en el almacén.
+ * @return Número de plantillas almacenadas.
+ */
+int almacen_cantidad(void);
+
+/**
+ * @brief Devuelve una señal del almacén.
+ * @param indice Índice de la señal (por ejemplo, PLANTILLA_TRES_APLAUSOS).
+ * @return Descriptor de la señal, o NULL si el índice no existe.
+ */
+const struct Plantilla_almacenada *almacen_plantilla(int indice);
+
+/**
+ * @brief Lee una muestra de una señal almacenada, ya convertida a punto flotante.
+ * @param p Señal del almacén.
+ * @param i Índice de la muestra.
+ * @return Muestra normalizada.
+ */
+static inline float plantilla_muestra(const struct Plantilla_almacenada *p, int i)
+{
+    return p->muestras[i] * (1.0f / (1 << PLANTILLA_Q));
+}
+
+/**
+ * @brief Decodifica una señal completa a punto flotante.
+ * @param p Señal del almacén.
+ * @param destino Buffer de al menos p->num_muestras muestras.
  */
-extern float Datos_dos_aplausos_1[];
+void plantilla_decodificar(const struct Plantilla_almacenada *p, float *destino);
 
-#endif // BASE_DE_DATOS_H
\ No newline at end of file
+#endif // BASE_DE_DATOS_H
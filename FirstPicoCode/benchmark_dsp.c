@@ -0,0 +1,500 @@
+#include "benchmark_dsp.h"
+#include "measure_libs.h"
+#include "base_de_datos.h"
+#include "precision_matematica.h"
+#include "hardware/clocks.h"
+
+#define FS_BENCHMARK 8000 /**< Frecuencia de muestreo de las señales de referencia. */
+
+// Muestra i de una señal del almacén, con ceros después de su final (DSP_MUESTRAS puede superar PLANTILLA_MUESTRAS)
+static float muestra_referencia(const struct Plantilla_almacenada *p, int i)
+{
+    return (i < p->num_muestras) ? plantilla_muestra(p, i) : 0.0f;
+}
+
+// Decodifica las SAMPLES muestras de una captura a partir de una señal del almacén, recortada o completada con ceros
+static void decodificar_referencia(const struct Plantilla_almacenada *p, float *destino)
+{
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        destino[i] = muestra_referencia(p, i);
+    }
+}
+
+void benchmark_fft(void)
+{
+    const int N = TAMANO_VENTANA;
+    const int num_ventanas = SAMPLES / TAMANO_VENTANA;
+    float real_ref[TAMANO_VENTANA], imag_ref[TAMANO_VENTANA];
+    float real_q15[TAMANO_VENTANA], imag_q15[TAMANO_VENTANA];
+    float error_max = 0.0f, pico_max = 0.0f;
+    uint64_t tiempo_float = 0, tiempo_q15 = 0;
+    const struct Plantilla_almacenada *tres = almacen_plantilla(PLANTILLA_TRES_APLAUSOS);
+
+    for (int v = 0; v < num_ventanas; v++)
+    {
+        for (int j = 0; j < N; j++)
+        {
+            real_ref[j] = real_q15[j] = muestra_referencia(tres, v * N + j);
+            imag_ref[j] = imag_q15[j] = 0.0f;
+        }
+
+        uint64_t inicio = time_us_64();
+        fft_float(N, real_ref, imag_ref);
+        tiempo_float += time_us_64() - inicio;
+
+        inicio = time_us_64();
+        fft(N, real_q15, imag_q15);
+        tiempo_q15 += time_us_64() - inicio;
+
+        for (int j = 0; j < N; j++)
+        {
+            float error = hypotf(real_q15[j] - real_ref[j], imag_q15[j] - imag_ref[j]);
+            error_max = fmaxf(error_max, error);
+            pico_max = fmaxf(pico_max, hypotf(real_ref[j], imag_ref[j]));
+        }
+    }
+
+    printf("FFT %d puntos, %d ventanas\n", N, num_ventanas);
+    printf("Error maximo Q15 vs float: %.6f (relativo al pico: %.6f)\n", error_max, error_max / pico_max);
+    printf("Tiempo por ventana float: %.1f us, Q15 (FFT_USAR_Q15=%d): %.1f us\n",
+           (float)tiempo_float / num_ventanas, FFT_USAR_Q15, (float)tiempo_q15 / num_ventanas);
+}
+
+#define FFT_BARRIDO_MAX ((FFT_TABLAS_MAX_SIZE < 1024) ? FFT_TABLAS_MAX_SIZE : 1024) /**< Mayor tamaño del barrido. */
+#define FFT_BARRIDO_PUNTOS 8192 /**< Puntos transformados por tamaño y por núcleo (varias FFT de N puntos). */
+#define FFT_BARRIDO_TOLERANCIA 1e-5f /**< Diferencia admitida entre las FFT float, relativa al bin de mayor magnitud. */
+
+// Diferencia máxima entre dos espectros float, relativa al bin de mayor magnitud del primero
+static float diferencia_espectros(int N, const float a_real[], const float a_imag[], const float b_real[],
+                                  const float b_imag[])
+{
+    float pico = 0.0f, diferencia = 0.0f;
+    for (int k = 0; k < N; k++)
+    {
+        pico = fmaxf(pico, fabsf(a_real[k]) + fabsf(a_imag[k]));
+        diferencia = fmaxf(diferencia, fabsf(a_real[k] - b_real[k]) + fabsf(a_imag[k] - b_imag[k]));
+    }
+    return (pico > 0.0f) ? diferencia / pico : diferencia;
+}
+
+void benchmark_fft_tamanos(void)
+{
+    static int16_t muestras[FFT_BARRIDO_MAX];
+    static int16_t q15_real[FFT_BARRIDO_MAX], q15_imag[FFT_BARRIDO_MAX];
+    static int16_t ref_real[FFT_BARRIDO_MAX], ref_imag[FFT_BARRIDO_MAX];
+    static float f_real[FFT_BARRIDO_MAX], f_imag[FFT_BARRIDO_MAX];
+    static float f_ref_real[FFT_BARRIDO_MAX], f_ref_imag[FFT_BARRIDO_MAX];
+    const struct Plantilla_almacenada *tres = almacen_plantilla(PLANTILLA_TRES_APLAUSOS);
+    float ciclos_por_us = clock_get_hz(clk_sys) / 1e6f;
+
+    for (int N = 16; N <= FFT_BARRIDO_MAX; N *= 2)
+    {
+        int repeticiones = FFT_BARRIDO_PUNTOS / N;
+        uint64_t tiempo[4] = {0, 0, 0, 0}; // Q15 especializada, Q15 genérica, float especializada, float genérica
+        int diferencias = 0;
+        int diferencias_float = 0;
+
+        for (int r = 0; r < repeticiones; r++)
+        {
+            // Cada repetición transforma otro tramo de la señal; cada núcleo recibe su propia copia, porque
+            // todos transforman en su lugar
+            for (int j = 0; j < N; j++)
+            {
+                float x = plantilla_muestra(tres, (r * N + j) % tres->num_muestras);
+                muestras[j] = (int16_t)lrintf(x * 16384.0f);
+                q15_real[j] = ref_real[j] = muestras[j];
+                q15_imag[j] = ref_imag[j] = 0;
+                f_real[j] = f_ref_real[j] = muestras[j];
+                f_imag[j] = f_ref_imag[j] = 0.0f;
+            }
+
+            uint64_t inicio = time_us_64();
+            int exponente = fft_q15(N, q15_real, q15_imag);
+            tiempo[0] += time_us_64() - inicio;
+
+            inicio = time_us_64();
+            int exponente_ref = fft_q15_generica(N, ref_real, ref_imag);
+            tiempo[1] += time_us_64() - inicio;
+
+            // Ambos caminos compilan el mismo núcleo: el resultado debe coincidir bit a bit
+            diferencias += (exponente != exponente_ref) || memcmp(q15_real, ref_real, N * sizeof(int16_t)) ||
+                           memcmp(q15_imag, ref_imag, N * sizeof(int16_t));
+
+            inicio = time_us_64();
+            fft_float(N, f_real, f_imag);
+            tiempo[2] += time_us_64() - inicio;
+
+            inicio = time_us_64();
+            fft_float_generica(N, f_ref_real, f_ref_imag);
+            tiempo[3] += time_us_64() - inicio;
+
+            // En float el compilador puede contraer o reordenar distinto cada variante: se compara con tolerancia
+            diferencias_float += diferencia_espectros(N, f_ref_real, f_ref_imag, f_real, f_imag) >
+                                 FFT_BARRIDO_TOLERANCIA;
+        }
+
+        printf("FFT %4d puntos: Q15 %.0f / %.0f ciclos, float %.0f / %.0f ciclos (especializada / generica), "
+               "diferencias Q15 %d, float %d\n", N, ciclos_por_us * tiempo[0] / repeticiones,
+               ciclos_por_us * tiempo[1] / repeticiones, ciclos_por_us * tiempo[2] / repeticiones,
+               ciclos_por_us * tiempo[3] / repeticiones, diferencias, diferencias_float);
+    }
+}
+
+void benchmark_dtw(void)
+{
+    static struct Caracteristicas tres, dos;
+    static float senal[SAMPLES];
+    struct Dtw_estadisticas est;
+    decodificar_referencia(almacen_plantilla(PLANTILLA_TRES_APLAUSOS), senal);
+    extraer_caracteristicas(senal, FS_BENCHMARK, &tres);
+    decodificar_referencia(almacen_plantilla(PLANTILLA_DOS_APLAUSOS), senal);
+    extraer_caracteristicas(senal, FS_BENCHMARK, &dos);
+
+    uint64_t inicio = time_us_64();
+    float d_completa = dtw(tres.amplitudes, tres.num_ventanas, dos.amplitudes, dos.num_ventanas);
+    uint64_t tiempo_completa = time_us_64() - inicio;
+
+    printf("DTW completo: distancia %.4f, celdas %d, memoria %u bytes, %llu us\n", d_completa,
+           tres.num_ventanas * dos.num_ventanas, (unsigned)(sizeof(float) * MAX_SIZE * MAX_SIZE),
+           (unsigned long long)tiempo_completa);
+
+    // Sin umbral: costo de la banda sola; con umbral: abandono temprano
+    const float umbrales[] = {0.0f, 4.0f};
+    for (int u = 0; u < 2; u++)
+    {
+        inicio = time_us_64();
+        float d_banda = dtw_banda(tres.amplitudes, tres.num_ventanas, dos.amplitudes, dos.num_ventanas,
+                                  DTW_BANDA, umbrales[u], &est);
+        uint64_t tiempo_banda = time_us_64() - inicio;
+
+        printf("DTW banda %d, umbral %.1f: distancia %.4f%s, celdas %d, memoria %d bytes, %llu us\n",
+               DTW_BANDA, umbrales[u], est.abandonado ? 0.0f : d_banda, est.abandonado ? " (abandonado)" : "",
+               est.celdas_evaluadas, est.bytes_memoria, (unsigned long long)tiempo_banda);
+    }
+
+    // DTW entero (características Q DTW_Q, costos uint32) contra el flotante, sin umbral
+    static struct Dtw_conjunto conjunto;
+    static uint16_t tres_q[NUM_VENTANAS], dos_q[NUM_VENTANAS], consulta_q[NUM_VENTANAS];
+    struct Dtw_candidato cand[2];
+    uint32_t costo;
+    dtw_cuantizar_secuencia(tres.amplitudes, tres.num_ventanas, tres_q);
+    dtw_cuantizar_secuencia(dos.amplitudes, dos.num_ventanas, dos_q);
+
+    cand[0].plantilla = tres_q;
+    cand[0].m = tres.num_ventanas;
+    cand[0].desplazamiento = 0;
+    cand[0].largo = dos.num_ventanas;
+    cand[0].final_abierto = 0;
+    cand[0].fin_min = cand[0].m;
+    cand[0].limite = DTW_INF_ENTERO;
+
+    inicio = time_us_64();
+    float d_flotante = dtw_banda(tres.amplitudes, tres.num_ventanas, dos.amplitudes, dos.num_ventanas, DTW_BANDA,
+                                 0.0f, NULL);
+    uint64_t tiempo_flotante = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    dtw_banda_conjunto(&conjunto, dos_q, dos.num_ventanas, dos_q[0], cand, 1, DTW_BANDA, &costo, &est);
+    uint64_t tiempo_entero = time_us_64() - inicio;
+
+    // El costo crudo debe coincidir bit a bit con COSTO_TRES_DOS de tools/host/prueba_dtw_entero.c
+    printf("DTW banda %d float: distancia %.4f, %llu us; entero: distancia %.4f (costo 0x%08lx), celdas %d, %llu us\n",
+           DTW_BANDA, d_flotante, (unsigned long long)tiempo_flotante, dtw_distancia_entero(costo),
+           (unsigned long)costo, est.celdas_evaluadas, (unsigned long long)tiempo_entero);
+
+    // Una consulta (tres aplausos más suaves) contra las dos plantillas: una llamada por plantilla,
+    // abandonando contra el mejor costo, frente a un único recorrido conjunto
+    const uint16_t *referencias[2] = {tres_q, dos_q};
+    const uint32_t limites[2] = {dtw_limite_entero(4.0f), dtw_limite_entero(3.3f)};
+    for (int i = 0; i < tres.num_ventanas; i++)
+    {
+        consulta_q[i] = dtw_cuantizar(0.8f * tres.amplitudes[i]);
+    }
+    for (int k = 0; k < 2; k++)
+    {
+        cand[k].plantilla = referencias[k];
+        cand[k].m = NUM_VENTANAS;
+        cand[k].desplazamiento = 0;
+        cand[k].largo = tres.num_ventanas;
+        cand[k].final_abierto = 0;
+        cand[k].fin_min = cand[k].m;
+        cand[k].limite = limites[k];
+    }
+
+    inicio = time_us_64();
+    int mejor_separado = -1;
+    uint32_t costo_separado = DTW_INF_ENTERO;
+    for (int k = 0; k < 2; k++)
+    {
+        struct Dtw_candidato uno = cand[k];
+        uno.limite = (costo_separado < uno.limite) ? costo_separado : uno.limite;
+        if (dtw_banda_conjunto(&conjunto, consulta_q, tres.num_ventanas, consulta_q[0], &uno, 1, DTW_BANDA, &costo,
+                               NULL) >= 0)
+        {
+            mejor_separado = k;
+            costo_separado = costo;
+        }
+    }
+    uint64_t tiempo_separado = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    int mejor_conjunto = dtw_banda_conjunto(&conjunto, consulta_q, tres.num_ventanas, consulta_q[0], cand, 2,
+                                            DTW_BANDA, &costo, &est);
+    uint64_t tiempo_conjunto = time_us_64() - inicio;
+
+    printf("DTW 2 plantillas por separado: plantilla %d, distancia %.4f, %llu us\n", mejor_separado,
+           dtw_distancia_entero(costo_separado), (unsigned long long)tiempo_separado);
+    printf("DTW 2 plantillas conjunto: plantilla %d, distancia %.4f, celdas %d, abandonadas %d, %llu us\n",
+           mejor_conjunto, dtw_distancia_entero(costo), est.celdas_evaluadas, est.abandonado,
+           (unsigned long long)tiempo_conjunto);
+}
+
+typedef float (*extractor_ventana_t)(const float *ventana);
+
+static float ventana_fft(const float *ventana)
+{
+    return amplitud_promedio_ventana(TAMANO_VENTANA, ventana);
+}
+
+// Características de una señal con un extractor dado; acumula el tiempo en *tiempo_us
+static void extraer_con(extractor_ventana_t extractor, const float *senal, struct Caracteristicas *caract,
+                        uint64_t *tiempo_us)
+{
+    uint64_t inicio = time_us_64();
+    for (int i = 0; i < NUM_VENTANAS; i++)
+    {
+        caract->amplitudes[i] = extractor(&senal[i * SALTO_VENTANA]);
+    }
+    *tiempo_us += time_us_64() - inicio;
+    caract->num_ventanas = NUM_VENTANAS;
+}
+
+void benchmark_goertzel(void)
+{
+    static struct Caracteristicas plantillas[2], consulta;
+    static float variante[SAMPLES];
+    const struct Plantilla_almacenada *senales[2] = {almacen_plantilla(PLANTILLA_TRES_APLAUSOS),
+                                                     almacen_plantilla(PLANTILLA_DOS_APLAUSOS)};
+    const extractor_ventana_t extractores[2] = {ventana_fft, energia_bandas_goertzel};
+    const char *nombres[2] = {"FFT completa", "Goertzel"};
+    const float ganancias[] = {1.0f, 0.7f, 0.4f};
+    const int desplazamientos[] = {0, 3 * TAMANO_VENTANA, -3 * TAMANO_VENTANA};
+    const float ruidos[] = {0.0f, 0.05f};
+    float ciclos_por_us = clock_get_hz(clk_sys) / 1e6f;
+
+    for (int e = 0; e < 2; e++)
+    {
+        uint64_t tiempo = 0;
+        int correctas = 0, total = 0;
+        float margen = 0.0f;
+        uint32_t semilla = 12345;
+
+        for (int p = 0; p < 2; p++)
+        {
+            decodificar_referencia(senales[p], variante);
+            extraer_con(extractores[e], variante, &plantillas[p], &tiempo);
+        }
+
+        for (int p = 0; p < 2; p++)
+        {
+            for (int g = 0; g < 3; g++)
+            {
+                for (int d = 0; d < 3; d++)
+                {
+                    for (int r = 0; r < 2; r++)
+                    {
+                        // Variante: ganancia, desplazamiento temporal (con ceros) y ruido uniforme
+                        for (int i = 0; i < SAMPLES; i++)
+                        {
+                            int j = i - desplazamientos[d];
+                            semilla = semilla * 1664525u + 1013904223u;
+                            float ruido = ruidos[r] * ((float)(semilla >> 8) / (float)(1u << 23) - 1.0f);
+                            variante[i] = (j >= 0 ? ganancias[g] * muestra_referencia(senales[p], j) : 0.0f) + ruido;
+                        }
+                        extraer_con(extractores[e], variante, &consulta, &tiempo);
+
+                        float dist[2];
+                        for (int q = 0; q < 2; q++)
+                        {
+                            dist[q] = dtw_banda(consulta.amplitudes, consulta.num_ventanas, plantillas[q].amplitudes,
+                                                plantillas[q].num_ventanas, DTW_BANDA, 0.0f, NULL);
+                        }
+                        correctas += dist[p] < dist[1 - p];
+                        margen += (dist[1 - p] - dist[p]) / fmaxf(dist[1 - p] + dist[p], 1e-6f);
+                        total++;
+                    }
+                }
+            }
+        }
+
+        int ventanas = (total + 2) * NUM_VENTANAS;
+        printf("%s: %.1f us (%.0f ciclos) por ventana, aciertos %d/%d, margen DTW promedio %.3f\n", nombres[e],
+               (float)tiempo / ventanas, ciclos_por_us * tiempo / ventanas, correctas, total, margen / total);
+    }
+}
+
+void benchmark_sdft(void)
+{
+    static struct Sdft sdft;
+    static int16_t codigos[SAMPLES];
+    const float escala = 2048.0f; // Muestras normalizadas llevadas al rango de un ADC de 12 bits
+    float real[TAMANO_VENTANA / 2 + 1], imag[TAMANO_VENTANA / 2 + 1];
+    float error_max = 0.0f, pico_max = 0.0f;
+    uint64_t tiempo_sdft = 0, tiempo_fft = 0;
+    int comparaciones = 0;
+    const struct Plantilla_almacenada *tres = almacen_plantilla(PLANTILLA_TRES_APLAUSOS);
+
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        codigos[i] = (int16_t)lrintf(muestra_referencia(tres, i) * escala);
+    }
+
+    sdft_iniciar(&sdft);
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        uint64_t inicio = time_us_64();
+        sdft_agregar(&sdft, codigos[i]);
+        tiempo_sdft += time_us_64() - inicio;
+
+        // Comparar contra la FFT de la ventana que termina aquí (en una de cada 7 muestras, para acotar la duración)
+        if ((i >= TAMANO_VENTANA - 1) && (i % 7 == 0))
+        {
+            float ventana[TAMANO_VENTANA];
+            for (int j = 0; j < TAMANO_VENTANA; j++)
+            {
+                ventana[j] = codigos[i - TAMANO_VENTANA + 1 + j] / escala;
+            }
+
+            inicio = time_us_64();
+            rfft(TAMANO_VENTANA, ventana, real, imag);
+            float referencia = 0.0f;
+            for (int b = 0; b < GOERTZEL_NUM_BANDAS; b++)
+            {
+                referencia += hypotf(real[goertzel_bins[b]], imag[goertzel_bins[b]]);
+            }
+            referencia /= GOERTZEL_NUM_BANDAS;
+            tiempo_fft += time_us_64() - inicio;
+
+            error_max = fmaxf(error_max, fabsf(sdft_amplitud(&sdft) / escala - referencia));
+            pico_max = fmaxf(pico_max, referencia);
+            comparaciones++;
+        }
+    }
+
+    printf("DFT deslizante %d puntos, %d bins: error maximo %.6f (relativo al pico: %.6f)\n", SDFT_TAMANO,
+           GOERTZEL_NUM_BANDAS, error_max, error_max / pico_max);
+    printf("Tiempo por muestra SDFT: %.2f us, FFT real con salto 1: %.2f us\n", (float)tiempo_sdft / SAMPLES,
+           (float)tiempo_fft / comparaciones);
+}
+
+// Imprime el tiempo por llamada de la variante exacta y de la aproximada
+static void imprimir_tiempos(const char *nombre, uint64_t tiempo_exacto, uint64_t tiempo_aprox, float ciclos_por_us)
+{
+    printf("%s: exacta %.0f ciclos, aproximada %.0f ciclos por llamada\n", nombre,
+           ciclos_por_us * tiempo_exacto / PRECISION_PUNTOS, ciclos_por_us * tiempo_aprox / PRECISION_PUNTOS);
+}
+
+void benchmark_matematica(void)
+{
+    static float a[PRECISION_PUNTOS], b[PRECISION_PUNTOS];
+    static uint32_t enteros[PRECISION_PUNTOS];
+    volatile float sumidero = 0.0f; // Impide que el compilador descarte los bucles cronometrados
+    volatile uint32_t sumidero_entero = 0;
+    float ciclos_por_us = clock_get_hz(clk_sys) / 1e6f;
+    uint64_t inicio, tiempo_exacto, tiempo_aprox;
+    struct Precision_matematica precision;
+
+    printf("MATEMATICA_APROXIMADA=%d, tablas de log2/exp2 de %d intervalos\n", MATEMATICA_APROXIMADA,
+           APROX_TABLA_TAMANO);
+
+    medir_precision_matematica(&precision);
+    printf("Magnitud alfa-max-beta-min: error relativo maximo %.4f (entera %.4f)\n", precision.error_magnitud,
+           precision.error_magnitud_entera);
+    printf("Raiz entera: %d resultados distintos de floor(sqrt(x)) en %d\n", precision.errores_raiz, PRECISION_PUNTOS);
+    printf("log2 por tabla: error absoluto maximo %.2e; exp2 por tabla: error relativo maximo %.2e\n",
+           precision.error_log2, precision.error_exp2);
+    printf("Cotas documentadas: %s\n", precision_matematica_aceptable(&precision) ? "cumplidas" : "EXCEDIDAS");
+
+    // Mismos argumentos que la medición de exactitud, solo para cronometrar
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        float angulo = 6.28318531f * i / PRECISION_PUNTOS;
+        float radio = 1.0f + (float)(i % 97) * 300.0f;
+        a[i] = radio * cosf(angulo);
+        b[i] = radio * sinf(angulo);
+        uint32_t k = (uint32_t)i * 16u + 65000u * (i & 1);
+        enteros[i] = k * k - (uint32_t)(i & 1);
+    }
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += sqrtf(a[i] * a[i] + b[i] * b[i]);
+    }
+    tiempo_exacto = time_us_64() - inicio;
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += magnitud_alfa_beta(a[i], b[i]);
+    }
+    tiempo_aprox = time_us_64() - inicio;
+    imprimir_tiempos("Magnitud", tiempo_exacto, tiempo_aprox, ciclos_por_us);
+
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += sqrtf((float)enteros[i]);
+    }
+    tiempo_exacto = time_us_64() - inicio;
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero_entero += raiz_entera(enteros[i]);
+    }
+    tiempo_aprox = time_us_64() - inicio;
+    imprimir_tiempos("Raiz (sqrtf / entera)", tiempo_exacto, tiempo_aprox, ciclos_por_us);
+
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        a[i] = exp2f(-20.0f + 40.0f * i / PRECISION_PUNTOS + 0.37f);
+        b[i] = -20.0f + 40.0f * i / PRECISION_PUNTOS + 0.013f;
+    }
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += logf(a[i]);
+    }
+    tiempo_exacto = time_us_64() - inicio;
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += log_aprox(a[i]);
+    }
+    tiempo_aprox = time_us_64() - inicio;
+    imprimir_tiempos("Logaritmo (logf / log_aprox)", tiempo_exacto, tiempo_aprox, ciclos_por_us);
+
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += expf(b[i]);
+    }
+    tiempo_exacto = time_us_64() - inicio;
+    inicio = time_us_64();
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        sumidero += exp_aprox(b[i]);
+    }
+    tiempo_aprox = time_us_64() - inicio;
+    imprimir_tiempos("Exponencial (expf / exp_aprox)", tiempo_exacto, tiempo_aprox, ciclos_por_us);
+}
+
+void benchmark_dsp_ejecutar(void)
+{
+    printf("=== Benchmark DSP ===\n");
+    benchmark_fft();
+    benchmark_fft_tamanos();
+    benchmark_dtw();
+    benchmark_goertzel();
+    benchmark_sdft();
+    benchmark_matematica();
+}
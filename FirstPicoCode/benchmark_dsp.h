@@ -0,0 +1,80 @@
+#ifndef BENCHMARKDSP_H
+#define BENCHMARKDSP_H
+
+/**
+ * @file benchmark_dsp.h
+ * @brief Rutinas de medición de exactitud y tiempo para los núcleos DSP del reconocedor de aplausos.
+ *
+ * Se ejecutan en la propia Raspberry Pi Pico al arrancar cuando el firmware se compila con
+ * DSP_BENCHMARK=1 (opción de CMake del mismo nombre). Los resultados se imprimen por la salida serial.
+ */
+
+#include "pico/stdlib.h" /**< Librería principal del SDK de Raspberry Pi Pico */
+#include <stdint.h>      /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include <stdio.h>       /**< Funciones para entrada y salida estándar */
+
+/**
+ * @def DSP_BENCHMARK
+ * @brief Habilita (1) la ejecución de los benchmarks al iniciar el programa.
+ */
+#ifndef DSP_BENCHMARK
+#define DSP_BENCHMARK 0
+#endif
+
+/**
+ * @brief Compara fft_q15() contra fft_float() sobre las ventanas de las señales de referencia.
+ *
+ * Imprime el error máximo relativo al pico del espectro y el tiempo promedio por ventana de cada motor.
+ */
+void benchmark_fft(void);
+
+/**
+ * @brief Mide las instancias especializadas de la FFT contra el núcleo genérico, de 16 a min(FFT_TABLAS_MAX_SIZE, 1024) puntos.
+ *
+ * Imprime los ciclos por FFT de fft_q15() y fft_float() frente a fft_q15_generica() y fft_float_generica()
+ * y la cantidad de transformadas Q15 en las que ambos caminos no coinciden bit a bit (debe ser 0).
+ */
+void benchmark_fft_tamanos(void);
+
+/**
+ * @brief Compara dtw() contra dtw_banda() entre las plantillas de tres y dos aplausos.
+ *
+ * Imprime la distancia, las celdas evaluadas, la memoria de pila de la matriz/filas y el tiempo,
+ * sin umbral y con el umbral de decisión de tres aplausos. Luego compara dtw_banda() contra el DTW entero
+ * (con el costo crudo, para verificar que coincide bit a bit con el host) y clasifica una variante atenuada
+ * de tres aplausos contra ambas plantillas con una llamada por plantilla y con un único dtw_banda_conjunto().
+ */
+void benchmark_dtw(void);
+
+/**
+ * @brief Compara el extractor de Goertzel contra la amplitud promedio de la FFT.
+ *
+ * Imprime el tiempo y los ciclos por ventana de cada extractor y la exactitud de clasificación por
+ * vecino más cercano (DTW con banda) sobre variantes de las plantillas con ganancia, desplazamiento
+ * y ruido distintos, junto con el margen normalizado promedio (d_incorrecta - d_correcta) / (d_incorrecta + d_correcta).
+ */
+void benchmark_goertzel(void);
+
+/**
+ * @brief Compara la DFT deslizante contra la FFT real recalculada en cada muestra (salto 1).
+ *
+ * Imprime el error máximo de la amplitud de los bins seguidos respecto a la FFT real de la misma
+ * ventana y el tiempo por muestra de ambos caminos.
+ */
+void benchmark_sdft(void);
+
+/**
+ * @brief Exactitud y costo de los núcleos de matematica_aproximada.h frente a la libm.
+ *
+ * Imprime los errores medidos por medir_precision_matematica(), si cumplen las cotas documentadas y los
+ * ciclos por llamada de cada variante exacta y aproximada. Solo corre en la placa; la exactitud sola se
+ * comprueba en el host con el arnés de tools/host.
+ */
+void benchmark_matematica(void);
+
+/**
+ * @brief Ejecuta todos los benchmarks disponibles.
+ */
+void benchmark_dsp_ejecutar(void);
+
+#endif // BENCHMARKDSP_H
@@ -0,0 +1,121 @@
+#include "contador_aplausos.h"
+
+void contador_aplausos_iniciar(struct Contador_aplausos *c)
+{
+    c->envolvente = 0;
+    c->umbral_inicio = CONTADOR_UMBRAL_INICIO;
+    c->umbral_rearme = CONTADOR_UMBRAL_REARME;
+    c->armado = 1;
+    c->muestra = 0;
+    c->ultimo_inicio = 0;
+    c->limite = CONTADOR_INTERVALO_MAX;
+    c->actual.cantidad = 0;
+    c->evento.cantidad = 0;
+    c->evento_listo = 0;
+    c->eventos_perdidos = 0;
+    c->inicios = 0;
+    c->descartadas = 0;
+}
+
+void contador_aplausos_fijar_umbral(struct Contador_aplausos *c, int32_t umbral)
+{
+    c->umbral_inicio = umbral;
+    c->umbral_rearme = umbral * CONTADOR_UMBRAL_REARME / CONTADOR_UMBRAL_INICIO;
+}
+
+// Cierra la secuencia en curso; devuelve la cantidad emitida o 0 si no alcanza el mínimo o no se pudo entregar
+static int cerrar_secuencia(struct Contador_aplausos *c)
+{
+    int cantidad = c->actual.cantidad;
+    c->actual.cantidad = 0;
+
+    if (cantidad < CONTADOR_MIN_APLAUSOS)
+    {
+        c->descartadas++;
+        return 0;
+    }
+    if (c->evento_listo)
+    {
+        c->eventos_perdidos++;
+        return 0;
+    }
+
+    c->evento = c->actual;
+    c->evento.cantidad = cantidad;
+    c->evento.fin = c->muestra;
+    c->evento_listo = 1;
+    return cantidad;
+}
+
+int contador_aplausos_procesar(struct Contador_aplausos *c, int muestra)
+{
+    int emitido = 0;
+    int32_t magnitud = (muestra < 0) ? -muestra : muestra;
+
+    c->muestra++;
+
+    // Seguidor de envolvente: ataque de medio paso por muestra, liberación exponencial por desplazamiento.
+    // La liberación redondea hacia arriba para llegar a 0: con umbrales adaptativos bajos la envolvente
+    // no puede quedarse en 2^CONTADOR_LIBERACION - 1 sin rearmar nunca
+    if (magnitud > c->envolvente)
+    {
+        c->envolvente += (magnitud - c->envolvente + 1) >> 1;
+    }
+    else
+    {
+        c->envolvente -= (c->envolvente + (1 << CONTADOR_LIBERACION) - 1) >> CONTADOR_LIBERACION;
+    }
+
+    // Resta modular: válida aunque el contador de muestras dé la vuelta
+    uint32_t desde = c->muestra - c->ultimo_inicio;
+
+    if ((c->actual.cantidad > 0) && (desde > c->limite))
+    {
+        emitido = cerrar_secuencia(c);
+    }
+
+    if (!c->armado && (c->envolvente < c->umbral_rearme))
+    {
+        c->armado = 1;
+    }
+
+    if (c->armado && (c->envolvente >= c->umbral_inicio) &&
+        ((c->actual.cantidad == 0) || (desde >= CONTADOR_REFRACTARIO)))
+    {
+        if (c->actual.cantidad == 0)
+        {
+            c->limite = CONTADOR_INTERVALO_MAX;
+        }
+        else
+        {
+            if (c->actual.cantidad < CONTADOR_MAX_APLAUSOS)
+            {
+                c->actual.intervalos[c->actual.cantidad - 1] = desde;
+            }
+
+            // El siguiente aplauso debe llegar con un ritmo parecido al del último intervalo
+            uint32_t limite = desde + (desde >> 1);
+            c->limite = (limite < CONTADOR_INTERVALO_MAX) ? limite : CONTADOR_INTERVALO_MAX;
+        }
+
+        c->actual.cantidad++;
+        c->inicios++;
+        c->ultimo_inicio = c->muestra;
+        c->armado = 0;
+    }
+
+    return emitido;
+}
+
+int contador_aplausos_leer(struct Contador_aplausos *c, struct Evento_aplausos *evento)
+{
+    if (!c->evento_listo)
+    {
+        return 0;
+    }
+
+    // La interrupción no escribe el evento mientras evento_listo siga en 1
+    *evento = c->evento;
+    c->evento_listo = 0;
+    return 1;
+}
@@ -0,0 +1,138 @@
+#ifndef CONTADOR_APLAUSOS_H
+#define CONTADOR_APLAUSOS_H
+
+/**
+ * @file contador_aplausos.h
+ * @brief Contador de aplausos en flujo, pensado para ejecutarse dentro de la interrupción del ADC.
+ *
+ * Solo usa aritmética entera: un seguidor de envolvente con ataque rápido y liberación lenta, detección
+ * de inicios con histéresis y periodo refractario, y verificación de los intervalos entre inicios.
+ * Emite un evento con la cantidad de aplausos a lo sumo un intervalo después del último aplauso, sin
+ * buffer de captura ni FFT; el DTW queda como verificador opcional en una segunda etapa.
+ */
+
+#include <stdint.h>        /**< Definiciones de tipos de datos enteros con tamaño fijo */
+
+/**
+ * @def CONTADOR_FS
+ * @brief Frecuencia (Hz) de las muestras que recibe el contador: la del ADC, antes de decimar.
+ */
+#define CONTADOR_FS 8000
+
+/**
+ * @def CONTADOR_MS_A_MUESTRAS
+ * @brief Convierte milisegundos a muestras a CONTADOR_FS.
+ */
+#define CONTADOR_MS_A_MUESTRAS(ms) ((uint32_t)(ms) * (CONTADOR_FS / 1000))
+
+/**
+ * @def CONTADOR_UMBRAL_INICIO
+ * @brief Envolvente (códigos del ADC sobre el centro) que marca el inicio de un aplauso, hasta que se fije otra
+ * con contador_aplausos_fijar_umbral().
+ */
+#define CONTADOR_UMBRAL_INICIO 890
+
+/**
+ * @def CONTADOR_UMBRAL_REARME
+ * @brief Envolvente por debajo de la cual se admite un nuevo inicio (histéresis); escala con el umbral de inicio.
+ */
+#define CONTADOR_UMBRAL_REARME 400
+
+/**
+ * @def CONTADOR_LIBERACION
+ * @brief Desplazamiento de la liberación de la envolvente: constante de tiempo de 2^n muestras (16 ms).
+ */
+#define CONTADOR_LIBERACION 7
+
+/**
+ * @def CONTADOR_REFRACTARIO
+ * @brief Muestras tras un inicio durante las que se ignoran nuevos inicios (eco y cola del aplauso).
+ */
+#define CONTADOR_REFRACTARIO CONTADOR_MS_A_MUESTRAS(80)
+
+/**
+ * @def CONTADOR_INTERVALO_MAX
+ * @brief Intervalo máximo entre aplausos de una misma secuencia.
+ */
+#define CONTADOR_INTERVALO_MAX CONTADOR_MS_A_MUESTRAS(600)
+
+/**
+ * @def CONTADOR_MIN_APLAUSOS
+ * @brief Aplausos mínimos para emitir un evento (un aplauso aislado se descarta).
+ */
+#define CONTADOR_MIN_APLAUSOS 2
+
+/**
+ * @def CONTADOR_MAX_APLAUSOS
+ * @brief Aplausos por secuencia cuyos intervalos se registran en el evento.
+ */
+#define CONTADOR_MAX_APLAUSOS 8
+
+/**
+ * @brief Secuencia de aplausos terminada.
+ */
+struct Evento_aplausos
+{
+    int cantidad;                                        /**< Aplausos de la secuencia. */
+    uint32_t intervalos[CONTADOR_MAX_APLAUSOS - 1];      /**< Muestras entre inicios consecutivos. */
+    uint32_t fin;                                        /**< Muestra en la que se cerró la secuencia. */
+};
+
+/**
+ * @brief Estado del contador; lo modifica la interrupción y el bucle principal solo lee eventos.
+ */
+struct Contador_aplausos
+{
+    int32_t envolvente;                  /**< Envolvente de |x| en códigos del ADC. */
+    int32_t umbral_inicio;               /**< Envolvente que marca el inicio de un aplauso. */
+    int32_t umbral_rearme;               /**< Envolvente por debajo de la cual se admite un nuevo inicio. */
+    int armado;                          /**< 1 si la envolvente bajó de umbral_rearme desde el último inicio. */
+    uint32_t muestra;                    /**< Muestras procesadas (aritmética modular). */
+    uint32_t ultimo_inicio;              /**< Muestra del último inicio aceptado. */
+    uint32_t limite;                     /**< Silencio tras el último inicio que cierra la secuencia. */
+    struct Evento_aplausos actual;       /**< Secuencia en curso. */
+    struct Evento_aplausos evento;       /**< Último evento emitido, válido con evento_listo. */
+    volatile int evento_listo;           /**< 1 mientras el bucle principal no haya leído el evento. */
+    volatile uint32_t eventos_perdidos;  /**< Secuencias cerradas con el evento anterior aún sin leer. */
+    volatile uint32_t inicios;           /**< Inicios de aplauso aceptados. */
+    volatile uint32_t descartadas;       /**< Secuencias con menos de CONTADOR_MIN_APLAUSOS (disparos falsos). */
+};
+
+/**
+ * @brief Inicializa el contador sin secuencia en curso.
+ *
+ * @param c Contador a inicializar.
+ */
+void contador_aplausos_iniciar(struct Contador_aplausos *c);
+
+/**
+ * @brief Cambia el umbral de inicio (p. ej. con el de nivel_adaptativo); el de rearme conserva la proporción por defecto.
+ *
+ * @param c Contador en curso.
+ * @param umbral Envolvente (códigos del ADC sobre la continua) que marca el inicio de un aplauso.
+ */
+void contador_aplausos_fijar_umbral(struct Contador_aplausos *c, int32_t umbral);
+
+/**
+ * @brief Procesa una muestra; apto para la interrupción del ADC (unas decenas de ciclos, sin flotantes).
+ *
+ * Una secuencia se cierra cuando pasa sin aplausos su límite: CONTADOR_INTERVALO_MAX después del
+ * primer aplauso y, desde el segundo, 3/2 del último intervalo (acotado por CONTADOR_INTERVALO_MAX).
+ * Un aplauso más tardío rompe el ritmo y empieza una secuencia nueva.
+ *
+ * @param c Contador en curso.
+ * @param muestra Muestra del ADC centrada (código menos el nivel de reposo).
+ * @return Cantidad de aplausos si en esta muestra se emitió un evento, 0 en caso contrario.
+ */
+int contador_aplausos_procesar(struct Contador_aplausos *c, int muestra);
+
+/**
+ * @brief Retira el último evento emitido, desde el bucle principal.
+ *
+ * @param c Contador en curso.
+ * @param evento Copia del evento (solo válida si la función devuelve 1).
+ * @return 1 si había un evento pendiente, 0 en caso contrario.
+ */
+int contador_aplausos_leer(struct Contador_aplausos *c, struct Evento_aplausos *evento);
+
+#endif // CONTADOR_APLAUSOS_H
@@ -0,0 +1,121 @@
+#include "matematica_aproximada.h"
+
+/**
+ * @brief Acceso a los bits de un flotante IEEE 754 de simple precisión.
+ */
+union Bits_flotante
+{
+    float f;    /**< Valor flotante. */
+    uint32_t u; /**< Sus bits: signo, 8 de exponente y 23 de mantisa. */
+};
+
+#define MANTISA_BITS 23                                  // Bits de mantisa de un float
+#define FRACCION_BITS (MANTISA_BITS - APROX_TABLA_BITS)  // Bits de mantisa bajo el índice de la tabla
+
+float magnitud_alfa_beta(float re, float im)
+{
+    float a = fabsf(re);
+    float b = fabsf(im);
+    return (a > b) ? MAGNITUD_ALFA * a + MAGNITUD_BETA * b : MAGNITUD_ALFA * b + MAGNITUD_BETA * a;
+}
+
+uint32_t magnitud_alfa_beta_entera(int32_t re, int32_t im)
+{
+    uint32_t a = (uint32_t)((re < 0) ? -re : re);
+    uint32_t b = (uint32_t)((im < 0) ? -im : im);
+    uint32_t mayor = (a > b) ? a : b;
+    uint32_t menor = (a > b) ? b : a;
+
+    // Con ambos por debajo de 2^16 la suma de productos cabe en 32 bits sin signo
+    return (MAGNITUD_ALFA_Q15 * mayor + MAGNITUD_BETA_Q15 * menor + (1u << 14)) >> 15;
+}
+
+uint32_t raiz_entera(uint32_t x)
+{
+    uint32_t raiz = 0;
+    uint32_t bit = 1u << 30; // Mayor potencia de 4 representable
+
+    while (bit > x)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (x >= raiz + bit)
+        {
+            x -= raiz + bit;
+            raiz = (raiz >> 1) + bit;
+        }
+        else
+        {
+            raiz >>= 1;
+        }
+        bit >>= 2;
+    }
+    return raiz;
+}
+
+float log2_aprox(float x)
+{
+    if (!(x > 0.0f))
+    {
+        return -INFINITY;
+    }
+
+    union Bits_flotante v = {x};
+    int exponente = (int)((v.u >> MANTISA_BITS) & 0xFF) - 127;
+    uint32_t mantisa = v.u & ((1u << MANTISA_BITS) - 1);
+
+    // log2(1 + t): los bits altos de t indexan la tabla y los bajos interpolan
+    uint32_t i = mantisa >> FRACCION_BITS;
+    float t = (float)(mantisa & ((1u << FRACCION_BITS) - 1)) * (1.0f / (float)(1u << FRACCION_BITS));
+    float a = aprox_log2_tabla[i];
+    return (float)exponente + a + (aprox_log2_tabla[i + 1] - a) * t;
+}
+
+float exp2_aprox(float x)
+{
+    if (!(x >= -126.0f)) // También NaN
+    {
+        x = -126.0f;
+    }
+    else if (x > 127.99f)
+    {
+        x = 127.99f;
+    }
+
+    // Parte entera hacia -infinito y fraccionaria en [0, 1)
+    int entero = (int)x;
+    if ((float)entero > x)
+    {
+        entero--;
+    }
+    float posicion = (x - (float)entero) * (float)APROX_TABLA_TAMANO;
+    int i = (int)posicion;
+    float t = posicion - (float)i;
+
+    // Un x apenas negativo deja x - entero redondeado a 1.0f: es 2^(entero + 1), el primer punto de la tabla
+    if (i >= APROX_TABLA_TAMANO)
+    {
+        i = 0;
+        t = 0.0f;
+        entero++;
+    }
+    float a = aprox_exp2_tabla[i];
+
+    // Mantisa en [1, 2]; la parte entera se suma directamente al exponente
+    union Bits_flotante v;
+    v.f = a + (aprox_exp2_tabla[i + 1] - a) * t;
+    v.u += (uint32_t)entero << MANTISA_BITS;
+    return v.f;
+}
+
+float log_aprox(float x)
+{
+    return log2_aprox(x) * 0.693147181f;
+}
+
+float exp_aprox(float x)
+{
+    return exp2_aprox(x * 1.442695041f);
+}
@@ -0,0 +1,134 @@
+#ifndef MATEMATICA_APROXIMADA_H
+#define MATEMATICA_APROXIMADA_H
+
+/**
+ * @file matematica_aproximada.h
+ * @brief Núcleos matemáticos aproximados para los caminos calientes del DSP, con cotas de error documentadas.
+ *
+ * El RP2040 no tiene FPU: sqrtf, hypotf, logf y expf de newlib son rutinas en software de cientos de
+ * ciclos. Aquí hay reemplazos baratos (magnitud alfa-max-beta-min, raíz entera exacta y log2/exp2 por
+ * tabla) y la selección en tiempo de compilación entre el cálculo exacto y el aproximado.
+ */
+
+#include <stdint.h>        /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include <math.h>          /**< sqrtf para las variantes exactas */
+#include "dsp_tables.h"    /**< Tablas de log2 y exp2 generadas al compilar */
+
+/**
+ * @def MATEMATICA_APROXIMADA
+ * @brief 1 calcula las magnitudes del espectro con magnitud_alfa_beta(); 0 con la raíz exacta.
+ */
+#ifndef MATEMATICA_APROXIMADA
+#define MATEMATICA_APROXIMADA 0
+#endif
+
+/**
+ * @def MAGNITUD_ALFA
+ * @brief Coeficiente del máximo en alfa-max-beta-min: 2 cos(pi/8) / (1 + cos(pi/8)).
+ */
+#define MAGNITUD_ALFA 0.960433870f
+
+/**
+ * @def MAGNITUD_BETA
+ * @brief Coeficiente del mínimo en alfa-max-beta-min: 2 sin(pi/8) / (1 + cos(pi/8)).
+ */
+#define MAGNITUD_BETA 0.397824735f
+
+/**
+ * @def MAGNITUD_ALFA_Q15
+ * @brief MAGNITUD_ALFA en Q15, para magnitud_alfa_beta_entera().
+ */
+#define MAGNITUD_ALFA_Q15 31471
+
+/**
+ * @def MAGNITUD_BETA_Q15
+ * @brief MAGNITUD_BETA en Q15, para magnitud_alfa_beta_entera().
+ */
+#define MAGNITUD_BETA_Q15 13036
+
+/**
+ * @brief Magnitud aproximada de un número complejo: alfa max(|re|, |im|) + beta min(|re|, |im|).
+ *
+ * Error relativo máximo 3.96 % (por exceso y por defecto, repartido de forma pareja en el ángulo):
+ * dos multiplicaciones y una suma en lugar de la raíz.
+ *
+ * @param re Parte real.
+ * @param im Parte imaginaria.
+ * @return Aproximación de sqrt(re^2 + im^2).
+ */
+float magnitud_alfa_beta(float re, float im);
+
+/**
+ * @brief magnitud_alfa_beta() en enteros, con los coeficientes en Q15.
+ *
+ * Mismo error que la versión flotante más medio código de redondeo.
+ *
+ * @param re Parte real (|re| <= 65535).
+ * @param im Parte imaginaria (|im| <= 65535).
+ * @return Aproximación de sqrt(re^2 + im^2), redondeada.
+ */
+uint32_t magnitud_alfa_beta_entera(int32_t re, int32_t im);
+
+/**
+ * @brief Raíz cuadrada entera exacta por el método bit a bit (16 iteraciones de sumas y desplazamientos).
+ *
+ * @param x Radicando.
+ * @return floor(sqrt(x)), sin error.
+ */
+uint32_t raiz_entera(uint32_t x);
+
+/**
+ * @brief log2 aproximado: exponente del flotante más log2 de la mantisa por tabla interpolada.
+ *
+ * Con APROX_TABLA_BITS = 6 el error absoluto no pasa de 4.4e-5 (cota de la interpolación lineal,
+ * h^2 / (8 ln 2)) más el redondeo del flotante.
+ *
+ * @param x Argumento (normal y positivo).
+ * @return Aproximación de log2(x), o -infinito si x <= 0.
+ */
+float log2_aprox(float x);
+
+/**
+ * @brief exp2 aproximado: parte entera al exponente del flotante y parte fraccionaria por tabla interpolada.
+ *
+ * Con APROX_TABLA_BITS = 6 el error relativo no pasa de 1.5e-5 (h^2 ln(2)^2 / 8) más el redondeo
+ * del flotante. El argumento se satura a [-126, 128) para que el resultado sea un flotante normal (NaN da 2^-126).
+ *
+ * @param x Exponente.
+ * @return Aproximación de 2^x.
+ */
+float exp2_aprox(float x);
+
+/**
+ * @brief Logaritmo natural aproximado, log2_aprox(x) ln 2 (error absoluto hasta 3.1e-5).
+ *
+ * @param x Argumento (normal y positivo).
+ * @return Aproximación de ln(x), o -infinito si x <= 0.
+ */
+float log_aprox(float x);
+
+/**
+ * @brief Exponencial aproximada, exp2_aprox(x log2(e)) (mismo error relativo que exp2_aprox()).
+ *
+ * @param x Exponente (saturado como en exp2_aprox()).
+ * @return Aproximación de e^x.
+ */
+float exp_aprox(float x);
+
+/**
+ * @brief Magnitud de un bin del espectro con la variante elegida por MATEMATICA_APROXIMADA.
+ *
+ * @param re Parte real.
+ * @param im Parte imaginaria.
+ * @return sqrt(re^2 + im^2), exacta o con magnitud_alfa_beta().
+ */
+static inline float magnitud(float re, float im)
+{
+#if MATEMATICA_APROXIMADA
+    return magnitud_alfa_beta(re, im);
+#else
+    return sqrtf(re * re + im * im);
+#endif
+}
+
+#endif // MATEMATICA_APROXIMADA_H
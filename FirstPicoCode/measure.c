@@ -7,11 +7,16 @@
 #include "hardware/gpio.h" /**< Configuración y control de pines GPIO. */
 #include "hardware/irq.h"  /**< Manejo de interrupciones en el hardware. */
 #include "hardware/sync.h" /**< Funciones de sincronización del hardware. */
+#include "hardware/dma.h"  /**< Canales DMA para volcar el FIFO del ADC a memoria. */
 #include "measure_libs.h"   /**< Librería personalizada para realizar mediciones específicas. */
 #include "base_de_datos.h" /**< Librería personalizada para gestionar la base de datos de usuarios. */
 #include "hardware/pwm.h"  /**< Control del módulo PWM en la Raspberry Pi Pico. */
 #include "digi_elements.h"  /**< Librería personalizada de inicialización de sensores y actuadores digitales */
 #include "config_pwm.h"     /**< Librería personalizada de configuración y uso de PWM */
+#include "benchmark_dsp.h"  /**< Benchmarks de los núcleos DSP (habilitados con DSP_BENCHMARK) */
+#include "reconocedor.h"    /**< Biblioteca de plantillas y clasificador de patrones de aplausos */
+#include "contador_aplausos.h" /**< Contador de aplausos en la interrupción del ADC */
+#include "nivel_adaptativo.h"  /**< Continua, piso de ruido y umbral de disparo adaptativos */
 
 /**
  * @brief Valor de referencia de voltaje para la conversión ADC.
@@ -38,42 +43,179 @@
  */
 #define MAX_SIGNAL_AMPLITUDE 1.6 // Expected max deviation from reference
 
+/**
+ * @brief Código del ADC más cercano a REF_VOLTAGE: continua inicial del estimador de nivel_adaptativo.
+ */
+#define ADC_CENTRO 2110
 
 /**
- * @brief Límite de muestras a capturar en el buffer.
+ * @brief Normalización de códigos del ADC centrados a amplitud (como normalizar_muestra()), aplicada por ventana
+ * a las características en lugar de a cada muestra guardada.
  */
-#define CAPTURE_LIMIT 5120 // Cantidad de muestras a capturar
+#define ESCALA_CARACTERISTICAS ((float)(ADC_CONVERT / MAX_SIGNAL_AMPLITUDE))
+
 
 /**
- * @brief Umbral para iniciar la captura de muestras.
+ * @brief Límite de muestras a capturar en el buffer (tras la decimación).
  */
-#define THRESHOLD_VALUE 3000 // Umbral para iniciar captura.
+#define CAPTURE_LIMIT SAMPLES // Cantidad de muestras a capturar
 
 /**
- * @brief Divisor de reloj para el ADC con el objetivo de lograr una frecuencia de muestreo de 8 kHz.
+ * @brief Ranuras de captura: la adquisición llena una mientras el bucle principal analiza otra.
  */
-#define ADC_CLKDIV 6000      // Divisor de reloj para lograr una FS de 8 kHz.
+#define CAPTURA_RANURAS 2
+
+/**
+ * @brief Muestras del historial circular donde viven las capturas (una ventana que cruza su final se copia).
+ */
+#define HISTORIA_MUESTRAS (CAPTURA_RANURAS * CAPTURE_LIMIT)
+
+/**
+ * @brief Milisegundos de señal previos al disparo que se incluyen en cada captura (ataque del primer aplauso).
+ */
+#ifndef PRE_DISPARO_MS
+#define PRE_DISPARO_MS 32
+#endif
+
+/**
+ * @brief Muestras previas al disparo, a la tasa de las características.
+ */
+#define MUESTRAS_PRE_DISPARO (PRE_DISPARO_MS * FS_CARACTERISTICAS / 1000)
+
+/**
+ * @brief Silencio (ms) tras el último sonido que termina una captura antes de CAPTURE_LIMIT.
+ *
+ * Se alarga a 3/2 del hueco más largo entre sonidos de la misma captura, como el cierre del contador, y
+ * debe superar los huecos entre aplausos de las plantillas. Un valor mayor que la captura la deja de largo fijo.
+ */
+#ifndef SILENCIO_FIN_MS
+#define SILENCIO_FIN_MS 300
+#endif
 
 /**
- * @brief Número de muestras por cada captura de audio.
+ * @brief Atenuación respecto del pico de la captura (desplazamiento: 3 = 1/8, -18 dB) bajo la cual se considera silencio.
  */
-#define SAMPLES 5120      // Numero de muestras por audio capturado
+#ifndef SILENCIO_ATENUACION
+#define SILENCIO_ATENUACION 3
+#endif
 
 /**
- * @brief Tamaño de la ventana para realizar la Transformada de Fourier de Tiempo Corto (STFT).
+ * @brief Silencio mínimo que termina una captura, en muestras a la tasa de las características.
  */
-#define TAMANO_VENTANA 64 // Tamaño de la ventana para la STFT
+#define MUESTRAS_SILENCIO_FIN (SILENCIO_FIN_MS * FS_CARACTERISTICAS / 1000)
+
+/**
+ * @brief Espera máxima, en muestras del ADC, entre un conteo y el resultado del DTW que lo confirma (o al revés).
+ *
+ * Una captura dura como mucho SAMPLES_ADC muestras más el silencio final; pasado ese plazo el evento que
+ * quedó sin pareja (captura perdida, o secuencia del contador que no disparó captura) se descarta.
+ */
+#define ESPERA_PAREJA_MUESTRAS (SAMPLES_ADC + SILENCIO_FIN_MS * FS / 1000)
+
+/**
+ * @brief Compuerta de energía del extractor, en veces el piso de ruido: las ventanas cuya media de |x| no la
+ * alcanza se estiman sin FFT. 0 transforma todas las ventanas.
+ */
+#ifndef COMPUERTA_FACTOR_RUIDO
+#define COMPUERTA_FACTOR_RUIDO 4
+#endif
+
+/**
+ * @brief Estados de una ranura de captura.
+ */
+#define RANURA_LIBRE 0      // Disponible para la próxima captura
+#define RANURA_CAPTURANDO 1 // La adquisición la está llenando
+#define RANURA_LISTA 2      // Completa, pendiente de análisis
+
+/**
+ * @brief Adquisición del ADC: 1 DMA hacia un anillo con dos canales encadenados, 0 una interrupción por muestra.
+ */
+#ifndef ADC_USAR_DMA
+#define ADC_USAR_DMA 1
+#endif
+
+/**
+ * @brief Muestras de cada bloque del anillo DMA (32 ms a 8 kHz); cada bloque completo genera una notificación.
+ */
+#define ANILLO_BLOQUE 256
+
+/**
+ * @brief Bloques del anillo DMA (par: los dos canales se alternan los bloques).
+ *
+ * El bucle principal procesa las muestras, así que puede atrasarse hasta ANILLO_BLOQUES - 2 bloques
+ * (192 ms con 8) mientras imprime una captura o clasifica sin perder ninguna.
+ */
+#ifndef ANILLO_BLOQUES
+#define ANILLO_BLOQUES 8
+#endif
+
+#if (ANILLO_BLOQUES < 4) || (ANILLO_BLOQUES % 2 != 0)
+#error "ANILLO_BLOQUES debe ser par y al menos 4"
+#endif
+
+/**
+ * @brief Ventanas que el bucle principal transforma como máximo en cada despertar durante una captura.
+ *
+ * Con DMA el bucle despierta una vez por bloque del anillo, cuando ya se completaron varias ventanas: se
+ * transforman todas, así al terminar la captura solo queda la última. Con una interrupción por muestra
+ * despierta en cada muestra y basta una ventana por vuelta.
+ */
+#if ADC_USAR_DMA
+#define VENTANAS_POR_DESPERTAR (ANILLO_BLOQUE / DECIMACION_FACTOR / SALTO_VENTANA + 1)
+#else
+#define VENTANAS_POR_DESPERTAR 1
+#endif
+
+/**
+ * @brief Divisor de reloj para el ADC con el objetivo de lograr una frecuencia de muestreo de 8 kHz.
+ */
+#define ADC_CLKDIV 6000      // Divisor de reloj para lograr una FS de 8 kHz.
 
 /**
  * @brief Frecuencia de muestreo en Hz.
  */
 #define FS 8000           // frecuencia de muestreo
 
+/**
+ * @brief Frecuencia de las muestras que llegan a la extracción de características (tras decimar).
+ */
+#define FS_CARACTERISTICAS (FS / DECIMACION_FACTOR)
+
 /**
  * @brief Pin GPIO asociado al ADC.
  */
 #define adc_GPIO 26
 
+/**
+ * @brief Distancia DTW máxima para reconocer el patrón de tres aplausos.
+ */
+#define UMBRAL_DTW_TRES_APLAUSOS 4.0f
+
+/**
+ * @brief Distancia DTW máxima para reconocer el patrón de dos aplausos.
+ */
+#define UMBRAL_DTW_DOS_APLAUSOS 3.3f
+
+/**
+ * @brief Modo de detección: 0 captura fija disparada por umbral, 1 búsqueda continua por DTW de subsecuencia.
+ */
+#ifndef MODO_DETECCION_CONTINUA
+#define MODO_DETECCION_CONTINUA 0
+#endif
+
+/**
+ * @brief En el modo por captura: 0 actúa el contador de aplausos solo, 1 el DTW confirma cada conteo.
+ */
+#ifndef VERIFICACION_DTW
+#define VERIFICACION_DTW 1
+#endif
+
+/**
+ * @brief La adquisición (interrupción del ADC o consumidor de los bloques DMA) llena las ranuras de captura
+ * (modo por captura con verificación DTW).
+ */
+#define CAPTURA_EN_INTERRUPCION (!MODO_DETECCION_CONTINUA && VERIFICACION_DTW)
+
 struct Flags  /**< Estructura para almacenar banderas del sistema. */
 {
     int LDR_is_high; /**< Estado alto del sensor LDR. */
@@ -86,26 +228,151 @@ struct Flags  /**< Estructura para almacenar banderas del sistema. */
 
 struct Flags Flags_1 = {0, 0, 0, 0, 0, 0};
 
-float captured_samples[CAPTURE_LIMIT]; /**< Buffer para almacenar muestras convertidas desde el ADC. */
+int16_t historia_muestras[HISTORIA_MUESTRAS];  /**< Historial circular de muestras decimadas sin normalizar (códigos del ADC centrados); las capturas se leen en él. */
+volatile int historia_posicion = 0;            /**< Posición de la próxima muestra en el historial. */
+volatile int historia_validas = 0;             /**< Muestras escritas desde el arranque (saturado en HISTORIA_MUESTRAS). */
+volatile int ranura_estado[CAPTURA_RANURAS];   /**< RANURA_LIBRE, RANURA_CAPTURANDO o RANURA_LISTA. */
+volatile int ranura_inicio[CAPTURA_RANURAS];   /**< Posición en el historial de la primera muestra de cada captura. */
+volatile int ranura_muestras[CAPTURA_RANURAS]; /**< Muestras de cada captura ya escritas (incluye las previas al disparo). */
+volatile int ranura_escritura = 0;             /**< Ranura que llena (o llenará) la adquisición. */
+int ranura_lectura = 0;                        /**< Ranura más antigua pendiente de análisis. */
+int extractor_activo = 0;                      /**< El extractor ya se inició para ranura_lectura. */
+volatile uint32_t capturas_perdidas = 0;       /**< Disparos sin ranura libre (desbordes), para monitoreo. */
+volatile int perdida_restante = 0;             /**< Muestras del ADC que dura la captura perdida en curso. */
+int silencio_muestras = 0;                     /**< Muestras seguidas de silencio al final de la captura en curso. */
+int hueco_max = 0;                             /**< Hueco de silencio más largo entre sonidos de la captura en curso. */
+int32_t pico_captura = 0;                      /**< Envolvente máxima del contador en la captura en curso. */
+float relacion_piso = 0.0f;                    /**< Característica por unidad de suma de |x| en las ventanas silenciosas de las plantillas. */
+float piso_caracteristica = 0.0f;              /**< Suma de las características de esas ventanas (en unidades de las muestras). */
+float piso_energia = 0.0f;                     /**< Suma de |x| de esas ventanas. */
 
-const int Tamano_array = SAMPLES / TAMANO_VENTANA; /**< Tamaño del arreglo para transformadas cortas. */
+struct Biblioteca_plantillas biblioteca;     /**< Plantillas de patrones, con sus características calculadas al arrancar. */
+struct Caracteristicas caract_captura;       /**< Características del audio capturado, calculadas una vez por captura. */
+struct Extractor_STFT extractor_captura;     /**< Extractor incremental que procesa cada ventana apenas se llena. */
+struct Detector_continuo detector;           /**< Detector por DTW de subsecuencia para el modo continuo. */
+struct Decimador decimador;                  /**< Filtro antialias y decimación entre el ADC y las características. */
+struct Contador_aplausos contador;           /**< Contador de aplausos alimentado desde adc_handler. */
+struct Nivel_adaptativo nivel;               /**< Continua, piso de ruido y umbral de disparo seguidos muestra a muestra. */
 
 volatile int adc_raw = 0;       /**< Valor de la última muestra cruda del ADC. */
+uint16_t anillo_adc[ANILLO_BLOQUES][ANILLO_BLOQUE]; /**< Anillo del DMA: los dos canales llenan bloques alternos y se encadenan. */
+int canal_dma[2];                      /**< Canal DMA de los bloques pares (0) e impares (1). */
+int bloque_canal[2];                   /**< Próximo bloque del anillo que escribirá cada canal. */
+volatile uint32_t bloques_dma = 0;     /**< Bloques completados (el n-ésimo está en anillo_adc[n % ANILLO_BLOQUES]); notifica al bucle principal. */
+uint32_t bloques_consumidos = 0;       /**< Bloques ya procesados por el bucle principal. */
+uint32_t bloques_perdidos = 0;         /**< Bloques sobrescritos antes de que el bucle principal los procesara. */
 volatile int capture_start = 0; /**< Bandera para iniciar almacenamiento de muestras. */
-volatile int capture_count = 0; /**< Contador de muestras capturadas tras cruzar el umbral. */
 volatile int servo_angle = 0; /**< Ángulo actual del servomotor. */
 
 // Demas banderas para procesamiento
-int IsProcess = 0; /**< Indica si el sistema está procesando. */
-int IsShow = 0;   /**< Indica si el sistema está mostrando resultados relacionado al cambio de clave. */
 int led_state = 0;   /**< Estado del LED principal, 0: apagado, 1: encendido, para alternar cmbios. */
 int led_state_2 = 0; /**< Estado del LED secundario, 0: apagado, 1: encendido, para alternar cmbios. */
+struct Evento_aplausos conteo; /**< Último evento del contador, válido con hay_conteo. */
+int hay_conteo = 0;         /**< Hay un evento del contador pendiente de decidir. */
+int hay_verificacion = 0;   /**< Hay un resultado del DTW pendiente de emparejar con un conteo. */
+int indice_verificado = -1; /**< Plantilla reconocida por el DTW, o -1 si ninguna. */
+uint32_t verificacion_muestra; /**< Muestra del contador en la que se obtuvo el resultado del DTW pendiente. */
 
 /**
  * @brief Maneja las interrupciones del ADC, almacena datos y actualiza banderas.
  */
 void adc_handler();
 
+/**
+ * @brief Maneja la interrupción de fin de bloque del DMA: reconoce, rearma el canal dos bloques más adelante y
+ * notifica el bloque completo. No toca las muestras.
+ */
+void dma_handler();
+
+/**
+ * @brief Procesa una muestra cruda del ADC: contador de aplausos y captura, venga de la interrupción o del DMA.
+ * @param raw Muestra cruda del ADC.
+ */
+void procesar_muestra_adc(int raw);
+
+/**
+ * @brief Devuelve el siguiente bloque del anillo DMA que el bucle principal aún no procesó.
+ *
+ * Si el bucle se atrasó tanto que el DMA alcanzó al bloque más antiguo, los bloques que ya se están
+ * sobrescribiendo se cuentan en bloques_perdidos.
+ *
+ * @return Bloque completo (ANILLO_BLOQUE muestras), o NULL si no hay ninguno pendiente.
+ */
+const uint16_t *siguiente_bloque_adc(void);
+
+/**
+ * @brief Pasa los bloques DMA pendientes por procesar_muestra_adc() (continua, contador y captura).
+ *
+ * Con DMA es el consumidor de las notificaciones de dma_handler() y corre en el bucle principal; se llama
+ * también dentro de las tareas largas (impresión de una captura) para no atrasarse. Con una interrupción
+ * por muestra no hace nada: adc_handler() ya procesó cada muestra.
+ */
+void consumir_bloques_adc(void);
+
+/**
+ * @brief Entrega una muestra cruda al decimador y al detector continuo, y ejecuta la acción detectada.
+ * @param raw Muestra cruda del ADC.
+ */
+void detectar_continuo(int raw);
+
+/**
+ * @brief Escribe el historial circular y dispara las capturas, desde la interrupción del ADC o desde consumir_bloques_adc().
+ *
+ * Un disparo congela una captura que empieza al menos MUESTRAS_PRE_DISPARO muestras antes (alineada a
+ * SALTO_VENTANA) y termina en CAPTURE_LIMIT muestras o, antes, en el primer final de ventana tras el
+ * silencio final (ver SILENCIO_FIN_MS); el historial nunca pisa una captura pendiente de análisis.
+ *
+ * @param centrada Muestra del ADC menos la continua estimada.
+ */
+void capturar_muestra(int centrada);
+
+/**
+ * @brief Imprime la continua, el piso de ruido, el umbral y las estadísticas de disparo, para ajustarlos en campo.
+ */
+void imprimir_nivel(void);
+
+/**
+ * @brief Convierte una muestra centrada (código del ADC menos ADC_CENTRO) a la amplitud normalizada.
+ * @param centrada Muestra centrada, posiblemente ya decimada.
+ * @return Muestra normalizada respecto a REF_VOLTAGE y MAX_SIGNAL_AMPLITUDE.
+ */
+float normalizar_muestra(int centrada);
+
+/**
+ * @brief Decodifica una plantilla del almacén y la lleva a la tasa de las características, con el mismo decimador que el ADC.
+ * @param p Plantilla almacenada (a 8 kHz; se recorta o se completa con silencio a SAMPLES_ADC muestras).
+ * @param destino Buffer de SAMPLES muestras en códigos del ADC centrados, como el historial de captura.
+ */
+void preparar_plantilla(const struct Plantilla_almacenada *p, int16_t *destino);
+
+/**
+ * @brief Registra una plantilla del almacén con las características calculadas por el mismo camino que las capturas.
+ *
+ * Sus ventanas bajo la energía media calibran relacion_piso, la estimación que usa la compuerta de energía.
+ *
+ * @param p Plantilla almacenada.
+ * @param umbral Distancia DTW máxima para aceptar el patrón.
+ * @param accion Acción a ejecutar cuando se reconozca.
+ */
+void agregar_plantilla(const struct Plantilla_almacenada *p, float umbral, accion_plantilla_t accion);
+
+/**
+ * @brief Acción del patrón de tres aplausos: alterna la lámpara de noche.
+ */
+void accion_luz_noche(void);
+
+/**
+ * @brief Acción del patrón de dos aplausos: alterna la luz de la habitación.
+ */
+void accion_luz_cuarto(void);
+
+/**
+ * @brief Acción asociada a una cantidad de aplausos del contador.
+ * @param cantidad Aplausos de la secuencia.
+ * @return Acción a ejecutar, o NULL si la cantidad no tiene acción.
+ */
+accion_plantilla_t accion_por_conteo(int cantidad);
+
 /**
  * @brief Callback de interrupciones para manejar eventos de GPIO.
  * @param gpio Pin GPIO que generó la interrupción.
@@ -135,8 +402,14 @@ int main()
     stdio_init_all();
     sleep_ms(10000); // Espera para inicializar la casa
 
+#if DSP_BENCHMARK
+    benchmark_dsp_ejecutar();
+#endif
+
     LandB_init();
-    ADC_initialize(adc_GPIO);
+    contador_aplausos_iniciar(&contador); // Antes de habilitar la interrupción del ADC
+    nivel_adaptativo_iniciar(&nivel, ADC_CENTRO);
+    decimador_iniciar(&decimador);
     set_up_LDR();
     set_up_IR();
 
@@ -148,87 +421,175 @@ int main()
     gpio_set_irq_enabled_with_callback(IR_PIN, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true, &gpio_callback);
     gpio_set_irq_enabled_with_callback(BUTTON, GPIO_IRQ_EDGE_FALL, true, &gpio_callback);
 
+    // Las plantillas no cambian: su envolvente espectral se calcula una sola vez.
+    // La captura se prealinea a cada plantilla (hasta DTW_BANDA ventanas), así el DTW usa una banda angosta
+    biblioteca_iniciar(&biblioteca, DTW_BANDA_ALINEADA, DTW_BANDA);
+    // Las señales se leen de la flash; el buffer de captura sirve de espacio de trabajo porque aún no se usa
+    agregar_plantilla(almacen_plantilla(PLANTILLA_TRES_APLAUSOS), UMBRAL_DTW_TRES_APLAUSOS, accion_luz_noche);
+    agregar_plantilla(almacen_plantilla(PLANTILLA_DOS_APLAUSOS), UMBRAL_DTW_DOS_APLAUSOS, accion_luz_cuarto);
+    detector_continuo_iniciar(&detector, &biblioteca);
+
+    // El historial de captura se usó como espacio de trabajo: recién ahora se habilita el ADC
+    ADC_initialize(adc_GPIO);
+
     // Bucle principal
     while (true)
     {
 
-        // iniciar la captura, si valor supera el umbral
-        if (!capture_start && adc_raw >= THRESHOLD_VALUE)
+#if MODO_DETECCION_CONTINUA
+        // Cada muestra alimenta el flujo de características; no hay umbral de disparo ni captura fija
+#if ADC_USAR_DMA
+        const uint16_t *bloque;
+        while ((bloque = siguiente_bloque_adc()) != NULL)
         {
-            capture_start = 1; // Activa la bandera para iniciar la captura
+            for (int i = 0; i < ANILLO_BLOQUE; i++)
+            {
+                procesar_muestra_adc(bloque[i]);
+                detectar_continuo(bloque[i]);
+            }
         }
-
-        // Si la captura ha comenzado, guarda las muestras
-        if ((capture_start) && (Flags_1.adc_avail))
+#else
+        if (Flags_1.adc_avail)
         {
-            captured_samples[capture_count] = ((adc_raw * ADC_CONVERT) - REF_VOLTAGE) / MAX_SIGNAL_AMPLITUDE;
-            capture_count++;
             Flags_1.adc_avail = 0;
+            detectar_continuo(adc_raw);
         }
+#endif
+#else
+        // Con DMA las muestras de los bloques completos pasan aquí por la continua, el contador y la captura
+        consumir_bloques_adc();
 
-        // Verifica si se alcanzaron las 5120 muestras
-        if ((capture_count >= CAPTURE_LIMIT) && !IsProcess)
+        // El contador propone el patrón; el DTW (si está habilitado) lo confirma
+        struct Evento_aplausos evento;
+        if (contador_aplausos_leer(&contador, &evento))
         {
-            // Imprime las muestras almacenadas
-            for (int i = 0; i < CAPTURE_LIMIT; i++)
+            if (hay_conteo)
             {
-                printf("%.5f\n", captured_samples[i]);
+                printf("Conteo de %d aplausos sin verificacion DTW: descartado\n", conteo.cantidad);
             }
-            printf("Cantidad de muestras: %d\n", capture_count);
-            IsProcess = 1;
+            conteo = evento;
+            printf("Contador: %d aplausos\n", conteo.cantidad);
+            imprimir_nivel();
+            hay_conteo = 1;
         }
 
-        if (IsProcess && !IsShow)
+#if VERIFICACION_DTW
+        // La adquisición escribe el historial y congela las capturas; aquí se analiza la más antigua en su lugar
+        if (ranura_estado[ranura_lectura] != RANURA_LIBRE)
         {
-            // Calcular la amplitud promedio y los índices de tiempo para cada ventana
-            float amplitudes_promedio[Tamano_array];   // Array para almacenar las amplitudes promedio
-            float indices_tiempo[Tamano_array];        // Array para almacenar los índices de tiempo
-            float amplitudes_promedio_2[Tamano_array]; // Array para almacenar las amplitudes promedio
-            float indices_tiempo_2[Tamano_array];      // Array para almacenar los índices de tiempo
-
-            float amplitudes_promedio_3[Tamano_array]; // Array para almacenar las amplitudes promedio
-            float indices_tiempo_3[Tamano_array];      // Array para almacenar los índices de tiempo
-            float amplitudes_promedio_4[Tamano_array]; // Array para almacenar las amplitudes promedio
-            float indices_tiempo_4[Tamano_array];      // Array para almacenar los índices de tiempo
+            if (!extractor_activo)
+            {
+                hay_verificacion = 0; // Un resultado anterior no corresponde a esta secuencia
+                extractor_stft_iniciar(&extractor_captura, &caract_captura, FS_CARACTERISTICAS);
+                // Los silencios entre aplausos se estiman sin FFT; la compuerta sigue al piso de ruido de la sala
+                extractor_stft_fijar_compuerta(&extractor_captura,
+                                               (int32_t)(((int64_t)nivel.ruido * COMPUERTA_FACTOR_RUIDO * TAMANO_VENTANA) >> NIVEL_RUIDO_Q),
+                                               relacion_piso);
+                extractor_activo = 1;
+            }
 
-            graficar_amplitud_promedio_frecuencia(Datos_tres_aplausos_1, FS, TAMANO_VENTANA, amplitudes_promedio, indices_tiempo);
-            graficar_amplitud_promedio_frecuencia(captured_samples, FS, TAMANO_VENTANA, amplitudes_promedio_2, indices_tiempo_2);
+            // Transformar las ventanas que se completaron desde el último despertar mientras sigue la captura
+            extractor_stft_procesar_anillo(&extractor_captura, historia_muestras, HISTORIA_MUESTRAS,
+                                           ranura_inicio[ranura_lectura], ranura_muestras[ranura_lectura],
+                                           VENTANAS_POR_DESPERTAR, ESCALA_CARACTERISTICAS);
+        }
 
-            graficar_amplitud_promedio_frecuencia(Datos_dos_aplausos_1, FS, TAMANO_VENTANA, amplitudes_promedio_3, indices_tiempo_3);
-            graficar_amplitud_promedio_frecuencia(captured_samples, FS, TAMANO_VENTANA, amplitudes_promedio_4, indices_tiempo_4);
+        // Verifica si la ranura ya terminó (CAPTURE_LIMIT muestras o silencio final)
+        if (ranura_estado[ranura_lectura] == RANURA_LISTA)
+        {
+            int inicio = ranura_inicio[ranura_lectura];
+            int muestras = ranura_muestras[ranura_lectura];
 
-            float dtw_distance = dtw(amplitudes_promedio, 80, amplitudes_promedio_2, 80);
+            // Imprime las muestras almacenadas (la adquisición sigue escribiendo el historial, nunca esta ranura)
+            for (int i = 0; i < muestras; i++)
+            {
+                printf("%.5f\n", normalizar_muestra(historia_muestras[(inicio + i) % HISTORIA_MUESTRAS]));
+                if (i % ANILLO_BLOQUE == 0)
+                {
+                    consumir_bloques_adc(); // La impresión dura más que el anillo DMA
+                }
+            }
+            printf("Cantidad de muestras: %d (%d ms), capturas perdidas: %lu, bloques DMA perdidos: %lu\n", muestras,
+                   muestras * 1000 / FS_CARACTERISTICAS, (unsigned long)capturas_perdidas,
+                   (unsigned long)bloques_perdidos);
 
-            float dtw_distance_2 = dtw(amplitudes_promedio_3, 80, amplitudes_promedio_4, 80);
+            // Las ventanas ya se transformaron durante la captura; solo puede faltar la última
+            extractor_stft_procesar_anillo(&extractor_captura, historia_muestras, HISTORIA_MUESTRAS, inicio,
+                                           muestras, NUM_VENTANAS, ESCALA_CARACTERISTICAS);
 
-            printf("Distancia DTW tres aplausos: %.4f\n", dtw_distance);
+            // Vecino más cercano: LB_Kim y LB_Keogh descartan plantillas antes del DTW con banda (de final
+            // abierto si la captura terminó por silencio)
+            struct Resultado_clasificacion resultado;
+            clasificar(&biblioteca, &caract_captura, &resultado);
 
-            printf("Distancia DTW dos aplausos: %.4f\n", dtw_distance_2);
-            IsShow = 1;
+            printf("Plantillas podadas: LB_Kim %d, LB_Keogh %d, DTW evaluados %d\n",
+                   resultado.podadas_kim, resultado.podadas_keogh, resultado.dtw_evaluados);
+            printf("FFT omitidas por la compuerta: %d de %d ventanas\n", extractor_captura.fft_omitidas,
+                   caract_captura.num_ventanas);
 
-            if ((dtw_distance > 0) && (dtw_distance < 4))
+            if ((resultado.indice >= 0) && (resultado.distancia > 0))
             {
-                led_state = !led_state;       // Cambiar el estado del LED
-                gpio_put(LED_PIN, led_state); // Actualizar el estado del LED
+                printf("Distancia DTW %s: %.4f (desplazamiento %d ventanas)\n", resultado.etiqueta,
+                       resultado.distancia, resultado.lag);
+                indice_verificado = resultado.indice;
             }
-
-            if ((dtw_distance_2 > 0) && (dtw_distance_2 < 3.3))
+            else
             {
-                led_state_2 = !led_state_2;       // Cambiar el estado del LED
-                gpio_put(LED_PIN_2, led_state_2); // Actualizar el estado del LED
+                printf("Patron no reconocido\n");
+                indice_verificado = -1;
+                nivel.disparos_falsos++;
             }
+            hay_verificacion = 1;
+            verificacion_muestra = contador.muestra;
+            imprimir_nivel();
 
-            // Reiniciar las banderas y el buffer
-            Flags_1.adc_avail = 0;
-            capture_start = 0; // Bandera para indicar cuándo comenzar a guardar.
-            capture_count = 0; // Contador de muestras capturadas después de cruzar el umbral.
-            IsProcess = 0;
-            IsShow = 0;
+            // Devolver la ranura a la adquisición y pasar a la siguiente
+            extractor_activo = 0;
+            ranura_estado[ranura_lectura] = RANURA_LIBRE;
+            ranura_lectura = (ranura_lectura + 1) % CAPTURA_RANURAS;
+        }
 
-            // Limpiar el buffer de muestras capturadas
-            memset(captured_samples, 0, sizeof(captured_samples));
+        // Un evento sin pareja vence: su captura se perdió o la secuencia del contador no disparó ninguna
+        uint32_t ahora = contador.muestra;
+        if (hay_conteo && !hay_verificacion && (ahora - conteo.fin > ESPERA_PAREJA_MUESTRAS))
+        {
+            printf("Conteo de %d aplausos sin verificacion DTW: descartado\n", conteo.cantidad);
+            hay_conteo = 0;
+        }
+        if (hay_verificacion && !hay_conteo && (ahora - verificacion_muestra > ESPERA_PAREJA_MUESTRAS))
+        {
+            printf("Verificacion DTW sin conteo: descartada\n");
+            hay_verificacion = 0;
         }
 
+        // El conteo y el DTW llegan en cualquier orden; se decide cuando están ambos
+        if (hay_conteo && hay_verificacion)
+        {
+            accion_plantilla_t accion = accion_por_conteo(conteo.cantidad);
+            if ((accion != NULL) && (indice_verificado >= 0) && (biblioteca.plantillas[indice_verificado].accion == accion))
+            {
+                accion();
+            }
+            else
+            {
+                printf("Conteo no confirmado por DTW\n");
+            }
+            hay_conteo = 0;
+            hay_verificacion = 0;
+        }
+#else
+        if (hay_conteo)
+        {
+            accion_plantilla_t accion = accion_por_conteo(conteo.cantidad);
+            if (accion != NULL)
+            {
+                accion();
+            }
+            hay_conteo = 0;
+        }
+#endif
+#endif
+
         if (Flags_1.LDR_is_high == 1)
         {
             gpio_put(LED_OUT_PIN, 1);
@@ -279,38 +640,372 @@ void ADC_initialize(uint ADC_GPIO)
     adc_gpio_init(ADC_GPIO);   // GPIO 26 como entrada analógica
     adc_select_input(0); // Selecciona el canal 0 del ADC
     adc_fifo_setup(
-        true,  // Habilita FIFO
-        false, // No usa DMA
-        1,     // Umbral de FIFO en 1
-        false, // No incluir errores en FIFO
-        false  // No reduce resolución a 8 bits
+        true,         // Habilita FIFO
+        ADC_USAR_DMA, // DREQ por muestra hacia el DMA (solo en modo DMA)
+        1,            // Umbral de FIFO en 1
+        false,        // No incluir errores en FIFO
+        false         // No reduce resolución a 8 bits
     );
 
     // Configurar el divisor del reloj para una FS de 8 kHz (48 MHz / 6000 = 8 kHz)
     adc_set_clkdiv((float)ADC_CLKDIV);
 
+#if ADC_USAR_DMA
+    // Dos canales encadenados: cada uno llena un bloque del anillo y arranca al otro, sin intervención de la CPU
+    canal_dma[0] = dma_claim_unused_channel(true);
+    canal_dma[1] = dma_claim_unused_channel(true);
+    for (int c = 0; c < 2; c++)
+    {
+        dma_channel_config cfg = dma_channel_get_default_config(canal_dma[c]);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+        channel_config_set_read_increment(&cfg, false); // Siempre el FIFO del ADC
+        channel_config_set_write_increment(&cfg, true);
+        channel_config_set_dreq(&cfg, DREQ_ADC);
+        channel_config_set_chain_to(&cfg, canal_dma[1 - c]);
+        bloque_canal[c] = c;
+        dma_channel_configure(canal_dma[c], &cfg, anillo_adc[c], &adc_hw->fifo, ANILLO_BLOQUE, false);
+        dma_channel_set_irq0_enabled(canal_dma[c], true);
+    }
+
+    // Notificación por bloque completo
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+    dma_channel_start(canal_dma[0]);
+#else
     // Configura la interrupción
     irq_set_exclusive_handler(ADC_IRQ_FIFO, adc_handler);
     irq_set_priority(ADC_IRQ_FIFO, PICO_HIGHEST_IRQ_PRIORITY);
     irq_set_enabled(ADC_IRQ_FIFO, true);
     adc_irq_set_enabled(true);
+#endif
 
     // Iniciar el ADC
     adc_run(true);
 }
 
+float normalizar_muestra(int centrada)
+{
+    // En float (no double): se llama por muestra en el modo continuo; las capturas se guardan sin normalizar
+    return (((centrada + ADC_CENTRO) * (float)ADC_CONVERT) - (float)REF_VOLTAGE) * (float)(1.0 / MAX_SIGNAL_AMPLITUDE);
+}
+
+void preparar_plantilla(const struct Plantilla_almacenada *p, int16_t *destino)
+{
+    struct Decimador dec;
+    int n = 0;
+    int32_t suma = 0;
+
+    // Inverso de normalizar_muestra(): de vuelta a códigos del ADC centrados
+    for (int i = 0; i < p->num_muestras; i++)
+    {
+        suma += lrintf((plantilla_muestra(p, i) * MAX_SIGNAL_AMPLITUDE + REF_VOLTAGE) / ADC_CONVERT) - ADC_CENTRO;
+    }
+    // La continua de la grabación se resta como nivel_adaptativo la resta a las capturas
+    int continua = suma / p->num_muestras;
+
+    // La grabación se recorta o se completa con silencio a la duración configurada de las capturas
+    decimador_iniciar(&dec);
+    for (int i = 0; (i < p->num_muestras) && (n < SAMPLES); i++)
+    {
+        int16_t centrada = (int16_t)(lrintf((plantilla_muestra(p, i) * MAX_SIGNAL_AMPLITUDE + REF_VOLTAGE) / ADC_CONVERT) - ADC_CENTRO - continua);
+        int16_t salida;
+        if (decimador_agregar(&dec, centrada, &salida))
+        {
+            destino[n++] = salida;
+        }
+    }
+    while (n < SAMPLES)
+    {
+        destino[n++] = 0;
+    }
+}
+
+void agregar_plantilla(const struct Plantilla_almacenada *p, float umbral, accion_plantilla_t accion)
+{
+    struct Extractor_STFT ext;
+    struct Caracteristicas caract;
+
+    preparar_plantilla(p, historia_muestras);
+    extractor_stft_iniciar(&ext, &caract, FS_CARACTERISTICAS);
+    extractor_stft_procesar_anillo(&ext, historia_muestras, HISTORIA_MUESTRAS, 0, SAMPLES, NUM_VENTANAS,
+                                   ESCALA_CARACTERISTICAS);
+    biblioteca_agregar_caracteristicas(&biblioteca, p->etiqueta, umbral, &caract, accion);
+
+    // Relación entre la característica y la suma de |x| en los silencios de la grabación (las ventanas bajo
+    // la energía media: los aplausos dominan la media), acumulada sobre todas las plantillas
+    int32_t energia[NUM_VENTANAS];
+    int64_t energia_total = 0;
+    for (int i = 0; i < NUM_VENTANAS; i++)
+    {
+        energia[i] = suma_absoluta_ventana(&historia_muestras[i * SALTO_VENTANA]);
+        energia_total += energia[i];
+    }
+    for (int i = 0; i < NUM_VENTANAS; i++)
+    {
+        if (energia[i] * (int64_t)NUM_VENTANAS <= energia_total)
+        {
+            piso_caracteristica += caract.amplitudes[i] / ESCALA_CARACTERISTICAS;
+            piso_energia += (float)energia[i];
+        }
+    }
+    relacion_piso = (piso_energia > 0.0f) ? piso_caracteristica / piso_energia : 0.0f;
+}
+
+accion_plantilla_t accion_por_conteo(int cantidad)
+{
+    switch (cantidad)
+    {
+    case 3:
+        return accion_luz_noche;
+    case 2:
+        return accion_luz_cuarto;
+    default:
+        return NULL;
+    }
+}
+
+void accion_luz_noche(void)
+{
+    led_state = !led_state;       // Cambiar el estado del LED
+    gpio_put(LED_PIN, led_state); // Actualizar el estado del LED
+}
+
+void accion_luz_cuarto(void)
+{
+    led_state_2 = !led_state_2;       // Cambiar el estado del LED
+    gpio_put(LED_PIN_2, led_state_2); // Actualizar el estado del LED
+}
+
 void adc_handler()
 {
     // Lee la muestra y marca como disponible
     adc_raw = adc_fifo_get();
     Flags_1.adc_avail = 1;
 
-    if (capture_count >= CAPTURE_LIMIT)
+    procesar_muestra_adc(adc_raw);
+}
+
+void dma_handler()
+{
+    for (int c = 0; c < 2; c++)
     {
-        Flags_1.adc_avail = 0;
+        int canal = canal_dma[c];
+        if (!dma_channel_get_irq0_status(canal))
+        {
+            continue;
+        }
+        dma_channel_acknowledge_irq0(canal);
+
+        // El otro canal ya está llenando el bloque siguiente; este se rearma (sin disparar) dos bloques más
+        // adelante. La cuenta de transferencias se recarga sola al encadenarse.
+        bloque_canal[c] = (bloque_canal[c] + 2) % ANILLO_BLOQUES;
+        dma_channel_set_write_addr(canal, anillo_adc[bloque_canal[c]], false);
+
+        // Las muestras las procesa el bucle principal (consumir_bloques_adc()), no la interrupción
+        bloques_dma++;
     }
 }
 
+void procesar_muestra_adc(int raw)
+{
+    // La continua y el umbral siguen a la sala; el contador y la captura usan los mismos
+    int centrada = nivel_adaptativo_procesar(&nivel, raw);
+    if (nivel.umbral != contador.umbral_inicio)
+    {
+        contador_aplausos_fijar_umbral(&contador, nivel.umbral);
+    }
+
+    // Conteo de aplausos en flujo: solo enteros, sin buffer
+    contador_aplausos_procesar(&contador, centrada);
+
+#if CAPTURA_EN_INTERRUPCION
+    capturar_muestra(centrada);
+#endif
+}
+
+const uint16_t *siguiente_bloque_adc(void)
+{
+    uint32_t completados = bloques_dma;
+    uint32_t pendientes = completados - bloques_consumidos;
+
+    if (pendientes == 0)
+    {
+        return NULL;
+    }
+
+    // El DMA escribe el bloque siguiente al último completo y tiene rearmado el de después: con más de
+    // ANILLO_BLOQUES - 2 pendientes los más antiguos ya se están sobrescribiendo
+    if (pendientes > ANILLO_BLOQUES - 2)
+    {
+        bloques_perdidos += pendientes - (ANILLO_BLOQUES - 2);
+        bloques_consumidos = completados - (ANILLO_BLOQUES - 2);
+    }
+
+    return anillo_adc[bloques_consumidos++ % ANILLO_BLOQUES];
+}
+
+void consumir_bloques_adc(void)
+{
+#if ADC_USAR_DMA
+    const uint16_t *bloque;
+    while ((bloque = siguiente_bloque_adc()) != NULL)
+    {
+        for (int i = 0; i < ANILLO_BLOQUE; i++)
+        {
+            procesar_muestra_adc(bloque[i]);
+        }
+    }
+#endif
+}
+
+void detectar_continuo(int raw)
+{
+    int16_t decimada;
+    if (!decimador_agregar(&decimador, (int16_t)(raw - nivel_adaptativo_dc(&nivel)), &decimada))
+    {
+        return;
+    }
+
+    struct Deteccion_continua deteccion;
+    if (detector_continuo_agregar(&detector, normalizar_muestra(decimada), &deteccion))
+    {
+        const struct Plantilla *reconocida = &biblioteca.plantillas[deteccion.indice];
+        printf("Distancia DTW %s: %.4f (ventanas %ld a %ld)\n", reconocida->etiqueta,
+               deteccion.coincidencia.distancia, (long)deteccion.coincidencia.t_ini,
+               (long)deteccion.coincidencia.t_fin);
+        reconocida->accion();
+    }
+}
+
+void capturar_muestra(int centrada)
+{
+    int r = ranura_escritura;
+    int16_t decimada;
+
+    if (perdida_restante > 0)
+    {
+        perdida_restante--;
+    }
+
+    // iniciar la captura, si valor supera el umbral, hay una ranura libre y suficiente historial previo
+    if (!capture_start && nivel_adaptativo_supera(&nivel, centrada) &&
+        (historia_validas >= MUESTRAS_PRE_DISPARO + TAMANO_VENTANA))
+    {
+        if (ranura_estado[r] == RANURA_LIBRE)
+        {
+            // La captura empieza en el historial ya escrito, alineada al salto para leer las ventanas sin copiar
+            int inicio = historia_posicion - MUESTRAS_PRE_DISPARO;
+            if (inicio < 0)
+            {
+                inicio += HISTORIA_MUESTRAS;
+            }
+            inicio -= inicio % SALTO_VENTANA;
+
+            int previas = historia_posicion - inicio;
+            if (previas < 0)
+            {
+                previas += HISTORIA_MUESTRAS;
+            }
+
+            ranura_inicio[r] = inicio;
+            ranura_muestras[r] = previas;
+            ranura_estado[r] = RANURA_CAPTURANDO;
+            silencio_muestras = 0;
+            hueco_max = 0;
+            pico_captura = 0;
+            capture_start = 1; // Activa la bandera para iniciar la captura
+            nivel.disparos++;
+        }
+        else if (perdida_restante == 0)
+        {
+            // Todas las ranuras esperan análisis: se cuenta una captura perdida por clip, no por muestra
+            capturas_perdidas++;
+            perdida_restante = SAMPLES_ADC;
+        }
+    }
+
+    // El decimador y el historial corren siempre, así el historial ya tiene el ataque cuando llega el disparo
+    if (!decimador_agregar(&decimador, (int16_t)centrada, &decimada))
+    {
+        return;
+    }
+
+    int posicion = historia_posicion;
+
+    // El historial no puede pisar una captura pendiente de análisis: se pierde la que está en curso
+    for (int i = 0; i < CAPTURA_RANURAS; i++)
+    {
+        if ((ranura_estado[i] == RANURA_LISTA) && (ranura_inicio[i] == posicion))
+        {
+            if (capture_start)
+            {
+                ranura_estado[r] = RANURA_LIBRE;
+                capture_start = 0;
+                capturas_perdidas++;
+            }
+            return;
+        }
+    }
+
+    historia_muestras[posicion] = decimada; // Sin flotantes por muestra: se normaliza por ventana
+    historia_posicion = (posicion + 1 < HISTORIA_MUESTRAS) ? posicion + 1 : 0;
+    if (historia_validas < HISTORIA_MUESTRAS)
+    {
+        historia_validas++;
+    }
+
+    if (!capture_start)
+    {
+        return;
+    }
+
+    int n = ranura_muestras[r] + 1;
+    ranura_muestras[r] = n;
+
+    // Silencio: la envolvente del contador bajo su nivel de rearme y SILENCIO_ATENUACION por debajo del pico,
+    // así la cola de reverberación de un aplauso fuerte no cuenta como sonido
+    int32_t envolvente = contador.envolvente;
+    if (envolvente > pico_captura)
+    {
+        pico_captura = envolvente;
+    }
+    if ((envolvente < contador.umbral_rearme) || (envolvente < (pico_captura >> SILENCIO_ATENUACION)))
+    {
+        silencio_muestras++;
+    }
+    else
+    {
+        if (silencio_muestras > hueco_max)
+        {
+            hueco_max = silencio_muestras;
+        }
+        silencio_muestras = 0;
+    }
+
+    // Un patrón lento necesita más silencio para darse por terminado
+    int silencio_fin = hueco_max + hueco_max / 2;
+    if (silencio_fin < MUESTRAS_SILENCIO_FIN)
+    {
+        silencio_fin = MUESTRAS_SILENCIO_FIN;
+    }
+
+    if ((n >= CAPTURE_LIMIT) || ((silencio_muestras >= silencio_fin) && (n >= TAMANO_VENTANA) && ((n - TAMANO_VENTANA) % SALTO_VENTANA == 0)))
+    {
+        ranura_estado[r] = RANURA_LISTA;
+        ranura_escritura = (r + 1) % CAPTURA_RANURAS;
+        capture_start = 0;
+    }
+}
+
+void imprimir_nivel(void)
+{
+    printf("Nivel: continua %d, piso de ruido %.1f, umbral %ld, disparos %lu (falsos %lu), inicios %lu, "
+           "secuencias descartadas %lu\n",
+           nivel_adaptativo_dc(&nivel), nivel.ruido / (float)(1 << NIVEL_RUIDO_Q), (long)nivel.umbral,
+           (unsigned long)nivel.disparos, (unsigned long)nivel.disparos_falsos,
+           (unsigned long)contador.inicios, (unsigned long)contador.descartadas);
+}
+
 void gpio_callback(uint gpio, uint32_t events)
 {
     if (gpio == IR_PIN)
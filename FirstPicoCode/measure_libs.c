@@ -1,15 +1,192 @@
 #include "measure_libs.h"
 
-/* Función FFT */
-void fft(int N, float real[], float imag[])
+// Buffers de trabajo de la FFT y de la STFT: estáticos y dimensionados por las tablas, en lugar de VLAs en la
+// pila. Solo el bucle principal calcula espectros, así no necesitan ser reentrantes
+#if FFT_USAR_Q15
+static int16_t fft_trabajo_real[FFT_TABLAS_MAX_SIZE];
+static int16_t fft_trabajo_imag[FFT_TABLAS_MAX_SIZE];
+#endif
+static float espectro_real[FFT_TABLAS_MAX_SIZE / 2 + 1];
+static float espectro_imag[FFT_TABLAS_MAX_SIZE / 2 + 1];
+
+/*
+ * Los núcleos de la FFT y de la STFT se escriben una vez con N como parámetro y se expanden siempre en
+ * línea: cada instancia de FFT_ESPECIALIZAR() los recibe con N constante, así el compilador fija los
+ * límites de los bucles, los pasos de las tablas y el desplazamiento de bits invertidos. Las funciones
+ * públicas solo despachan por tamaño.
+ */
+#define FFT_EN_LINEA static inline __attribute__((always_inline))
+
+/**
+ * @def FFT_TAMANOS
+ * @brief Tamaños con núcleo especializado: potencias de 2 desde 4 hasta FFT_TABLAS_MAX_SIZE (como máximo 1024).
+ */
+#if FFT_TABLAS_MAX_SIZE >= 1024
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32) X(64) X(128) X(256) X(512) X(1024)
+#elif FFT_TABLAS_MAX_SIZE >= 512
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32) X(64) X(128) X(256) X(512)
+#elif FFT_TABLAS_MAX_SIZE >= 256
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32) X(64) X(128) X(256)
+#elif FFT_TABLAS_MAX_SIZE >= 128
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32) X(64) X(128)
+#elif FFT_TABLAS_MAX_SIZE >= 64
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32) X(64)
+#elif FFT_TABLAS_MAX_SIZE >= 32
+#define FFT_TAMANOS(X) X(4) X(8) X(16) X(32)
+#elif FFT_TABLAS_MAX_SIZE >= 16
+#define FFT_TAMANOS(X) X(4) X(8) X(16)
+#elif FFT_TABLAS_MAX_SIZE >= 8
+#define FFT_TAMANOS(X) X(4) X(8)
+#elif FFT_TABLAS_MAX_SIZE >= 4
+#define FFT_TAMANOS(X) X(4)
+#else
+#define FFT_TAMANOS(X)
+#endif
+
+/* Desplazamiento que reduce la tabla de bits invertidos de FFT_TABLAS_MAX_SIZE a N puntos */
+static inline int desplazamiento_bitrev(int N)
+{
+    return FFT_TABLAS_LOG2_MAX - __builtin_ctz(N);
+}
+
+// Escala una salida de mariposa Q15 y lleva el máximo del bloque para decidir el escalado de la etapa siguiente
+FFT_EN_LINEA int16_t fft_q15_escalar(int32_t v, int shift, int32_t redondeo, int32_t *max_abs)
+{
+    v = (v + redondeo) >> shift;
+    int32_t a = (v < 0) ? -v : v;
+    if (a > *max_abs) *max_abs = a;
+    return (int16_t)v;
+}
+
+/* FFT en punto fijo Q15 con escalado por bloque */
+FFT_EN_LINEA int fft_q15_nucleo(const int N, int16_t real[], int16_t imag[])
+{
+    int i, j, k, m, step;
+    int exponente = 0;
+    int shift_bitrev = desplazamiento_bitrev(N);
+
+    // Reorganización en orden de bits invertidos (tabla en flash)
+    for (i = 0; i < N; i++)
+    {
+        j = fft_bitrev[i] >> shift_bitrev;
+        if (i < j)
+        {
+            int16_t tReal = real[i];
+            int16_t tImag = imag[i];
+            real[i] = real[j];
+            imag[i] = imag[j];
+            real[j] = tReal;
+            imag[j] = tImag;
+        }
+    }
+
+    // Máximo del bloque de entrada
+    int32_t max_abs = 0;
+    for (i = 0; i < N; i++)
+    {
+        int32_t a = real[i] < 0 ? -real[i] : real[i];
+        int32_t b = imag[i] < 0 ? -imag[i] : imag[i];
+        if (a > max_abs) max_abs = a;
+        if (b > max_abs) max_abs = b;
+    }
+
+    step = 2;
+    if (N >= 4)
+    {
+        // Etapas 1 y 2 en una sola pasada radix-4: los factores de giro son 1 y -i, sin multiplicaciones.
+        // Cada salida es suma o resta de cuatro entradas, así crece como máximo 4 veces por componente
+        int shift = 0;
+        if (max_abs >= 16384)
+        {
+            shift = 2;
+        }
+        else if (max_abs >= 8192)
+        {
+            shift = 1;
+        }
+        int32_t redondeo = shift ? (1 << (shift - 1)) : 0;
+        exponente += shift;
+        max_abs = 0;
+
+        for (k = 0; k < N; k += 4)
+        {
+            int32_t a0Real = real[k] + real[k + 1], a0Imag = imag[k] + imag[k + 1];
+            int32_t a1Real = real[k] - real[k + 1], a1Imag = imag[k] - imag[k + 1];
+            int32_t a2Real = real[k + 2] + real[k + 3], a2Imag = imag[k + 2] + imag[k + 3];
+            int32_t a3Real = real[k + 2] - real[k + 3], a3Imag = imag[k + 2] - imag[k + 3];
+
+            // Segunda etapa: (k, k + 2) con factor 1 y (k + 1, k + 3) con factor -i
+            real[k] = fft_q15_escalar(a0Real + a2Real, shift, redondeo, &max_abs);
+            imag[k] = fft_q15_escalar(a0Imag + a2Imag, shift, redondeo, &max_abs);
+            real[k + 1] = fft_q15_escalar(a1Real + a3Imag, shift, redondeo, &max_abs);
+            imag[k + 1] = fft_q15_escalar(a1Imag - a3Real, shift, redondeo, &max_abs);
+            real[k + 2] = fft_q15_escalar(a0Real - a2Real, shift, redondeo, &max_abs);
+            imag[k + 2] = fft_q15_escalar(a0Imag - a2Imag, shift, redondeo, &max_abs);
+            real[k + 3] = fft_q15_escalar(a1Real - a3Imag, shift, redondeo, &max_abs);
+            imag[k + 3] = fft_q15_escalar(a1Imag + a3Real, shift, redondeo, &max_abs);
+        }
+        step = 8;
+    }
+
+    // Etapas restantes de la FFT
+    for (; step <= N; step *= 2)
+    {
+        // Una mariposa crece como máximo 1 + sqrt(2) veces por componente: |a| + |w b| con |w b| <= sqrt(2) max.
+        // Los umbrales son 2^15 / (2 sqrt(2)) y el doble: bajo ellos la salida escalada queda por debajo de
+        // 2^15 (1 + sqrt(2)) / (2 sqrt(2)) ~ 0.85 * 2^15, con margen para el redondeo del producto por el giro
+        int shift = 0;
+        if (max_abs >= 23170)
+        {
+            shift = 2;
+        }
+        else if (max_abs >= 11585)
+        {
+            shift = 1;
+        }
+        int32_t redondeo = shift ? (1 << (shift - 1)) : 0;
+        exponente += shift;
+        max_abs = 0;
+
+        int paso_twiddle = FFT_TABLAS_MAX_SIZE / step;
+
+        for (k = 0; k < N; k += step)
+        {
+            for (j = 0; j < step / 2; j++)
+            {
+                i = k + j;
+                m = i + step / 2;
+
+                int32_t wReal = fft_twiddle_q15_real[j * paso_twiddle];
+                int32_t wImag = fft_twiddle_q15_imag[j * paso_twiddle];
+
+                int32_t tReal = (wReal * real[m] - wImag * imag[m] + (1 << 14)) >> 15;
+                int32_t tImag = (wReal * imag[m] + wImag * real[m] + (1 << 14)) >> 15;
+
+                int32_t aReal = real[i];
+                int32_t aImag = imag[i];
+
+                real[i] = fft_q15_escalar(aReal + tReal, shift, redondeo, &max_abs);
+                imag[i] = fft_q15_escalar(aImag + tImag, shift, redondeo, &max_abs);
+                real[m] = fft_q15_escalar(aReal - tReal, shift, redondeo, &max_abs);
+                imag[m] = fft_q15_escalar(aImag - tImag, shift, redondeo, &max_abs);
+            }
+        }
+    }
+
+    return exponente;
+}
+
+/* FFT en punto flotante */
+FFT_EN_LINEA void fft_float_nucleo(const int N, float real[], float imag[])
 {
-    int i, j, k, m, n, step;
-    float tReal, tImag, uReal, uImag, wReal, wImag, angle;
+    int i, j, k, m, step;
+    float tReal, tImag, uReal, uImag;
+    int shift_bitrev = desplazamiento_bitrev(N);
 
-    // Reorganización en orden de bits invertidos
-    j = 0;
+    // Reorganización en orden de bits invertidos (tabla en flash)
     for (i = 0; i < N; i++)
     {
+        j = fft_bitrev[i] >> shift_bitrev;
         if (i < j)
         {
             // Intercambio de datos
@@ -20,32 +197,47 @@ void fft(int N, float real[], float imag[])
             real[j] = tReal;
             imag[j] = tImag;
         }
-        m = N / 2;
-        while (j >= m && m >= 2)
+    }
+
+    step = 2;
+    if (N >= 4)
+    {
+        // Etapas 1 y 2 en una sola pasada radix-4 con factores de giro 1 y -i
+        for (k = 0; k < N; k += 4)
         {
-            j -= m;
-            m /= 2;
+            float a0Real = real[k] + real[k + 1], a0Imag = imag[k] + imag[k + 1];
+            float a1Real = real[k] - real[k + 1], a1Imag = imag[k] - imag[k + 1];
+            float a2Real = real[k + 2] + real[k + 3], a2Imag = imag[k + 2] + imag[k + 3];
+            float a3Real = real[k + 2] - real[k + 3], a3Imag = imag[k + 2] - imag[k + 3];
+
+            real[k] = a0Real + a2Real;
+            imag[k] = a0Imag + a2Imag;
+            real[k + 1] = a1Real + a3Imag;
+            imag[k + 1] = a1Imag - a3Real;
+            real[k + 2] = a0Real - a2Real;
+            imag[k + 2] = a0Imag - a2Imag;
+            real[k + 3] = a1Real - a3Imag;
+            imag[k + 3] = a1Imag + a3Real;
         }
-        j += m;
+        step = 8;
     }
 
-    // Etapas de la FFT
-    for (step = 2; step <= N; step *= 2)
+    // Etapas restantes de la FFT
+    for (; step <= N; step *= 2)
     {
-        angle = -2.0 * PI / step;
-        wReal = cos(angle);
-        wImag = sin(angle);
+        int paso_twiddle = FFT_TABLAS_MAX_SIZE / step;
 
         for (k = 0; k < N; k += step)
         {
-            uReal = 1.0;
-            uImag = 0.0;
-
             for (j = 0; j < step / 2; j++)
             {
                 i = k + j;
                 m = i + step / 2;
 
+                // Factor de giro leído de la tabla (sin trigonometría en tiempo de ejecución)
+                uReal = fft_twiddle_real[j * paso_twiddle];
+                uImag = fft_twiddle_imag[j * paso_twiddle];
+
                 tReal = uReal * real[m] - uImag * imag[m];
                 tImag = uReal * imag[m] + uImag * real[m];
 
@@ -54,161 +246,1267 @@ void fft(int N, float real[], float imag[])
 
                 real[i] += tReal;
                 imag[i] += tImag;
-
-                // Actualización del factor de rotación
-                tReal = uReal * wReal - uImag * wImag;
-                uImag = uReal * wImag + uImag * wReal;
-                uReal = tReal;
             }
         }
     }
 }
 
-/* Cálculo de magnitud */
-void calculate_magnitude(int N, float real[], float imag[], float mag[])
+/* Una instancia de cada núcleo por tamaño de FFT_TAMANOS */
+#define FFT_ESPECIALIZAR(N)                                     \
+    static int fft_q15_##N(int16_t real[], int16_t imag[])      \
+    {                                                           \
+        return fft_q15_nucleo(N, real, imag);                   \
+    }                                                           \
+    static void fft_float_##N(float real[], float imag[])       \
+    {                                                           \
+        fft_float_nucleo(N, real, imag);                        \
+    }
+
+FFT_TAMANOS(FFT_ESPECIALIZAR)
+
+// Despacho por tamaño; con N constante se reduce a la llamada directa a la instancia
+FFT_EN_LINEA int fft_q15_despachar(const int N, int16_t real[], int16_t imag[])
 {
-    for (int i = 0; i < N; i++)
+    switch (N)
     {
-        mag[i] = sqrt(real[i] * real[i] + imag[i] * imag[i]);
+#define FFT_CASO_Q15(n) case n: return fft_q15_##n(real, imag);
+        FFT_TAMANOS(FFT_CASO_Q15)
+#undef FFT_CASO_Q15
+    default:
+        return fft_q15_generica(N, real, imag);
     }
 }
 
-void graficar_amplitud_promedio_frecuencia(float *array, float frecuencia_muestreo, int tamano_ventana, float *amplitudes_promedio, float *indices_tiempo)
+FFT_EN_LINEA void fft_float_despachar(const int N, float real[], float imag[])
 {
-    // Calcular el número de ventanas
-    int num_ventanas = SAMPLES/tamano_ventana;
-
-    // Procesar cada ventana
-    for (int i = 0; i < num_ventanas; i++)
+    switch (N)
     {
-        // Índices para la ventana actual
-        int inicio = i * tamano_ventana;
-        int fin = inicio + tamano_ventana;
+#define FFT_CASO_FLOAT(n) case n: fft_float_##n(real, imag); return;
+        FFT_TAMANOS(FFT_CASO_FLOAT)
+#undef FFT_CASO_FLOAT
+    default:
+        fft_float_generica(N, real, imag);
+        return;
+    }
+}
 
-        // Crear arrays para la ventana actual (estáticos, de tamaño fijo)
-        float ventana_real[tamano_ventana];
-        float ventana_imag[tamano_ventana];
+int fft_q15(int N, int16_t real[], int16_t imag[])
+{
+    return fft_q15_despachar(N, real, imag);
+}
 
-        // Copiar los datos de la ventana a los arrays de la FFT
-        for (int j = 0; j < tamano_ventana; j++)
-        {
-            ventana_real[j] = array[inicio + j];
-            ventana_imag[j] = 0.0f; // Inicializar la parte imaginaria a 0
-        }
+int fft_q15_generica(int N, int16_t real[], int16_t imag[])
+{
+    return fft_q15_nucleo(N, real, imag);
+}
 
-        // Calcular la FFT de la ventana
-        fft(tamano_ventana, ventana_real, ventana_imag);
+void fft_float(int N, float real[], float imag[])
+{
+    fft_float_despachar(N, real, imag);
+}
 
-        // Calcular la magnitud de las frecuencias y la amplitud promedio
-        float suma_magnitudes = 0.0f;
-        float mag[tamano_ventana];
-        calculate_magnitude(tamano_ventana, ventana_real, ventana_imag, mag);
+void fft_float_generica(int N, float real[], float imag[])
+{
+    fft_float_nucleo(N, real, imag);
+}
 
-        float Promedio = 0;
-        for (int i = 0; i < tamano_ventana; i++)
-        {
-            Promedio+=mag[i];
-        }
-        amplitudes_promedio[i] = Promedio/tamano_ventana;
+/* FFT compleja: despacha al motor seleccionado por FFT_USAR_Q15 */
+FFT_EN_LINEA void fft_nucleo(const int N, float real[], float imag[])
+{
+#if FFT_USAR_Q15
+    int16_t *real_q15 = fft_trabajo_real;
+    int16_t *imag_q15 = fft_trabajo_imag;
 
-        // Calcular el índice de tiempo para esta ventana
-        indices_tiempo[i] = (float)(inicio + tamano_ventana / 2) / frecuencia_muestreo;
+    // Escalado de bloque a la entrada: el máximo queda en [0.5, 1) de Q15
+    float max_abs = 0.0f;
+    for (int i = 0; i < N; i++)
+    {
+        max_abs = fmaxf(max_abs, fmaxf(fabsf(real[i]), fabsf(imag[i])));
+    }
+    if (max_abs == 0.0f)
+    {
+        return; // La FFT de una señal nula es nula
     }
 
-    printf("Indice\tMagnitud\n");
-    for (int i = 0; i < SAMPLES / TAMANO_VENTANA; i++)
+    int exponente_entrada;
+    frexpf(max_abs, &exponente_entrada);
+    float escala = ldexpf(1.0f, 15 - exponente_entrada);
+
+    for (int i = 0; i < N; i++)
     {
-        printf("%.5f\t\t%.2f\n", indices_tiempo[i], amplitudes_promedio[i]);
+        real_q15[i] = (int16_t)fmaxf(fminf(lrintf(real[i] * escala), 32767.0f), -32768.0f);
+        imag_q15[i] = (int16_t)fmaxf(fminf(lrintf(imag[i] * escala), 32767.0f), -32768.0f);
     }
 
+    int exponente = fft_q15_despachar(N, real_q15, imag_q15);
 
+    float escala_salida = ldexpf(1.0f, exponente - (15 - exponente_entrada));
+    for (int i = 0; i < N; i++)
+    {
+        real[i] = real_q15[i] * escala_salida;
+        imag[i] = imag_q15[i] * escala_salida;
+    }
+#else
+    fft_float_despachar(N, real, imag);
+#endif
 }
 
-// Función para calcular la norma euclidiana
-float calcular_norma(const float* arr, int size) {
-    float suma = 0.0;
-    for (int i = 0; i < size; i++) {
-        suma += arr[i] * arr[i];
+void fft(int N, float real[], float imag[])
+{
+    fft_nucleo(N, real, imag);
+}
+
+/* FFT de señal real: FFT compleja de N/2 puntos más post-procesamiento con factores de giro */
+// Separa los espectros par/impar de la FFT compleja de N/2 puntos de las muestras empaquetadas
+FFT_EN_LINEA void rfft_separar(const int N, float real[], float imag[])
+{
+    int mitad = N / 2;
+    int paso_twiddle = FFT_TABLAS_MAX_SIZE / N;
+
+    // Bins 0 y N/2 (puramente reales)
+    float z0_real = real[0];
+    float z0_imag = imag[0];
+    real[0] = z0_real + z0_imag;
+    imag[0] = 0.0f;
+    real[mitad] = z0_real - z0_imag;
+    imag[mitad] = 0.0f;
+
+    // Separar los espectros par/impar por parejas (k, N/2 - k), en el mismo buffer
+    for (int k = 1; k <= mitad / 2; k++)
+    {
+        int k2 = mitad - k;
+        float a_real = real[k], a_imag = imag[k];
+        float b_real = real[k2], b_imag = imag[k2];
+
+        // Espectro par: (Z[k] + conj(Z[N/2-k])) / 2, impar: (Z[k] - conj(Z[N/2-k])) / 2i
+        float par_real = 0.5f * (a_real + b_real);
+        float par_imag = 0.5f * (a_imag - b_imag);
+        float impar_real = 0.5f * (a_imag + b_imag);
+        float impar_imag = -0.5f * (a_real - b_real);
+
+        float w_real = fft_twiddle_real[k * paso_twiddle];
+        float w_imag = fft_twiddle_imag[k * paso_twiddle];
+        float t_real = w_real * impar_real - w_imag * impar_imag;
+        float t_imag = w_real * impar_imag + w_imag * impar_real;
+
+        real[k] = par_real + t_real;
+        imag[k] = par_imag + t_imag;
+
+        // X[N/2-k] = conj(par) - conj(W^k * impar) * (-1), usando W^(N/2-k) = -conj(W^k)
+        real[k2] = par_real - t_real;
+        imag[k2] = -par_imag + t_imag;
     }
-    return sqrt(suma);
 }
 
-// Función para calcular la correlación cruzada normalizada
-void calcular_correlacion_cruzada(const float* x, const float* y, int size) {
-    
-    // Arreglo para almacenar la correlación cruzada
-    int resultado_size = 2 * size - 1;
-    float resultado[resultado_size];
-    
-    float norma_x = calcular_norma(x, size);
-    float norma_y = calcular_norma(y, size);
+FFT_EN_LINEA void rfft_nucleo(const int N, const float x[], float real[], float imag[])
+{
+    int mitad = N / 2;
 
-    for (int lag = -size + 1; lag < size; lag++) {
-        float suma = 0.0;
+    // Empaquetar muestras pares en la parte real e impares en la imaginaria
+    for (int n = 0; n < mitad; n++)
+    {
+        real[n] = x[2 * n];
+        imag[n] = x[2 * n + 1];
+    }
 
-        for (int i = 0; i < size; i++) {
-            int j = i + lag;
-            if (j >= 0 && j < size) {
-                suma += x[i] * y[j];
-            }
+    fft_nucleo(mitad, real, imag);
+    rfft_separar(N, real, imag);
+}
+
+void rfft(int N, const float x[], float real[], float imag[])
+{
+    rfft_nucleo(N, x, real, imag);
+}
+
+FFT_EN_LINEA void rfft_enteros_nucleo(const int N, const int16_t x[], float real[], float imag[])
+{
+    int mitad = N / 2;
+
+#if FFT_USAR_Q15
+    int16_t *real_q15 = fft_trabajo_real;
+    int16_t *imag_q15 = fft_trabajo_imag;
+
+    // Escalado de bloque por desplazamiento: el máximo queda en [0.5, 1) de Q15, sin pasar por flotante
+    int max_abs = 0;
+    for (int n = 0; n < N; n++)
+    {
+        int v = (x[n] < 0) ? -x[n] : x[n];
+        max_abs = (v > max_abs) ? v : max_abs;
+    }
+    if (max_abs == 0)
+    {
+        for (int k = 0; k <= mitad; k++)
+        {
+            real[k] = 0.0f;
+            imag[k] = 0.0f;
         }
+        return;
+    }
+    int desplazamiento = 0;
+    while ((max_abs << (desplazamiento + 1)) <= 32767)
+    {
+        desplazamiento++;
+    }
 
-        int idx = lag + size - 1;  // Ajustar índice para el resultado
-        resultado[idx] = suma / (norma_x * norma_y);
+    for (int n = 0; n < mitad; n++)
+    {
+        real_q15[n] = (int16_t)(x[2 * n] * (1 << desplazamiento));
+        imag_q15[n] = (int16_t)(x[2 * n + 1] * (1 << desplazamiento));
     }
 
-    // Mostrar resultados
-    for (int i = 0; i < resultado_size; i++) {
-        printf("Lag %d: %f\n", i - (size - 1), resultado[i]);
+    int exponente = fft_q15_despachar(mitad, real_q15, imag_q15);
+
+    float escala_salida = ldexpf(1.0f, exponente - desplazamiento);
+    for (int n = 0; n < mitad; n++)
+    {
+        real[n] = real_q15[n] * escala_salida;
+        imag[n] = imag_q15[n] * escala_salida;
+    }
+#else
+    for (int n = 0; n < mitad; n++)
+    {
+        real[n] = x[2 * n];
+        imag[n] = x[2 * n + 1];
     }
+    fft_nucleo(mitad, real, imag);
+#endif
 
-    int index_max;
-    float max_val = calcular_maximo(resultado, resultado_size, &index_max);
+    rfft_separar(N, real, imag);
+}
 
-    // Imprimir el valor máximo y su índice
-    printf("Valor máximo: %.5f\n", max_val);
-    printf("Índice del valor máximo: %d\n", index_max);
+void rfft_enteros(int N, const int16_t x[], float real[], float imag[])
+{
+    rfft_enteros_nucleo(N, x, real, imag);
+}
 
+/* Cálculo de magnitud */
+void calculate_magnitude(int N, float real[], float imag[], float mag[])
+{
+    for (int i = 0; i < N; i++)
+    {
+        mag[i] = magnitud(real[i], imag[i]);
+    }
 }
 
-// Función para calcular el valor máximo de un vector de floats
-float calcular_maximo(float* vector, int length, int* index_max) {
-    float max_val = vector[0]; // Suponemos que el primer valor es el máximo inicialmente
-    *index_max = 0; // El índice del valor máximo
-    for (int i = 1; i < length; i++) {
-        if (vector[i] > max_val) {
-            max_val = vector[i];
-            *index_max = i; // Actualizamos el índice cuando encontramos un nuevo máximo
-        }
+// Promedio de la magnitud sobre el espectro completo a partir de sus N/2 + 1 bins no redundantes
+FFT_EN_LINEA float promedio_espectro(const int tamano_ventana, const float ventana_real[], const float ventana_imag[])
+{
+    int num_bins = tamano_ventana / 2 + 1;
+
+    // Los bins 1..N/2-1 aparecen dos veces en el espectro completo (simetría conjugada)
+    float Promedio = magnitud(ventana_real[0], ventana_imag[0]) +
+                     magnitud(ventana_real[num_bins - 1], ventana_imag[num_bins - 1]);
+    for (int k = 1; k < num_bins - 1; k++)
+    {
+        Promedio += 2.0f * magnitud(ventana_real[k], ventana_imag[k]);
     }
-    return max_val; // Devuelve el valor máximo
+    return Promedio / tamano_ventana;
 }
 
-// Función para calcular DTW con float y matriz fija
-float dtw(float *s1, int n, float *s2, int m) {
-    float dtw_matrix[MAX_SIZE][MAX_SIZE];
+// Amplitud promedio de una ventana sobre los buffers estáticos del espectro
+FFT_EN_LINEA float amplitud_promedio_nucleo(const int tamano_ventana, const float *ventana)
+{
+    // Calcular la FFT real de la ventana directamente sobre la señal (solo los bins no redundantes)
+    rfft_nucleo(tamano_ventana, ventana, espectro_real, espectro_imag);
+    return promedio_espectro(tamano_ventana, espectro_real, espectro_imag);
+}
 
+FFT_EN_LINEA float amplitud_promedio_enteros_nucleo(const int tamano_ventana, const int16_t *ventana)
+{
+    rfft_enteros_nucleo(tamano_ventana, ventana, espectro_real, espectro_imag);
+    return promedio_espectro(tamano_ventana, espectro_real, espectro_imag);
+}
 
-    // Inicializar la matriz con valores "infinito" (FLT_MAX)
-    for (int i = 0; i <= n; i++) {
-        for (int j = 0; j <= m; j++) {
-            dtw_matrix[i][j] = INF;
-        }
+float amplitud_promedio_ventana(int tamano_ventana, const float *ventana)
+{
+    // La STFT del reconocedor usa siempre TAMANO_VENTANA: ese tamaño tiene su propia instancia del núcleo
+    if (tamano_ventana == TAMANO_VENTANA)
+    {
+        return amplitud_promedio_nucleo(TAMANO_VENTANA, ventana);
     }
-    dtw_matrix[0][0] = 0;
+    return amplitud_promedio_nucleo(tamano_ventana, ventana);
+}
 
-    // Calcular matriz de distancias acumuladas
-    for (int i = 1; i <= n; i++) {
-        for (int j = 1; j <= m; j++) {
-            float cost = (s1[i - 1] - s2[j - 1]) * (s1[i - 1] - s2[j - 1]); // Diferencia al cuadrado
-            dtw_matrix[i][j] = cost + fminf(fminf(
-                dtw_matrix[i - 1][j],    // Arriba
-                dtw_matrix[i][j - 1]),   // Izquierda
-                dtw_matrix[i - 1][j - 1] // Diagonal
-            );
+float amplitud_promedio_ventana_enteros(int tamano_ventana, const int16_t *ventana)
+{
+    if (tamano_ventana == TAMANO_VENTANA)
+    {
+        return amplitud_promedio_enteros_nucleo(TAMANO_VENTANA, ventana);
+    }
+    return amplitud_promedio_enteros_nucleo(tamano_ventana, ventana);
+}
+
+// Suma de las magnitudes de los bins de Goertzel, en las unidades de x (|x| <= 2^GOERTZEL_Q, ver energia_bandas_goertzel())
+static float goertzel_suma_magnitudes(const int16_t *x)
+{
+    float suma = 0.0f;
+    for (int b = 0; b < GOERTZEL_NUM_BANDAS; b++)
+    {
+        int32_t coef = goertzel_coef_q14[b];
+        int32_t s1 = 0, s2 = 0;
+        for (int n = 0; n < TAMANO_VENTANA; n++)
+        {
+            int32_t s0 = x[n] + ((coef * s1) >> 14) - s2;
+            s2 = s1;
+            s1 = s0;
         }
+
+        // |X[k]|^2 = s1^2 + s2^2 - coef*s1*s2; solo una vez por banda, en flotante para no desbordar
+        float f1 = (float)s1, f2 = (float)s2;
+        float potencia = f1 * f1 + f2 * f2 - (coef * (1.0f / 16384.0f)) * f1 * f2;
+        suma += sqrtf(fmaxf(potencia, 0.0f));
     }
+    return suma;
+}
 
-    // Resultado final: raíz cuadrada de la suma acumulada
-    return sqrtf(dtw_matrix[n][m]);
-}
\ No newline at end of file
+float energia_bandas_goertzel(const float *ventana)
+{
+    int16_t x[TAMANO_VENTANA];
+    float max_abs = 0.0f;
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        max_abs = fmaxf(max_abs, fabsf(ventana[n]));
+    }
+    if (max_abs == 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // Escalado de bloque por potencia de 2: el máximo queda en [2^(GOERTZEL_Q - 1), 2^GOERTZEL_Q), así las
+    // ventanas silenciosas conservan la misma resolución relativa que las fuertes
+    int exponente;
+    frexpf(max_abs, &exponente);
+    float escala = ldexpf(1.0f, GOERTZEL_Q - exponente);
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        x[n] = (int16_t)lrintf(ventana[n] * escala);
+    }
+
+    return goertzel_suma_magnitudes(x) / (GOERTZEL_NUM_BANDAS * escala);
+}
+
+float energia_bandas_goertzel_enteros(const int16_t *ventana)
+{
+    int16_t x[TAMANO_VENTANA];
+    int max_abs = 0;
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        int v = (ventana[n] < 0) ? -ventana[n] : ventana[n];
+        max_abs = (v > max_abs) ? v : max_abs;
+    }
+
+    // Mismo rango de entrada que la versión flotante (|x| <= 2^GOERTZEL_Q): sin desbordar el estado de 32 bits
+    int desplazamiento = 0;
+    while ((max_abs >> desplazamiento) > (1 << GOERTZEL_Q))
+    {
+        desplazamiento++;
+    }
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        x[n] = (int16_t)(ventana[n] >> desplazamiento);
+    }
+
+    return goertzel_suma_magnitudes(x) * (float)(1 << desplazamiento) / GOERTZEL_NUM_BANDAS;
+}
+
+float caracteristica_ventana(const float *ventana)
+{
+#if CARACTERISTICA_GOERTZEL
+    return energia_bandas_goertzel(ventana);
+#else
+    return amplitud_promedio_nucleo(TAMANO_VENTANA, ventana);
+#endif
+}
+
+float caracteristica_ventana_enteros(const int16_t *ventana)
+{
+#if CARACTERISTICA_GOERTZEL
+    return energia_bandas_goertzel_enteros(ventana);
+#else
+    return amplitud_promedio_enteros_nucleo(TAMANO_VENTANA, ventana);
+#endif
+}
+
+void extractor_stft_iniciar(struct Extractor_STFT *ext, struct Caracteristicas *caract, float frecuencia_muestreo)
+{
+    ext->caract = caract;
+    ext->frecuencia_muestreo = frecuencia_muestreo;
+    ext->ventanas_procesadas = 0;
+    ext->compuerta = 0;
+    ext->relacion_piso = 0.0f;
+    ext->fft_omitidas = 0;
+    caract->num_ventanas = 0;
+}
+
+void extractor_stft_fijar_compuerta(struct Extractor_STFT *ext, int32_t compuerta, float relacion_piso)
+{
+    ext->compuerta = compuerta;
+    ext->relacion_piso = relacion_piso;
+}
+
+int32_t suma_absoluta_ventana(const int16_t *ventana)
+{
+    int32_t suma = 0;
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        suma += (ventana[n] < 0) ? -ventana[n] : ventana[n];
+    }
+    return suma;
+}
+
+// Desplazamiento de la próxima ventana de la captura, o -1 si aún no está completa o se agotó el presupuesto
+static int extractor_siguiente_ventana(const struct Extractor_STFT *ext, int disponibles, int max_ventanas)
+{
+    int desplazamiento = ext->ventanas_procesadas * SALTO_VENTANA;
+    if ((ext->ventanas_procesadas >= NUM_VENTANAS) || (max_ventanas <= 0) ||
+        (desplazamiento + TAMANO_VENTANA > disponibles))
+    {
+        return -1; // La ventana aún se está llenando
+    }
+    return desplazamiento;
+}
+
+// Registra la característica de la ventana que empieza en desplazamiento
+static void extractor_guardar(struct Extractor_STFT *ext, int desplazamiento, float valor)
+{
+    struct Caracteristicas *caract = ext->caract;
+    int i = ext->ventanas_procesadas++;
+
+    caract->amplitudes[i] = valor;
+    caract->indices_tiempo[i] = (float)(desplazamiento + TAMANO_VENTANA / 2) / ext->frecuencia_muestreo;
+    caract->num_ventanas = ext->ventanas_procesadas;
+}
+
+int extractor_stft_procesar(struct Extractor_STFT *ext, const float *muestras, int disponibles, int max_ventanas)
+{
+    int desplazamiento;
+
+    // Procesar solo ventanas completas, sin exceder el presupuesto de esta llamada
+    while ((desplazamiento = extractor_siguiente_ventana(ext, disponibles, max_ventanas--)) >= 0)
+    {
+        extractor_guardar(ext, desplazamiento, caracteristica_ventana(&muestras[desplazamiento]));
+    }
+
+    return ext->ventanas_procesadas >= NUM_VENTANAS;
+}
+
+int extractor_stft_procesar_anillo(struct Extractor_STFT *ext, const int16_t *anillo, int tamano_anillo, int inicio,
+                                   int disponibles, int max_ventanas, float escala)
+{
+    int desplazamiento;
+
+    while ((desplazamiento = extractor_siguiente_ventana(ext, disponibles, max_ventanas--)) >= 0)
+    {
+        // La característica es lineal en la amplitud, así la normalización es una multiplicación por
+        // ventana y no por muestra
+        int posicion = (inicio + desplazamiento) % tamano_anillo;
+        const int16_t *ventana = &anillo[posicion];
+        float valor;
+
+        // Con ventanas alineadas la posición nunca parte una ventana; si la parte, se junta en una copia
+        if (posicion + TAMANO_VENTANA > tamano_anillo)
+        {
+            static int16_t partida[TAMANO_VENTANA];
+            int primera = tamano_anillo - posicion;
+            memcpy(partida, &anillo[posicion], primera * sizeof(int16_t));
+            memcpy(&partida[primera], anillo, (TAMANO_VENTANA - primera) * sizeof(int16_t));
+            ventana = partida;
+        }
+
+        // Compuerta de energía: un silencio se resuelve con la suma de |x| que ya costó calcular, sin FFT
+        int32_t suma = (ext->compuerta > 0) ? suma_absoluta_ventana(ventana) : 0;
+        if (suma < ext->compuerta)
+        {
+            valor = ext->relacion_piso * (float)suma;
+            ext->fft_omitidas++;
+        }
+        else
+        {
+            valor = caracteristica_ventana_enteros(ventana);
+        }
+        extractor_guardar(ext, desplazamiento, valor * escala);
+    }
+
+    return ext->ventanas_procesadas >= NUM_VENTANAS;
+}
+
+void extraer_caracteristicas(const float *array, float frecuencia_muestreo, struct Caracteristicas *caract)
+{
+    struct Extractor_STFT ext;
+    extractor_stft_iniciar(&ext, caract, frecuencia_muestreo);
+    extractor_stft_procesar(&ext, array, SAMPLES, NUM_VENTANAS);
+}
+
+int graficar_amplitud_promedio_frecuencia(const float *array, int num_muestras, float frecuencia_muestreo, int tamano_ventana,
+                                          int salto, float *amplitudes_promedio, float *indices_tiempo)
+{
+    // Calcular el número de ventanas completas que caben en la señal
+    int num_ventanas = (num_muestras < tamano_ventana) ? 0 : (num_muestras - tamano_ventana) / salto + 1;
+
+    // Procesar cada ventana
+    for (int i = 0; i < num_ventanas; i++)
+    {
+        // Índices para la ventana actual
+        int inicio = i * salto;
+
+        amplitudes_promedio[i] = amplitud_promedio_ventana(tamano_ventana, &array[inicio]);
+
+        // Calcular el índice de tiempo para esta ventana
+        indices_tiempo[i] = (float)(inicio + tamano_ventana / 2) / frecuencia_muestreo;
+    }
+
+    printf("Indice\tMagnitud\n");
+    for (int i = 0; i < num_ventanas; i++)
+    {
+        printf("%.5f\t\t%.2f\n", indices_tiempo[i], amplitudes_promedio[i]);
+    }
+
+    return num_ventanas;
+}
+
+// Función para calcular la norma euclidiana
+float calcular_norma(const float* arr, int size) {
+    float suma = 0.0;
+    for (int i = 0; i < size; i++) {
+        suma += arr[i] * arr[i];
+    }
+    return sqrt(suma);
+}
+
+// Función para calcular la correlación cruzada normalizada
+void calcular_correlacion_cruzada(const float* x, const float* y, int size) {
+    
+    // Arreglo para almacenar la correlación cruzada
+    int resultado_size = 2 * size - 1;
+    float resultado[resultado_size];
+    
+    float norma_x = calcular_norma(x, size);
+    float norma_y = calcular_norma(y, size);
+
+    for (int lag = -size + 1; lag < size; lag++) {
+        float suma = 0.0;
+
+        for (int i = 0; i < size; i++) {
+            int j = i + lag;
+            if (j >= 0 && j < size) {
+                suma += x[i] * y[j];
+            }
+        }
+
+        int idx = lag + size - 1;  // Ajustar índice para el resultado
+        resultado[idx] = suma / (norma_x * norma_y);
+    }
+
+    // Mostrar resultados
+    for (int i = 0; i < resultado_size; i++) {
+        printf("Lag %d: %f\n", i - (size - 1), resultado[i]);
+    }
+
+    int index_max;
+    float max_val = calcular_maximo(resultado, resultado_size, &index_max);
+
+    // Imprimir el valor máximo y su índice
+    printf("Valor máximo: %.5f\n", max_val);
+    printf("Índice del valor máximo: %d\n", index_max);
+
+}
+
+// Función para calcular el valor máximo de un vector de floats
+float calcular_maximo(float* vector, int length, int* index_max) {
+    float max_val = vector[0]; // Suponemos que el primer valor es el máximo inicialmente
+    *index_max = 0; // El índice del valor máximo
+    for (int i = 1; i < length; i++) {
+        if (vector[i] > max_val) {
+            max_val = vector[i];
+            *index_max = i; // Actualizamos el índice cuando encontramos un nuevo máximo
+        }
+    }
+    return max_val; // Devuelve el valor máximo
+}
+
+// Correlación cruzada normalizada por FFT: O(n log n), sin VLA ni impresión
+float correlacion_cruzada_fft(const float* x, const float* y, int size, int lag_max, int* lag)
+{
+    static float z_real[CORRELACION_MAX_FFT];
+    static float z_imag[CORRELACION_MAX_FFT];
+
+    // Tamaño de FFT suficiente para que la correlación circular no se solape
+    int N = 1;
+    while (N < 2 * size - 1)
+    {
+        N *= 2;
+    }
+
+    // Ambas señales reales en una sola FFT compleja: z = x + i*y
+    for (int i = 0; i < N; i++)
+    {
+        z_real[i] = (i < size) ? x[i] : 0.0f;
+        z_imag[i] = (i < size) ? y[i] : 0.0f;
+    }
+    fft(N, z_real, z_imag);
+
+    // Separar X e Y y formar conj(X)*Y, conjugado para poder invertir con la FFT directa
+    for (int k = 0; k <= N / 2; k++)
+    {
+        int k2 = (N - k) & (N - 1);
+        float a_real = z_real[k], a_imag = z_imag[k];
+        float b_real = z_real[k2], b_imag = z_imag[k2];
+
+        // X[k] = (Z[k] + conj(Z[N-k])) / 2, Y[k] = (Z[k] - conj(Z[N-k])) / 2i
+        float xr = 0.5f * (a_real + b_real), xi = 0.5f * (a_imag - b_imag);
+        float yr = 0.5f * (a_imag + b_imag), yi = -0.5f * (a_real - b_real);
+
+        // conj(X[k]) * Y[k]; en N-k el producto es el conjugado por ser ambas señales reales
+        float pr = xr * yr + xi * yi;
+        float pi = xr * yi - xi * yr;
+
+        z_real[k] = pr;
+        z_imag[k] = -pi;
+        z_real[k2] = pr;
+        z_imag[k2] = pi;
+    }
+
+    // IFFT(P) = conj(FFT(conj(P))) / N; el resultado es real, basta la parte real
+    fft(N, z_real, z_imag);
+
+    float norma = calcular_norma(x, size) * calcular_norma(y, size) * N;
+    if (norma == 0.0f)
+    {
+        *lag = 0;
+        return 0.0f;
+    }
+
+    // Buscar el pico dentro de los desplazamientos permitidos (negativos al final del buffer)
+    if ((lag_max <= 0) || (lag_max > size - 1))
+    {
+        lag_max = size - 1;
+    }
+    float max_val = z_real[0];
+    *lag = 0;
+    for (int d = 1; d <= lag_max; d++)
+    {
+        if (z_real[d] > max_val)
+        {
+            max_val = z_real[d];
+            *lag = d;
+        }
+        if (z_real[N - d] > max_val)
+        {
+            max_val = z_real[N - d];
+            *lag = -d;
+        }
+    }
+
+    return max_val / norma;
+}
+
+// Función para calcular DTW con float y matriz fija
+float dtw(float *s1, int n, float *s2, int m) {
+    float dtw_matrix[MAX_SIZE][MAX_SIZE];
+
+
+    // Inicializar la matriz con valores "infinito" (FLT_MAX)
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= m; j++) {
+            dtw_matrix[i][j] = INF;
+        }
+    }
+    dtw_matrix[0][0] = 0;
+
+    // Calcular matriz de distancias acumuladas
+    for (int i = 1; i <= n; i++) {
+        for (int j = 1; j <= m; j++) {
+            float cost = (s1[i - 1] - s2[j - 1]) * (s1[i - 1] - s2[j - 1]); // Diferencia al cuadrado
+            dtw_matrix[i][j] = cost + fminf(fminf(
+                dtw_matrix[i - 1][j],    // Arriba
+                dtw_matrix[i][j - 1]),   // Izquierda
+                dtw_matrix[i - 1][j - 1] // Diagonal
+            );
+        }
+    }
+
+    // Resultado final: raíz cuadrada de la suma acumulada
+    return sqrtf(dtw_matrix[n][m]);
+}
+
+// Rango de columnas [j_ini, j_fin] de la fila i dentro de la banda de Sakoe-Chiba
+static inline void dtw_rango_fila(int i, int n, int m, int banda, int *j_ini, int *j_fin)
+{
+    int centro = (i * m + n / 2) / n; // Diagonal escalada cuando n != m
+    *j_ini = centro - banda;
+    *j_fin = centro + banda;
+    if (*j_ini < 1)
+    {
+        *j_ini = 1;
+    }
+    if (*j_fin > m)
+    {
+        *j_fin = m;
+    }
+}
+
+// Núcleo de dtw_banda() y dtw_banda_final_abierto(): con final_abierto el camino debe recorrer todo s2
+// pero puede terminar en cualquier fila de s1 desde fin_min, y la banda sigue la diagonal de pendiente 1
+static float dtw_banda_nucleo(const float *s1, int n, const float *s2, int m, int banda, float umbral,
+                              int final_abierto, int fin_min, struct Dtw_estadisticas *est)
+{
+    float filas[2][MAX_SIZE];
+    int rango_ini[2] = {0, 0}; // Columnas escritas por última vez en cada fila
+    int rango_fin[2] = {0, 0};
+    int celdas = 0;
+    float mejor_final = INF;   // Mejor costo en la última columna (final abierto)
+
+    // La banda debe alcanzar la esquina (n, m) y mantener el camino conectado
+    int banda_min = final_abierto ? 1 : (m + n - 1) / n / 2 + 1;
+    if (banda < banda_min)
+    {
+        banda = banda_min;
+    }
+    int n_diagonal = final_abierto ? m : n;
+
+    // Se compara el acumulado (sin raíz) contra el umbral al cuadrado
+    float limite = (umbral > 0.0f) ? umbral * umbral : INF;
+
+    for (int j = 0; j <= m; j++)
+    {
+        filas[0][j] = INF;
+        filas[1][j] = INF;
+    }
+    filas[0][0] = 0;
+
+    if (est)
+    {
+        est->abandonado = 0;
+        est->bytes_memoria = sizeof(filas);
+    }
+
+    for (int i = 1; i <= n; i++)
+    {
+        float *anterior = filas[(i - 1) & 1];
+        float *actual = filas[i & 1];
+        int j_ini, j_fin;
+        dtw_rango_fila(i, n_diagonal, m, banda, &j_ini, &j_fin);
+        if (j_ini > j_fin)
+        {
+            break; // Final abierto: las filas restantes quedan fuera de la banda
+        }
+
+        // Borrar lo que quedó de la fila i-2 (y sus vecinos) para que fuera de la banda sea "infinito"
+        int b_ini = rango_ini[i & 1] - 1;
+        int b_fin = rango_fin[i & 1] + 1;
+        for (int j = (b_ini < 0 ? 0 : b_ini); j <= b_fin && j <= m; j++)
+        {
+            actual[j] = INF;
+        }
+
+        float minimo_fila = INF;
+        for (int j = j_ini; j <= j_fin; j++)
+        {
+            float diff = s1[i - 1] - s2[j - 1];
+            float cost = diff * diff; // Diferencia al cuadrado
+            actual[j] = cost + fminf(fminf(
+                anterior[j],      // Arriba
+                actual[j - 1]),   // Izquierda
+                anterior[j - 1]   // Diagonal
+            );
+            minimo_fila = fminf(minimo_fila, actual[j]);
+        }
+        celdas += j_fin - j_ini + 1;
+        rango_ini[i & 1] = j_ini;
+        rango_fin[i & 1] = j_fin;
+
+        if (final_abierto && (j_fin == m) && (i >= fin_min))
+        {
+            mejor_final = fminf(mejor_final, actual[m]);
+        }
+
+        // Todo camino que aún no terminó cruza esta fila y los costos son no negativos: no puede bajar
+        if (minimo_fila > limite)
+        {
+            if (mejor_final <= limite)
+            {
+                break; // Final abierto: ya hay un camino terminado bajo el umbral
+            }
+            if (est)
+            {
+                est->celdas_evaluadas = celdas;
+                est->abandonado = 1;
+            }
+            return INF;
+        }
+    }
+
+    if (est)
+    {
+        est->celdas_evaluadas = celdas;
+    }
+
+    // Resultado final: raíz cuadrada de la suma acumulada
+    return sqrtf(final_abierto ? mejor_final : filas[n & 1][m]);
+}
+
+// Función para calcular DTW con banda, dos filas y abandono temprano
+float dtw_banda(const float *s1, int n, const float *s2, int m, int banda, float umbral, struct Dtw_estadisticas *est)
+{
+    return dtw_banda_nucleo(s1, n, s2, m, banda, umbral, 0, n, est);
+}
+
+// DTW con banda y final abierto: s2 completa contra el mejor prefijo de s1 de al menos fin_min elementos
+float dtw_banda_final_abierto(const float *s1, int n, int fin_min, const float *s2, int m, int banda, float umbral,
+                              struct Dtw_estadisticas *est)
+{
+    return dtw_banda_nucleo(s1, n, s2, m, banda, umbral, 1, fin_min, est);
+}
+
+uint16_t dtw_cuantizar(float x)
+{
+    long q = lrintf(x * (float)(1 << DTW_Q));
+    return (uint16_t)((q < 0) ? 0 : ((q > UINT16_MAX) ? UINT16_MAX : q));
+}
+
+void dtw_cuantizar_secuencia(const float *x, int n, uint16_t *q)
+{
+    for (int i = 0; i < n; i++)
+    {
+        q[i] = dtw_cuantizar(x[i]);
+    }
+}
+
+uint32_t dtw_limite_entero(float umbral)
+{
+    if (umbral <= 0.0f)
+    {
+        return DTW_INF_ENTERO;
+    }
+    float limite = umbral * umbral * (float)(1u << (2 * DTW_Q));
+    return (limite >= (float)DTW_INF_ENTERO) ? DTW_INF_ENTERO : (uint32_t)limite;
+}
+
+float dtw_distancia_entero(uint32_t costo)
+{
+    if (costo == DTW_INF_ENTERO)
+    {
+        return INF;
+    }
+#if MATEMATICA_APROXIMADA
+    // La raíz de un costo en Q(2 DTW_Q) es la distancia en Q DTW_Q: exacta salvo el truncado a 1/2^DTW_Q
+    return (float)raiz_entera(costo) / (float)(1 << DTW_Q);
+#else
+    return sqrtf((float)costo) / (float)(1 << DTW_Q);
+#endif
+}
+
+// Suma de costos que satura en DTW_INF_ENTERO en lugar de dar la vuelta
+static inline uint32_t dtw_sumar_saturado(uint32_t a, uint32_t b)
+{
+    uint32_t suma = a + b;
+    return (suma < a) ? DTW_INF_ENTERO : suma;
+}
+
+static inline uint32_t dtw_min_entero(uint32_t a, uint32_t b)
+{
+    return (a < b) ? a : b;
+}
+
+// DTW de una consulta contra varias plantillas: la consulta es el bucle exterior (filas) y cada plantilla
+// en carrera avanza una fila de su matriz por elemento de la consulta
+int dtw_banda_conjunto(struct Dtw_conjunto *cj, const uint16_t *consulta, int n, uint16_t relleno,
+                       const struct Dtw_candidato *cand, int k, int banda, uint32_t *costo,
+                       struct Dtw_estadisticas *est)
+{
+    int mejor = -1;
+    uint32_t mejor_costo = DTW_INF_ENTERO;
+    int largo_max = 0;
+    int celdas = 0;
+    int abandonados = 0;
+
+    for (int c = 0; c < k; c++)
+    {
+        const struct Dtw_candidato *p = &cand[c];
+
+        // Misma ampliación de la banda que dtw_banda_nucleo(), con la consulta en las filas
+        int banda_min = p->final_abierto ? 1 : (p->m + p->largo - 1) / p->largo / 2 + 1;
+        cj->banda[c] = (banda < banda_min) ? banda_min : banda;
+
+        for (int j = 0; j <= p->m; j++)
+        {
+            cj->filas[c][0][j] = DTW_INF_ENTERO;
+            cj->filas[c][1][j] = DTW_INF_ENTERO;
+        }
+        cj->filas[c][0][0] = 0;
+        cj->rango_ini[c][0] = cj->rango_ini[c][1] = 0;
+        cj->rango_fin[c][0] = cj->rango_fin[c][1] = 0;
+        cj->activo[c] = 1;
+        largo_max = (p->largo > largo_max) ? p->largo : largo_max;
+    }
+
+    for (int i = 1; i <= largo_max; i++)
+    {
+        int en_carrera = 0;
+
+        for (int c = 0; c < k; c++)
+        {
+            const struct Dtw_candidato *p = &cand[c];
+            if (!cj->activo[c])
+            {
+                continue;
+            }
+
+            // Elemento de la consulta alineada a esta plantilla, como lo deja alinear_consulta()
+            int q = i - 1 + p->desplazamiento;
+            int32_t x = ((q >= 0) && (q < n)) ? consulta[q] : relleno;
+
+            uint32_t limite = dtw_min_entero(p->limite, mejor_costo);
+
+            uint32_t *anterior = cj->filas[c][(i - 1) & 1];
+            uint32_t *actual = cj->filas[c][i & 1];
+            int j_ini, j_fin;
+            dtw_rango_fila(i, p->final_abierto ? p->m : p->largo, p->m, cj->banda[c], &j_ini, &j_fin);
+
+            // Borrar lo que quedó de la fila i-2 (y sus vecinos) para que fuera de la banda sea "infinito"
+            int b_ini = cj->rango_ini[c][i & 1] - 1;
+            int b_fin = cj->rango_fin[c][i & 1] + 1;
+            for (int j = (b_ini < 0 ? 0 : b_ini); j <= b_fin && j <= p->m; j++)
+            {
+                actual[j] = DTW_INF_ENTERO;
+            }
+
+            uint32_t minimo_fila = DTW_INF_ENTERO;
+            for (int j = j_ini; j <= j_fin; j++)
+            {
+                // |diferencia| < 2^16: su cuadrado cabe en 32 bits sin signo
+                int32_t diff = x - (int32_t)p->plantilla[j - 1];
+                uint32_t d = (uint32_t)((diff < 0) ? -diff : diff);
+                uint32_t previo = dtw_min_entero(dtw_min_entero(anterior[j], actual[j - 1]), anterior[j - 1]);
+                actual[j] = dtw_sumar_saturado(d * d, previo);
+                minimo_fila = dtw_min_entero(minimo_fila, actual[j]);
+            }
+            celdas += j_fin - j_ini + 1;
+            cj->rango_ini[c][i & 1] = j_ini;
+            cj->rango_fin[c][i & 1] = j_fin;
+
+            // Todo camino de esta plantilla cruza la fila y los costos son no negativos: no puede bajar
+            if (minimo_fila > limite)
+            {
+                cj->activo[c] = 0;
+                abandonados++;
+                continue;
+            }
+
+            if (i < p->largo)
+            {
+                en_carrera++;
+                continue;
+            }
+
+            // Consulta recorrida: extremo fijo en (largo, m) o el mejor final desde fin_min
+            uint32_t final = DTW_INF_ENTERO;
+            if (p->final_abierto)
+            {
+                for (int j = (p->fin_min > j_ini) ? p->fin_min : j_ini; j <= j_fin; j++)
+                {
+                    final = dtw_min_entero(final, actual[j]);
+                }
+            }
+            else if (j_fin == p->m)
+            {
+                final = actual[p->m];
+            }
+            if (final < limite)
+            {
+                mejor = c;
+                mejor_costo = final;
+            }
+            cj->activo[c] = 0;
+        }
+
+        if (en_carrera == 0)
+        {
+            break;
+        }
+    }
+
+    if (est)
+    {
+        est->celdas_evaluadas = celdas;
+        est->abandonado = abandonados;
+        est->bytes_memoria = sizeof(cj->filas);
+    }
+
+    *costo = mejor_costo;
+    return mejor;
+}
+
+// Envolvente superior e inferior de una secuencia dentro de la banda de Sakoe-Chiba
+void dtw_envolvente(const float *s, int n, int banda, float *sup, float *inf)
+{
+    if (banda < 1)
+    {
+        banda = 1; // Mismo radio mínimo que aplica dtw_banda() cuando n == m
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        int j_ini = (i - banda < 0) ? 0 : i - banda;
+        int j_fin = (i + banda > n - 1) ? n - 1 : i + banda;
+        float maximo = s[j_ini];
+        float minimo = s[j_ini];
+        for (int j = j_ini + 1; j <= j_fin; j++)
+        {
+            maximo = fmaxf(maximo, s[j]);
+            minimo = fminf(minimo, s[j]);
+        }
+        sup[i] = maximo;
+        inf[i] = minimo;
+    }
+}
+
+// Cota inferior LB_Kim: el primer y el último par siempre están en el camino de alineación
+float lb_kim(const float *s1, int n, const float *s2, int m)
+{
+    float d_ini = s1[0] - s2[0];
+    float cota = d_ini * d_ini;
+    if ((n > 1) || (m > 1))
+    {
+        float d_fin = s1[n - 1] - s2[m - 1];
+        cota += d_fin * d_fin;
+    }
+    return cota;
+}
+
+// Cota inferior LB_Keogh: distancia de la consulta a la envolvente de la plantilla
+float lb_keogh(const float *consulta, int n, const float *sup, const float *inf, float limite)
+{
+    float cota = 0.0f;
+    for (int i = 0; i < n; i++)
+    {
+        float d = 0.0f;
+        if (consulta[i] > sup[i])
+        {
+            d = consulta[i] - sup[i];
+        }
+        else if (consulta[i] < inf[i])
+        {
+            d = inf[i] - consulta[i];
+        }
+        cota += d * d;
+
+        if (cota > limite)
+        {
+            break; // Ya no puede sobrevivir; el valor parcial sigue siendo una cota válida
+        }
+    }
+    return cota;
+}
+
+
+void spring_iniciar(struct Spring_estado *st, int m)
+{
+    for (int f = 0; f < 2; f++)
+    {
+        st->d[f][0] = 0.0f;
+        st->inicio[f][0] = 0;
+        for (int i = 1; i <= m; i++)
+        {
+            st->d[f][i] = INF;
+            st->inicio[f][i] = 0;
+        }
+    }
+    st->fila = 0;
+    st->d_min = INF;
+    st->t_ini = 0;
+    st->t_fin = 0;
+}
+
+// DTW de subsecuencia (SPRING): una columna de costo por cada nueva muestra del flujo
+int spring_actualizar(struct Spring_estado *st, const float *plantilla, int m, float x, int32_t t, float limite,
+                      struct Coincidencia_subsecuencia *coincidencia)
+{
+    float *d_ant = st->d[st->fila];
+    float *d_act = st->d[st->fila ^ 1];
+    int32_t *s_ant = st->inicio[st->fila];
+    int32_t *s_act = st->inicio[st->fila ^ 1];
+    int reportado = 0;
+
+    // Inicio abierto: cualquier instante puede ser el comienzo del patrón
+    d_act[0] = 0.0f;
+    s_act[0] = t;
+
+    for (int i = 1; i <= m; i++)
+    {
+        float diff = x - plantilla[i - 1];
+        float mejor = d_act[i - 1]; // Abajo
+        int32_t s = s_act[i - 1];
+        if (d_ant[i] < mejor)       // Izquierda
+        {
+            mejor = d_ant[i];
+            s = s_ant[i];
+        }
+        if (d_ant[i - 1] < mejor)   // Diagonal
+        {
+            mejor = d_ant[i - 1];
+            s = s_ant[i - 1];
+        }
+        d_act[i] = diff * diff + mejor;
+        s_act[i] = s;
+    }
+
+    // Confirmar la coincidencia pendiente cuando ningún camino que la solape puede mejorarla
+    if (st->d_min <= limite)
+    {
+        int confirmado = 1;
+        for (int i = 1; i <= m; i++)
+        {
+            if ((d_act[i] < st->d_min) && (s_act[i] <= st->t_fin))
+            {
+                confirmado = 0;
+                break;
+            }
+        }
+
+        if (confirmado)
+        {
+            coincidencia->distancia = sqrtf(st->d_min);
+            coincidencia->t_ini = st->t_ini;
+            coincidencia->t_fin = st->t_fin;
+            reportado = 1;
+
+            // Los caminos que solapan la coincidencia reportada ya no pueden generar otra
+            st->d_min = INF;
+            for (int i = 1; i <= m; i++)
+            {
+                if (s_act[i] <= st->t_fin)
+                {
+                    d_act[i] = INF;
+                }
+            }
+        }
+    }
+
+    // Fin abierto: la plantilla completa terminó en el instante t
+    if ((d_act[m] <= limite) && (d_act[m] < st->d_min))
+    {
+        st->d_min = d_act[m];
+        st->t_ini = s_act[m];
+        st->t_fin = t;
+    }
+
+    st->fila ^= 1;
+    return reportado;
+}
+
+int spring_camino_activo(const struct Spring_estado *st, int m, float limite, int32_t t_fin)
+{
+    // Coincidencia propia aún sin confirmar que empieza antes de t_fin
+    if ((st->d_min <= limite) && (st->t_ini <= t_fin))
+    {
+        return 1;
+    }
+
+    // Caminos en curso (columna más reciente) que podrían terminar bajo el límite
+    const float *d = st->d[st->fila];
+    const int32_t *s = st->inicio[st->fila];
+    for (int i = 1; i <= m; i++)
+    {
+        if ((d[i] <= limite) && (s[i] <= t_fin))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+void decimador_iniciar(struct Decimador *d)
+{
+    memset(d->lineas, 0, sizeof(d->lineas));
+    d->cabeza = 0;
+    d->fase = DECIMACION_FACTOR - 1;
+    d->acumulador = 0;
+}
+
+// Decimador polifásico de entrada conmutada: cada muestra solo recorre los coeficientes de su fase
+int decimador_agregar(struct Decimador *d, int16_t x, int16_t *y)
+{
+#if DECIMACION_FACTOR == 1
+    (void)d;
+    *y = x;
+    return 1;
+#else
+    int p = d->fase;
+
+    // La primera muestra de cada bloque (fase M-1) desplaza todas las líneas de retardo
+    if (p == DECIMACION_FACTOR - 1)
+    {
+        d->cabeza = (d->cabeza == 0) ? FIR_DECIMACION_TAPS_FASE - 1 : d->cabeza - 1;
+        d->acumulador = 1 << 14; // Redondeo de la salida Q15
+    }
+
+    int16_t *linea = d->lineas[p];
+    const int16_t *coef = fir_decimacion_q15[p];
+    linea[d->cabeza] = x;
+
+    int idx = d->cabeza;
+    for (int j = 0; j < FIR_DECIMACION_TAPS_FASE; j++)
+    {
+        d->acumulador += (int32_t)coef[j] * linea[idx];
+        if (++idx == FIR_DECIMACION_TAPS_FASE)
+        {
+            idx = 0;
+        }
+    }
+
+    if (p > 0)
+    {
+        d->fase = p - 1;
+        return 0;
+    }
+
+    // Fase 0: el bloque está completo y sale una muestra a la tasa reducida
+    d->fase = DECIMACION_FACTOR - 1;
+    int32_t salida = d->acumulador >> 15;
+    if (salida > 32767)
+    {
+        salida = 32767;
+    }
+    else if (salida < -32768)
+    {
+        salida = -32768;
+    }
+    *y = (int16_t)salida;
+    return 1;
+#endif
+}
+
+void sdft_iniciar(struct Sdft *s)
+{
+    memset(s, 0, sizeof(*s));
+}
+
+void sdft_agregar(struct Sdft *s, int16_t x)
+{
+    int m = s->posicion;
+
+    // La muestra que sale tiene el mismo índice m mod N que la que entra: un solo producto por componente
+    int32_t diferencia = (int32_t)x - s->historia[m];
+    s->historia[m] = x;
+
+    for (int b = 0; b < GOERTZEL_NUM_BANDAS; b++)
+    {
+        int giro = (goertzel_bins[b] * m) & (SDFT_TAMANO - 1);
+        s->real[b] += diferencia * sdft_giro_q13_real[giro];
+        s->imag[b] += diferencia * sdft_giro_q13_imag[giro];
+    }
+
+    s->posicion = (m + 1) & (SDFT_TAMANO - 1);
+}
+
+float sdft_amplitud(const struct Sdft *s)
+{
+    float suma = 0.0f;
+    for (int b = 0; b < GOERTZEL_NUM_BANDAS; b++)
+    {
+        suma += magnitud((float)s->real[b], (float)s->imag[b]);
+    }
+    return suma / (GOERTZEL_NUM_BANDAS * 8192.0f);
+}
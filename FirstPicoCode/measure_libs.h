@@ -14,24 +14,93 @@
 #include <stdint.h> /**< Definiciones de tipos de datos enteros con tamaño fijo */
 #include <stdio.h> /**< Funciones para entrada y salida estándar */
 #include <math.h> /**< Funciones matemáticas estándar como cos, sin, sqrt, etc. */
+#include <string.h> /**< Funciones de manejo de memoria (memset) */
+#include "dsp_tables.h" /**< Tablas DSP generadas al compilar (FFT y filtro de decimación) */
+#include "matematica_aproximada.h" /**< Magnitud, raíz y log/exp aproximados (MATEMATICA_APROXIMADA) */
+
+/**
+ * @def SAMPLES_ADC
+ * @brief Número de muestras de un audio a la frecuencia del ADC (8 kHz). Opción de CMake DSP_MUESTRAS.
+ */
+#ifndef SAMPLES_ADC
+#define SAMPLES_ADC 5120
+#endif
+
+/**
+ * @def TAMANO_VENTANA_ADC
+ * @brief Tamaño de la ventana de la STFT a la frecuencia del ADC (8 ms). Opción de CMake DSP_VENTANA.
+ *
+ * Las tablas de Goertzel y de la SDFT se generan para esta ventana, por eso CMake la pasa también al
+ * generador (--ventana).
+ */
+#ifndef TAMANO_VENTANA_ADC
+#define TAMANO_VENTANA_ADC 64
+#endif
+
+/**
+ * @def SALTO_VENTANA_ADC
+ * @brief Muestras entre el inicio de dos ventanas de la STFT a la frecuencia del ADC. Opción de CMake DSP_SALTO.
+ *
+ * Por defecto igual a la ventana (sin solapamiento), que es la configuración con la que están calibrados
+ * los umbrales DTW de measure.c.
+ */
+#ifndef SALTO_VENTANA_ADC
+#define SALTO_VENTANA_ADC TAMANO_VENTANA_ADC
+#endif
+
+#if (TAMANO_VENTANA_ADC % DECIMACION_FACTOR) != 0
+#error "DECIMACION_FACTOR debe dividir a TAMANO_VENTANA_ADC"
+#endif
+
+#if (SALTO_VENTANA_ADC % DECIMACION_FACTOR) != 0
+#error "DECIMACION_FACTOR debe dividir a SALTO_VENTANA_ADC"
+#endif
 
 /**
  * @def SAMPLES
- * @brief Número total de muestras de la señal.
+ * @brief Número total de muestras de la señal tras la decimación.
  */
-#define SAMPLES 5120
+#define SAMPLES (SAMPLES_ADC / DECIMACION_FACTOR)
 
 /**
  * @def TAMANO_VENTANA
- * @brief Tamaño de cada ventana utilizada en el análisis de señales.
+ * @brief Tamaño de cada ventana utilizada en el análisis de señales, tras la decimación.
+ */
+#define TAMANO_VENTANA (TAMANO_VENTANA_ADC / DECIMACION_FACTOR)
+
+/**
+ * @def SALTO_VENTANA
+ * @brief Salto entre ventanas consecutivas de la STFT, tras la decimación.
  */
-#define TAMANO_VENTANA 64
+#define SALTO_VENTANA (SALTO_VENTANA_ADC / DECIMACION_FACTOR)
+
+#if (TAMANO_VENTANA < 4) || ((TAMANO_VENTANA & (TAMANO_VENTANA - 1)) != 0) || (TAMANO_VENTANA > FFT_TABLAS_MAX_SIZE)
+#error "TAMANO_VENTANA debe ser una potencia de 2 entre 4 y FFT_TABLAS_MAX_SIZE"
+#endif
+
+#if SDFT_TAMANO != TAMANO_VENTANA
+#error "Las tablas DSP se generaron para otra ventana: regenerarlas con --ventana TAMANO_VENTANA_ADC"
+#endif
+
+#if (SALTO_VENTANA < 1) || (SALTO_VENTANA > TAMANO_VENTANA)
+#error "SALTO_VENTANA debe estar entre 1 y TAMANO_VENTANA"
+#endif
+
+#if SAMPLES < TAMANO_VENTANA
+#error "Un audio debe contener al menos una ventana completa"
+#endif
+
+/**
+ * @def NUM_VENTANAS
+ * @brief Número de ventanas de la STFT por cada audio capturado (las que caben completas cada SALTO_VENTANA muestras).
+ */
+#define NUM_VENTANAS ((SAMPLES - TAMANO_VENTANA) / SALTO_VENTANA + 1)
 
 /**
  * @def MAX_SIZE
  * @brief Tamaño máximo de las señales utilizadas en DTW y otros cálculos.
  */
-#define MAX_SIZE 81 // Tamaño máximo de las señales (80 + 1 para bordes)
+#define MAX_SIZE (NUM_VENTANAS + 1) // Tamaño máximo de las señales (NUM_VENTANAS + 1 para bordes)
 
 /**
  * @def INF
@@ -45,15 +114,183 @@
  */
 #define PI 3.141592653589793
 
+/**
+ * @def FFT_USAR_Q15
+ * @brief Selecciona el motor de la FFT usado por fft(): 1 para punto fijo Q15, 0 para punto flotante.
+ *
+ * El RP2040 (Cortex-M0+) no tiene FPU, por lo que el motor Q15 evita la emulación de punto flotante
+ * en las mariposas y reduce el tiempo de decisión tras cada captura.
+ */
+#ifndef FFT_USAR_Q15
+#define FFT_USAR_Q15 1
+#endif
+
+/**
+ * @def CARACTERISTICA_GOERTZEL
+ * @brief Característica por ventana: 0 amplitud promedio de la FFT completa, 1 filtros de Goertzel en la banda de los aplausos.
+ *
+ * Los umbrales DTW de measure.c están calibrados con la FFT; al cambiar de extractor hay que revisarlos
+ * con benchmark_goertzel().
+ */
+#ifndef CARACTERISTICA_GOERTZEL
+#define CARACTERISTICA_GOERTZEL 0
+#endif
+
+/**
+ * @def GOERTZEL_Q
+ * @brief Bits fraccionarios de las muestras en los filtros de Goertzel; con bins entre N/16 y 7N/16 el estado cabe en 32 bits.
+ */
+#define GOERTZEL_Q 8
+
+/**
+ * @brief Vector de características de un audio: envolvente espectral de la STFT.
+ *
+ * Se calcula una sola vez por captura (o una vez al arrancar para las plantillas)
+ * y se reutiliza en todas las comparaciones DTW.
+ */
+struct Caracteristicas
+{
+    float amplitudes[NUM_VENTANAS];     /**< Amplitud espectral promedio de cada ventana. */
+    float indices_tiempo[NUM_VENTANAS]; /**< Tiempo central de cada ventana en segundos. */
+    int num_ventanas;                   /**< Cantidad de ventanas válidas. */
+};
+
+/**
+ * @brief Estado del extractor incremental de características (STFT por ventanas).
+ *
+ * Permite calcular cada ventana apenas se completa durante la captura, de modo que al
+ * llegar la última muestra solo queda pendiente la última ventana y el DTW.
+ */
+struct Extractor_STFT
+{
+    struct Caracteristicas *caract; /**< Destino de las características. */
+    float frecuencia_muestreo;      /**< Frecuencia de muestreo de la señal. */
+    int ventanas_procesadas;        /**< Ventanas ya transformadas. */
+    int32_t compuerta;              /**< Suma de |x| de una ventana bajo la cual no se transforma (0: sin compuerta). */
+    float relacion_piso;            /**< Característica por unidad de suma de |x| asignada a las ventanas bajo la compuerta. */
+    int fft_omitidas;               /**< Ventanas de la captura resueltas por la compuerta, sin FFT. */
+};
+
+/**
+ * @brief Estado del decimador polifásico entero entre el ADC y la extracción de características.
+ *
+ * Cada fase tiene su propia línea de retardo, así cada muestra de entrada cuesta solo
+ * FIR_DECIMACION_TAPS_FASE multiplicaciones enteras y el trabajo queda repartido entre muestras.
+ */
+struct Decimador
+{
+    int16_t lineas[DECIMACION_FACTOR][FIR_DECIMACION_TAPS_FASE]; /**< Líneas de retardo por fase. */
+    int cabeza;          /**< Posición de la muestra más reciente en las líneas circulares. */
+    int fase;            /**< Fase de la próxima muestra (de DECIMACION_FACTOR - 1 a 0). */
+    int32_t acumulador;  /**< Suma parcial de la muestra de salida en curso. */
+};
+
+/**
+ * @brief Estado de la DFT deslizante modulada sobre los bins de la banda de los aplausos (goertzel_bins).
+ *
+ * Cada bin guarda la suma móvil de las últimas SDFT_TAMANO muestras demoduladas por exp(+2*pi*i*k*m/N).
+ * Los productos son exactos en 32 bits, así la suma no acumula error ni necesita amortiguamiento, y
+ * la magnitud coincide con la del bin de la DFT de la ventana que termina en la última muestra.
+ */
+struct Sdft
+{
+    int16_t historia[SDFT_TAMANO];        /**< Últimas SDFT_TAMANO muestras (buffer circular). */
+    int posicion;                         /**< Índice m mod SDFT_TAMANO de la próxima muestra. */
+    int32_t real[GOERTZEL_NUM_BANDAS];    /**< Parte real de la suma demodulada de cada bin. */
+    int32_t imag[GOERTZEL_NUM_BANDAS];    /**< Parte imaginaria de la suma demodulada de cada bin. */
+};
+
 /**
  * @brief Implementa la Transformada Rápida de Fourier (FFT).
+ *
+ * Según FFT_USAR_Q15 delega en fft_q15() (convirtiendo la señal con escalado de bloque)
+ * o en fft_float(). La interfaz y el resultado son los mismos en ambos casos. La conversión a Q15
+ * usa buffers estáticos, así que no es reentrante (solo se llama desde el bucle principal).
  * 
- * @param N Número de puntos de la FFT (debe ser potencia de 2).
+ * @param N Número de puntos de la FFT (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
  * @param real Array de entrada con la parte real de los datos.
  * @param imag Array de entrada con la parte imaginaria de los datos (inicialmente 0).
  */
 void fft(int N, float real[], float imag[]);
 
+/**
+ * @brief FFT en punto flotante (implementación de referencia).
+ *
+ * Los factores de giro y la permutación de bits invertidos se leen de las tablas de
+ * dsp_tables.h, generadas en tiempo de compilación y ubicadas en flash. Cada potencia de 2
+ * entre 4 y min(FFT_TABLAS_MAX_SIZE, 1024) tiene su propia instancia del núcleo, compilada con
+ * N constante y con las dos primeras etapas fusionadas en una pasada radix-4 sin multiplicaciones.
+ *
+ * @param N Número de puntos de la FFT (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param real Array de entrada/salida con la parte real de los datos.
+ * @param imag Array de entrada/salida con la parte imaginaria de los datos.
+ */
+void fft_float(int N, float real[], float imag[]);
+
+/**
+ * @brief fft_float() sin especializar: N se conoce recién al ejecutar.
+ *
+ * Atiende los tamaños sin instancia propia y sirve de referencia para medir las instancias en benchmark_fft().
+ *
+ * @param N Número de puntos de la FFT (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param real Array de entrada/salida con la parte real de los datos.
+ * @param imag Array de entrada/salida con la parte imaginaria de los datos.
+ */
+void fft_float_generica(int N, float real[], float imag[]);
+
+/**
+ * @brief FFT en punto fijo Q15 con escalado de punto flotante por bloque.
+ *
+ * Antes de cada etapa se revisa el máximo del bloque y, si la etapa puede desbordar,
+ * se divide todo el bloque por 2 (o por 4) dentro de la misma mariposa. El total de
+ * desplazamientos aplicados se devuelve como exponente del bloque. Las dos primeras etapas
+ * (factores 1 y -i) se resuelven juntas en una pasada radix-4 con un solo escalado, y cada
+ * tamaño entre 4 y min(FFT_TABLAS_MAX_SIZE, 1024) tiene su instancia especializada, como fft_float().
+ *
+ * @param N Número de puntos de la FFT (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param real Array de entrada/salida con la parte real en Q15.
+ * @param imag Array de entrada/salida con la parte imaginaria en Q15.
+ * @return Exponente del bloque: el espectro real es la salida multiplicada por 2^exponente.
+ */
+int fft_q15(int N, int16_t real[], int16_t imag[]);
+
+/**
+ * @brief fft_q15() sin especializar, como fft_float_generica().
+ *
+ * @param N Número de puntos de la FFT (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param real Array de entrada/salida con la parte real en Q15.
+ * @param imag Array de entrada/salida con la parte imaginaria en Q15.
+ * @return Exponente del bloque, como en fft_q15().
+ */
+int fft_q15_generica(int N, int16_t real[], int16_t imag[]);
+
+/**
+ * @brief FFT de una señal real de N puntos mediante una FFT compleja de N/2 puntos.
+ *
+ * Las muestras pares e impares se empaquetan como parte real e imaginaria, se transforman con fft()
+ * y un post-procesamiento con los factores de giro separa ambos espectros. Solo se devuelven los
+ * N/2 + 1 bins no redundantes; el resto es el conjugado simétrico.
+ *
+ * @param N Número de puntos de la señal (potencia de 2, entre 4 y FFT_TABLAS_MAX_SIZE).
+ * @param x Array de entrada con las N muestras reales.
+ * @param real Array de salida (N/2 + 1 elementos) con la parte real de los bins 0..N/2.
+ * @param imag Array de salida (N/2 + 1 elementos) con la parte imaginaria de los bins 0..N/2.
+ */
+void rfft(int N, const float x[], float real[], float imag[]);
+
+/**
+ * @brief FFT real como rfft(), sobre muestras enteras (códigos del ADC centrados) sin convertirlas a flotante.
+ *
+ * Con FFT_USAR_Q15 el escalado de bloque a Q15 es un desplazamiento y solo los N/2 + 1 bins de salida
+ * pasan a flotante; el espectro queda en las unidades de las muestras.
+ *
+ * @param N Número de puntos de la señal (potencia de 2, entre 4 y FFT_TABLAS_MAX_SIZE).
+ * @param x Señal de entrada de N muestras enteras.
+ * @param real Array de salida (al menos N/2 + 1) con la parte real de los bins 0..N/2.
+ * @param imag Array de salida (al menos N/2 + 1) con la parte imaginaria de los bins 0..N/2.
+ */
+void rfft_enteros(int N, const int16_t x[], float real[], float imag[]);
+
 /**
  * @brief Calcula la magnitud de una señal compleja a partir de sus componentes reales e imaginarias.
  * 
@@ -67,14 +304,157 @@ void calculate_magnitude(int N, float real[], float imag[], float mag[]);
 /**
  * @brief Procesa una señal dividiéndola en ventanas, calcula la FFT para cada ventana 
  * y almacena las amplitudes promedio y los índices de tiempo.
+ *
+ * Las ventanas empiezan cada salto muestras mientras quepan completas en la señal, igual que en la
+ * STFT del reconocedor; todo sale de los argumentos, sin suponer SAMPLES ni TAMANO_VENTANA.
  * 
  * @param array Array de entrada con la señal a procesar.
+ * @param num_muestras Muestras de la señal.
  * @param frecuencia_muestreo Frecuencia de muestreo de la señal.
- * @param tamano_ventana Tamaño de cada ventana para el procesamiento.
+ * @param tamano_ventana Tamaño de cada ventana para el procesamiento (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param salto Muestras entre el inicio de dos ventanas consecutivas.
  * @param amplitudes_promedio Array de salida con las amplitudes promedio por ventana.
  * @param indices_tiempo Array de salida con los índices de tiempo correspondientes.
+ * @return Cantidad de ventanas procesadas e impresas.
+ */
+int graficar_amplitud_promedio_frecuencia(const float *array, int num_muestras, float frecuencia_muestreo, int tamano_ventana,
+                                          int salto, float *amplitudes_promedio, float *indices_tiempo);
+
+/**
+ * @brief Calcula la amplitud espectral promedio de una ventana (FFT real + magnitud).
+ *
+ * El espectro se arma en buffers estáticos y TAMANO_VENTANA, el tamaño de la STFT, tiene su instancia
+ * especializada del núcleo; los demás tamaños pasan por el camino genérico.
+ *
+ * @param tamano_ventana Número de muestras de la ventana (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param ventana Muestras de la ventana.
+ * @return Promedio de la magnitud sobre los tamano_ventana bins del espectro.
+ */
+float amplitud_promedio_ventana(int tamano_ventana, const float *ventana);
+
+/**
+ * @brief amplitud_promedio_ventana() sobre muestras enteras, con rfft_enteros().
+ *
+ * @param tamano_ventana Número de muestras de la ventana (potencia de 2, máximo FFT_TABLAS_MAX_SIZE).
+ * @param ventana Muestras enteras de la ventana.
+ * @return Promedio de la magnitud, en las unidades de las muestras.
+ */
+float amplitud_promedio_ventana_enteros(int tamano_ventana, const int16_t *ventana);
+
+/**
+ * @brief Calcula la amplitud espectral promedio de una ventana en la banda de los aplausos (filtros de Goertzel).
+ *
+ * Evalúa solo los GOERTZEL_NUM_BANDAS bins de goertzel_bins, con coeficientes fijados en tiempo de
+ * compilación y aritmética entera, en lugar de los TAMANO_VENTANA bins de la FFT. La ventana pasa a
+ * Q GOERTZEL_Q con escalado de bloque, así el error no depende de su nivel.
+ *
+ * @param ventana Muestras de la ventana (TAMANO_VENTANA).
+ * @return Promedio de la magnitud de los bins evaluados.
+ */
+float energia_bandas_goertzel(const float *ventana);
+
+/**
+ * @brief energia_bandas_goertzel() sobre muestras enteras, con un desplazamiento de bloque que acota el estado.
+ *
+ * @param ventana Muestras enteras de la ventana (TAMANO_VENTANA).
+ * @return Promedio de la magnitud de los bins evaluados, en las unidades de las muestras.
+ */
+float energia_bandas_goertzel_enteros(const int16_t *ventana);
+
+/**
+ * @brief Calcula la característica de una ventana con el extractor elegido por CARACTERISTICA_GOERTZEL.
+ *
+ * @param ventana Muestras de la ventana (TAMANO_VENTANA).
+ * @return Valor de la ventana en el vector de características.
+ */
+float caracteristica_ventana(const float *ventana);
+
+/**
+ * @brief caracteristica_ventana() sobre muestras enteras; el resultado queda en las unidades de las muestras.
+ *
+ * @param ventana Muestras enteras de la ventana (TAMANO_VENTANA).
+ * @return Valor de la ventana, a multiplicar por el factor de normalización de las muestras.
+ */
+float caracteristica_ventana_enteros(const int16_t *ventana);
+
+/**
+ * @brief Suma de |x| de una ventana: medida de energía en el tiempo, sin multiplicaciones.
+ *
+ * @param ventana Muestras enteras de la ventana (TAMANO_VENTANA).
+ * @return Suma de los valores absolutos (cabe en 32 bits para cualquier muestra de 16 bits).
+ */
+int32_t suma_absoluta_ventana(const int16_t *ventana);
+
+/**
+ * @brief Extrae en una sola pasada la envolvente espectral de un audio de SAMPLES muestras.
+ *
+ * Equivale a graficar_amplitud_promedio_frecuencia() con SAMPLES, TAMANO_VENTANA y SALTO_VENTANA,
+ * pero sin imprimir, para llamarse una única vez por captura.
+ *
+ * @param array Señal de entrada (SAMPLES muestras).
+ * @param frecuencia_muestreo Frecuencia de muestreo de la señal.
+ * @param caract Estructura de salida con las características.
+ */
+void extraer_caracteristicas(const float *array, float frecuencia_muestreo, struct Caracteristicas *caract);
+
+/**
+ * @brief Reinicia el extractor incremental para una nueva captura.
+ *
+ * @param ext Extractor a inicializar.
+ * @param caract Estructura donde se irán escribiendo las características.
+ * @param frecuencia_muestreo Frecuencia de muestreo de la señal.
  */
-void graficar_amplitud_promedio_frecuencia(float *array, float frecuencia_muestreo, int tamano_ventana, float *amplitudes_promedio, float *indices_tiempo);
+void extractor_stft_iniciar(struct Extractor_STFT *ext, struct Caracteristicas *caract, float frecuencia_muestreo);
+
+/**
+ * @brief Habilita la compuerta de energía del extractor sobre muestras enteras.
+ *
+ * Antes de cada FFT se suma |x| de la ventana (TAMANO_VENTANA sumas). Si no alcanza la compuerta, la
+ * ventana es un silencio entre aplausos: su característica se estima como relacion_piso por esa suma y
+ * no se transforma. La característica es aproximadamente proporcional a la suma de |x| en el ruido, así
+ * la estimación no deja un escalón en la envolvente al cruzar la compuerta. Solo la aplica
+ * extractor_stft_procesar_anillo().
+ *
+ * @param ext Extractor ya iniciado (extractor_stft_iniciar() deshabilita la compuerta).
+ * @param compuerta Suma de |x| por ventana, en unidades de las muestras; 0 para transformar todas.
+ * @param relacion_piso Característica por unidad de suma de |x|, medida sobre ventanas silenciosas.
+ */
+void extractor_stft_fijar_compuerta(struct Extractor_STFT *ext, int32_t compuerta, float relacion_piso);
+
+/**
+ * @brief Procesa las ventanas que ya están completas en el buffer de captura.
+ *
+ * Las ventanas empiezan cada SALTO_VENTANA muestras. Lee las muestras en su lugar (sin copiarlas) y
+ * nunca toca la ventana que aún se está llenando.
+ *
+ * @param ext Extractor en curso.
+ * @param muestras Buffer de captura.
+ * @param disponibles Cantidad de muestras ya escritas en el buffer.
+ * @param max_ventanas Máximo de ventanas a procesar en esta llamada (acota el tiempo por llamada).
+ * @return 1 si ya se procesaron las NUM_VENTANAS ventanas, 0 en caso contrario.
+ */
+int extractor_stft_procesar(struct Extractor_STFT *ext, const float *muestras, int disponibles, int max_ventanas);
+
+/**
+ * @brief Procesa las ventanas completas de una captura entera guardada dentro de un buffer circular.
+ *
+ * Igual que extractor_stft_procesar(), pero la captura empieza en la posición inicio del anillo y puede
+ * dar la vuelta. Cada ventana se transforma en su lugar; solo la que cruza el final del anillo se copia
+ * antes a un buffer estático, y con inicio y tamano_anillo múltiplos de TAMANO_VENTANA y de SALTO_VENTANA
+ * no cruza ninguna. Las muestras se guardan sin normalizar (la mitad de memoria que en flotante) y la
+ * normalización se aplica a la característica.
+ *
+ * @param ext Extractor en curso.
+ * @param anillo Buffer circular de muestras enteras (códigos del ADC centrados).
+ * @param tamano_anillo Muestras del buffer circular (al menos TAMANO_VENTANA).
+ * @param inicio Posición de la primera muestra de la captura.
+ * @param disponibles Cantidad de muestras de la captura ya escritas.
+ * @param max_ventanas Máximo de ventanas a procesar en esta llamada.
+ * @param escala Factor de normalización de las muestras.
+ * @return 1 si ya se procesaron las NUM_VENTANAS ventanas, 0 en caso contrario.
+ */
+int extractor_stft_procesar_anillo(struct Extractor_STFT *ext, const int16_t *anillo, int tamano_anillo, int inicio,
+                                   int disponibles, int max_ventanas, float escala);
 
 /**
  * @brief Calcula la norma euclidiana de un vector.
@@ -104,6 +484,42 @@ void calcular_correlacion_cruzada(const float* x, const float* y, int size);
  */
 float calcular_maximo(float* vector, int length, int* index_max);
 
+/**
+ * @def CORRELACION_MAX_FFT
+ * @brief Tamaño de la FFT usada por correlacion_cruzada_fft(): la menor potencia de 2 >= 2*NUM_VENTANAS - 1.
+ */
+#if (2 * NUM_VENTANAS - 1) <= 64
+#define CORRELACION_MAX_FFT 64
+#elif (2 * NUM_VENTANAS - 1) <= 128
+#define CORRELACION_MAX_FFT 128
+#elif (2 * NUM_VENTANAS - 1) <= 256
+#define CORRELACION_MAX_FFT 256
+#elif (2 * NUM_VENTANAS - 1) <= 512
+#define CORRELACION_MAX_FFT 512
+#else
+#define CORRELACION_MAX_FFT 1024
+#endif
+
+#if (CORRELACION_MAX_FFT < 2 * NUM_VENTANAS - 1) || (CORRELACION_MAX_FFT > FFT_TABLAS_MAX_SIZE)
+#error "La correlación cruzada de NUM_VENTANAS ventanas no cabe en las tablas de la FFT (DSP_FFT_MAX_SIZE)"
+#endif
+
+/**
+ * @brief Correlación cruzada normalizada calculada con la FFT, en O(n log n).
+ *
+ * Calcula r[lag] = sum x[i] * y[i + lag] / (|x| |y|) para todos los desplazamientos con una sola FFT
+ * directa (x e y empaquetadas como parte real e imaginaria) y una inversa, sin imprimir nada.
+ * Usa buffers estáticos, por lo que no es reentrante.
+ *
+ * @param x Primera señal de entrada.
+ * @param y Segunda señal de entrada.
+ * @param size Tamaño de las señales (2*size - 1 <= CORRELACION_MAX_FFT).
+ * @param lag_max Mayor desplazamiento (en valor absoluto) considerado; <= 0 para todos.
+ * @param lag Desplazamiento del pico: y está retrasada lag muestras respecto de x.
+ * @return Valor del pico de la correlación normalizada.
+ */
+float correlacion_cruzada_fft(const float* x, const float* y, int size, int lag_max, int* lag);
+
 /**
  * @brief Calcula la distancia entre dos secuencias(principalmente iguales) usando Dynamic Time Warping (DTW).
  * 
@@ -115,4 +531,340 @@ float calcular_maximo(float* vector, int length, int* index_max);
  */
 float dtw(float *s1, int n, float *s2, int m);
 
+/**
+ * @def DTW_BANDA
+ * @brief Radio por defecto (en ventanas) de la banda de Sakoe-Chiba usada por dtw_banda().
+ */
+#define DTW_BANDA 16
+
+/**
+ * @def DTW_BANDA_ALINEADA
+ * @brief Radio de banda cuando la captura ya fue alineada a la plantilla por correlación cruzada.
+ */
+#define DTW_BANDA_ALINEADA 6
+
+/**
+ * @brief Contadores de trabajo de una llamada a dtw_banda(), usados para comparar contra dtw().
+ */
+struct Dtw_estadisticas
+{
+    int celdas_evaluadas; /**< Celdas de la matriz de costo efectivamente calculadas. */
+    int abandonado;       /**< 1 si se abandonó antes de terminar por superar el umbral. */
+    int bytes_memoria;    /**< Memoria de pila usada para las filas de costo acumulado. */
+};
+
+/**
+ * @def DTW_Q
+ * @brief Bits fraccionarios de las características cuantizadas para el DTW entero (Q12 en uint16: hasta 16.0).
+ *
+ * La característica de una ventana no pasa de sqrt(TAMANO_VENTANA) veces su valor eficaz normalizado (~8),
+ * y la diferencia de dos valores uint16 al cuadrado cabe justo en 32 bits.
+ */
+#define DTW_Q 12
+
+/**
+ * @def DTW_COTA_CUANTIZACION
+ * @brief Diferencia máxima entre la distancia del DTW entero y la de dtw_banda() sobre las características sin cuantizar.
+ *
+ * dtw_cuantizar() redondea cada característica a 2^-(DTW_Q+1), así cada diferencia de un camino cambia a lo
+ * sumo 2^-DTW_Q y, por la desigualdad triangular, la norma de un camino de a lo sumo n + m - 1 celdas cambia
+ * a lo sumo 2^-DTW_Q sqrt(n + m - 1); el mínimo sobre los caminos conserva la cota. El término 1 cubre el
+ * truncado de la raíz entera de dtw_distancia_entero() con MATEMATICA_APROXIMADA. Con n = m = 80 son 3.3e-3.
+ */
+#define DTW_COTA_CUANTIZACION(n, m) ((sqrtf((float)((n) + (m) - 1)) + 1.0f) / (float)(1 << DTW_Q))
+
+/**
+ * @def DTW_INF_ENTERO
+ * @brief "Infinito" del DTW entero: los costos acumulados saturan en este valor.
+ */
+#define DTW_INF_ENTERO UINT32_MAX
+
+/**
+ * @def DTW_CONJUNTO_MAX
+ * @brief Cantidad máxima de plantillas que dtw_banda_conjunto() compara en un mismo recorrido de la consulta.
+ */
+#define DTW_CONJUNTO_MAX 8
+
+/**
+ * @brief DTW con banda de Sakoe-Chiba, dos filas de memoria y abandono temprano.
+ *
+ * Solo evalúa las celdas a menos de @p banda ventanas de la diagonal y guarda únicamente
+ * la fila actual y la anterior (O(m) de memoria en lugar de la matriz completa de dtw()).
+ * Si el mínimo de una fila ya supera el umbral, ninguna alineación puede quedar por debajo
+ * y se abandona devolviendo INF.
+ *
+ * @param s1 Primera secuencia.
+ * @param n Longitud de la primera secuencia.
+ * @param s2 Segunda secuencia.
+ * @param m Longitud de la segunda secuencia (máximo MAX_SIZE - 1).
+ * @param banda Radio de la banda en muestras; se amplía si no alcanza para unir (1,1) con (n,m).
+ * @param umbral Distancia de decisión; con umbral <= 0 no se abandona.
+ * @param est Estadísticas de salida (puede ser NULL).
+ * @return Distancia DTW dentro de la banda, o INF si se abandonó.
+ */
+float dtw_banda(const float *s1, int n, const float *s2, int m, int banda, float umbral, struct Dtw_estadisticas *est);
+
+/**
+ * @brief DTW con banda y final abierto: alinea toda @p s2 con el prefijo de @p s1 que dé menor costo.
+ *
+ * Para capturas que terminaron antes que la plantilla (al detectar silencio): la consulta debe recorrerse
+ * entera, pero la plantilla puede quedar sin cubrir al final. Ambas secuencias tienen la misma duración
+ * por ventana, así la banda sigue la diagonal de pendiente 1 en lugar de la que une (1,1) con (n,m).
+ *
+ * @param s1 Secuencia de referencia (plantilla), con final abierto.
+ * @param n Longitud de s1.
+ * @param fin_min Prefijo mínimo de s1 que debe cubrir el camino (p. ej. hasta su último pico).
+ * @param s2 Secuencia consultada, recorrida completa (máximo MAX_SIZE - 1).
+ * @param m Longitud de s2.
+ * @param banda Radio de la banda en ventanas (mínimo 1).
+ * @param umbral Distancia de decisión; con umbral <= 0 no se abandona.
+ * @param est Estadísticas de salida (puede ser NULL).
+ * @return Menor distancia DTW sobre los finales posibles en s1, o INF si se abandonó o s2 no alcanza fin_min.
+ */
+float dtw_banda_final_abierto(const float *s1, int n, int fin_min, const float *s2, int m, int banda, float umbral,
+                              struct Dtw_estadisticas *est);
+
+/**
+ * @brief Plantilla a comparar en dtw_banda_conjunto(), con la alineación de la consulta que le corresponde.
+ */
+struct Dtw_candidato
+{
+    const uint16_t *plantilla; /**< Secuencia de la plantilla, cuantizada con dtw_cuantizar(). */
+    int m;                     /**< Longitud de la plantilla (máximo MAX_SIZE - 1). */
+    int desplazamiento;        /**< Ventanas que se adelanta la consulta para esta plantilla (prealineación). */
+    int largo;                 /**< Elementos de la consulta alineada que recorre el camino. */
+    int final_abierto;         /**< 1: el camino puede terminar en cualquier elemento de la plantilla desde fin_min. */
+    int fin_min;               /**< Prefijo mínimo de la plantilla con final abierto. */
+    uint32_t limite;           /**< Umbral de la plantilla al cuadrado (dtw_limite_entero()). */
+};
+
+/**
+ * @brief Filas de costo acumulado de dtw_banda_conjunto(): dos por plantilla, del lado de la plantilla.
+ *
+ * Ocupa unos 5 KB, así que lo reserva quien llama (no la pila).
+ */
+struct Dtw_conjunto
+{
+    uint32_t filas[DTW_CONJUNTO_MAX][2][MAX_SIZE]; /**< Fila anterior y actual de cada plantilla, en Q(2 DTW_Q). */
+    int rango_ini[DTW_CONJUNTO_MAX][2];            /**< Primera columna escrita por última vez en cada fila. */
+    int rango_fin[DTW_CONJUNTO_MAX][2];            /**< Última columna escrita por última vez en cada fila. */
+    int banda[DTW_CONJUNTO_MAX];                   /**< Radio de banda de cada plantilla (ampliado si hace falta). */
+    int activo[DTW_CONJUNTO_MAX];                  /**< 1 mientras la plantilla siga en carrera. */
+};
+
+/**
+ * @brief Cuantiza una característica a Q DTW_Q sin signo, saturando en el rango de uint16.
+ *
+ * @param x Valor de la característica.
+ * @return Valor cuantizado.
+ */
+uint16_t dtw_cuantizar(float x);
+
+/**
+ * @brief Cuantiza una secuencia de características con dtw_cuantizar().
+ *
+ * @param x Secuencia de entrada.
+ * @param n Longitud de la secuencia.
+ * @param q Secuencia cuantizada de salida.
+ */
+void dtw_cuantizar_secuencia(const float *x, int n, uint16_t *q);
+
+/**
+ * @brief Convierte una distancia de decisión en el límite del DTW entero: su cuadrado en Q(2 DTW_Q).
+ *
+ * @param umbral Distancia de decisión; con umbral <= 0 no se abandona.
+ * @return Límite del costo acumulado, o DTW_INF_ENTERO sin umbral.
+ */
+uint32_t dtw_limite_entero(float umbral);
+
+/**
+ * @brief Convierte un costo acumulado del DTW entero en la distancia equivalente de dtw_banda().
+ *
+ * Solo para informar el resultado: las decisiones se toman con el costo al cuadrado.
+ *
+ * @param costo Costo acumulado en Q(2 DTW_Q).
+ * @return Distancia, o INF si el costo saturó.
+ */
+float dtw_distancia_entero(uint32_t costo);
+
+/**
+ * @brief DTW entero con banda de una consulta contra varias plantillas en un único recorrido de la consulta.
+ *
+ * Cada elemento de la consulta se lee una sola vez por fila y avanza una fila de la matriz de cada
+ * plantilla en carrera. Una plantilla sale apenas el mínimo de su fila (cota inferior de su costo final)
+ * supera su límite o el mejor costo ya terminado, y el recorrido se corta cuando no queda ninguna.
+ * Es equivalente a llamar a dtw_banda() o dtw_banda_final_abierto() por plantilla con la consulta alineada,
+ * quedándose con la menor distancia bajo su umbral.
+ *
+ * Las características van en Q DTW_Q (uint16) y los costos en acumuladores uint32 que saturan: cada celda
+ * es una resta, un producto y dos comparaciones enteras, sin flotantes ni raíz, y el resultado es idéntico
+ * bit a bit en el host y en el RP2040.
+ *
+ * @param cj Espacio de trabajo.
+ * @param consulta Consulta cuantizada sin alinear; cada candidato la lee desplazada.
+ * @param n Longitud de la consulta.
+ * @param relleno Valor de la consulta fuera de [0, n) al desplazarla.
+ * @param cand Plantillas a comparar (máximo DTW_CONJUNTO_MAX).
+ * @param k Cantidad de plantillas.
+ * @param banda Radio de la banda en ventanas; se amplía por plantilla como en dtw_banda().
+ * @param costo Salida: costo acumulado de la plantilla elegida (Q(2 DTW_Q)), o DTW_INF_ENTERO si ninguna pasa.
+ * @param est Estadísticas de salida (puede ser NULL); abandonado cuenta las plantillas descartadas.
+ * @return Índice en @p cand de la plantilla más cercana bajo su límite, o -1 si ninguna lo pasa.
+ */
+int dtw_banda_conjunto(struct Dtw_conjunto *cj, const uint16_t *consulta, int n, uint16_t relleno,
+                       const struct Dtw_candidato *cand, int k, int banda, uint32_t *costo,
+                       struct Dtw_estadisticas *est);
+
+/**
+ * @brief Calcula la envolvente superior e inferior de una secuencia para LB_Keogh.
+ *
+ * sup[i] e inf[i] son el máximo y el mínimo de s dentro de la banda [i - banda, i + banda].
+ *
+ * @param s Secuencia (normalmente una plantilla).
+ * @param n Longitud de la secuencia.
+ * @param banda Radio de la banda (el mismo que se usará en dtw_banda()).
+ * @param sup Array de salida con la envolvente superior.
+ * @param inf Array de salida con la envolvente inferior.
+ */
+void dtw_envolvente(const float *s, int n, int banda, float *sup, float *inf);
+
+/**
+ * @brief Cota inferior LB_Kim (primer y último elemento) del DTW acumulado, sin raíz.
+ *
+ * @param s1 Primera secuencia.
+ * @param n Longitud de la primera secuencia.
+ * @param s2 Segunda secuencia.
+ * @param m Longitud de la segunda secuencia.
+ * @return Cota inferior del costo acumulado de dtw_banda() (al cuadrado).
+ */
+float lb_kim(const float *s1, int n, const float *s2, int m);
+
+/**
+ * @brief Cota inferior LB_Keogh del DTW acumulado con banda, sin raíz.
+ *
+ * Válida cuando la consulta y la plantilla tienen la misma longitud.
+ *
+ * @param consulta Secuencia consultada.
+ * @param n Longitud de la consulta (igual a la de la envolvente).
+ * @param sup Envolvente superior de la plantilla (ver dtw_envolvente()).
+ * @param inf Envolvente inferior de la plantilla.
+ * @param limite Se deja de acumular al superar este valor.
+ * @return Cota inferior del costo acumulado (al cuadrado).
+ */
+float lb_keogh(const float *consulta, int n, const float *sup, const float *inf, float limite);
+
+/**
+ * @brief Estado del DTW de subsecuencia (algoritmo SPRING) para una plantilla.
+ *
+ * Guarda solo dos columnas de costo acumulado y el instante de inicio de cada camino, así que el trabajo
+ * y la memoria por muestra del flujo son O(m), sin importar cuánto tiempo lleve corriendo.
+ */
+struct Spring_estado
+{
+    float d[2][MAX_SIZE];       /**< Columnas de costo acumulado (anterior y actual). */
+    int32_t inicio[2][MAX_SIZE]; /**< Instante de inicio del mejor camino que llega a cada celda. */
+    int fila;                   /**< Índice de la columna anterior en d e inicio. */
+    float d_min;                /**< Mejor costo de la coincidencia pendiente de confirmar. */
+    int32_t t_ini;              /**< Inicio de la coincidencia pendiente. */
+    int32_t t_fin;              /**< Fin de la coincidencia pendiente. */
+};
+
+/**
+ * @brief Coincidencia reportada por el DTW de subsecuencia.
+ */
+struct Coincidencia_subsecuencia
+{
+    float distancia; /**< Distancia DTW (con raíz) entre la plantilla y el tramo del flujo. */
+    int32_t t_ini;   /**< Primer instante del tramo coincidente. */
+    int32_t t_fin;   /**< Último instante del tramo coincidente. */
+};
+
+/**
+ * @brief Reinicia el estado SPRING para una plantilla de m elementos.
+ *
+ * @param st Estado a inicializar.
+ * @param m Longitud de la plantilla (máximo MAX_SIZE - 1).
+ */
+void spring_iniciar(struct Spring_estado *st, int m);
+
+/**
+ * @brief Avanza el DTW de subsecuencia (inicio y fin abiertos) con un nuevo elemento del flujo.
+ *
+ * Una coincidencia se reporta cuando su costo está bajo el límite y ningún camino que la solape
+ * puede mejorarla, por lo que se informa con el mínimo retardo posible y una sola vez.
+ *
+ * @param st Estado SPRING de la plantilla.
+ * @param plantilla Secuencia de la plantilla.
+ * @param m Longitud de la plantilla.
+ * @param x Nuevo elemento del flujo.
+ * @param t Índice del elemento en el flujo (creciente).
+ * @param limite Costo acumulado máximo (umbral al cuadrado).
+ * @param coincidencia Coincidencia reportada (solo válida si la función devuelve 1).
+ * @return 1 si se confirmó una coincidencia en este paso, 0 en caso contrario.
+ */
+int spring_actualizar(struct Spring_estado *st, const float *plantilla, int m, float x, int32_t t, float limite,
+                      struct Coincidencia_subsecuencia *coincidencia);
+
+/**
+ * @brief Indica si la plantilla todavía puede producir una coincidencia que empiece antes de t_fin.
+ *
+ * Se usa para arbitrar entre plantillas que se solapan (por ejemplo, dos aplausos dentro de tres).
+ *
+ * @param st Estado SPRING ya actualizado con el último elemento.
+ * @param m Longitud de la plantilla.
+ * @param limite Costo acumulado máximo de la plantilla (umbral al cuadrado).
+ * @param t_fin Instante de referencia.
+ * @return 1 si hay un camino o una coincidencia pendiente bajo el límite que empieza en o antes de t_fin.
+ */
+int spring_camino_activo(const struct Spring_estado *st, int m, float limite, int32_t t_fin);
+
+/**
+ * @brief Reinicia el decimador (líneas de retardo en cero).
+ *
+ * @param d Decimador a inicializar.
+ */
+void decimador_iniciar(struct Decimador *d);
+
+/**
+ * @brief Entrega una muestra al decimador polifásico (solo aritmética entera).
+ *
+ * El filtro antialias (fir_decimacion_q15) se genera en tiempo de compilación. Con DECIMACION_FACTOR 1
+ * la muestra pasa sin cambios.
+ *
+ * @param d Decimador en curso.
+ * @param x Muestra de entrada, centrada en cero.
+ * @param y Muestra de salida a la tasa reducida (solo válida si la función devuelve 1).
+ * @return 1 cada DECIMACION_FACTOR muestras de entrada, cuando hay una muestra de salida.
+ */
+int decimador_agregar(struct Decimador *d, int16_t x, int16_t *y);
+
+/**
+ * @brief Reinicia la DFT deslizante (ventana en cero).
+ *
+ * @param s DFT deslizante a inicializar.
+ */
+void sdft_iniciar(struct Sdft *s);
+
+/**
+ * @brief Desliza la ventana una muestra y actualiza los bins seguidos en O(GOERTZEL_NUM_BANDAS).
+ *
+ * Cuesta dos multiplicaciones enteras por bin y muestra, frente a una FFT completa por muestra para
+ * obtener la misma envolvente con salto 1.
+ *
+ * @param s DFT deslizante en curso.
+ * @param x Muestra nueva, centrada en cero (rango del ADC de 12 bits, para que la suma quepa en 32 bits).
+ */
+void sdft_agregar(struct Sdft *s, int16_t x);
+
+/**
+ * @brief Amplitud promedio de los bins seguidos sobre las últimas SDFT_TAMANO muestras.
+ *
+ * Multiplicada por el factor de normalización de las muestras equivale a energia_bandas_goertzel()
+ * de la misma ventana.
+ *
+ * @param s DFT deslizante en curso.
+ * @return Promedio de |X[k]| en las unidades de la entrada.
+ */
+float sdft_amplitud(const struct Sdft *s);
+
 #endif // MEASURELIBS_H
\ No newline at end of file
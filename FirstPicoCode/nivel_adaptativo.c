@@ -0,0 +1,44 @@
+#include "nivel_adaptativo.h"
+
+void nivel_adaptativo_iniciar(struct Nivel_adaptativo *n, int dc_inicial)
+{
+    n->dc = (int32_t)dc_inicial << NIVEL_DC_Q;
+    n->ruido = ((int32_t)NIVEL_UMBRAL_INICIAL << NIVEL_RUIDO_Q) / NIVEL_FACTOR_UMBRAL;
+    n->umbral = NIVEL_UMBRAL_INICIAL;
+    n->disparos = 0;
+    n->disparos_falsos = 0;
+}
+
+int nivel_adaptativo_procesar(struct Nivel_adaptativo *n, int raw)
+{
+    // Continua: promedio exponencial (raw < 2^12, cabe en 32 bits con 16 bits fraccionarios).
+    // Con menos bits fraccionarios el truncado del desplazamiento sesga la estimación hacia abajo
+    n->dc += (((int32_t)raw << NIVEL_DC_Q) - n->dc) >> NIVEL_DC_DESPLAZAMIENTO;
+
+    int centrada = raw - nivel_adaptativo_dc(n);
+    int32_t magnitud = (centrada < 0) ? -centrada : centrada;
+
+    // Piso de ruido: media de |x| con las muestras del disparo recortadas y casi congeladas
+    if (magnitud < n->umbral)
+    {
+        n->ruido += ((magnitud << NIVEL_RUIDO_Q) - n->ruido) >> NIVEL_RUIDO_DESPLAZAMIENTO;
+    }
+    else
+    {
+        n->ruido += ((n->umbral << NIVEL_RUIDO_Q) - n->ruido) >> NIVEL_RUIDO_DESPLAZAMIENTO_DISPARO;
+    }
+
+    // El piso no pasa de NIVEL_UMBRAL_MAX en Q16: el producto cabe en 32 bits
+    int32_t umbral = (n->ruido * NIVEL_FACTOR_UMBRAL) >> NIVEL_RUIDO_Q;
+    if (umbral < NIVEL_UMBRAL_MIN)
+    {
+        umbral = NIVEL_UMBRAL_MIN;
+    }
+    else if (umbral > NIVEL_UMBRAL_MAX)
+    {
+        umbral = NIVEL_UMBRAL_MAX;
+    }
+    n->umbral = umbral;
+
+    return centrada;
+}
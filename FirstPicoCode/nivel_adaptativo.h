@@ -0,0 +1,125 @@
+#ifndef NIVEL_ADAPTATIVO_H
+#define NIVEL_ADAPTATIVO_H
+
+/**
+ * @file nivel_adaptativo.h
+ * @brief Estimadores en flujo del nivel de continua, del piso de ruido y del umbral de disparo.
+ *
+ * Pensado para la interrupción del ADC: solo enteros, unas pocas sumas y desplazamientos por muestra.
+ * El umbral de disparo sigue al piso de ruido, así en una sala ruidosa no se dispara la FFT y el DTW
+ * con cada ruido y en una silenciosa se detectan aplausos suaves.
+ */
+
+#include <stdint.h>        /**< Definiciones de tipos de datos enteros con tamaño fijo */
+
+/**
+ * @def NIVEL_DC_Q
+ * @brief Bits fraccionarios de la estimación de continua.
+ */
+#define NIVEL_DC_Q 16
+
+/**
+ * @def NIVEL_RUIDO_Q
+ * @brief Bits fraccionarios de la estimación del piso de ruido.
+ */
+#define NIVEL_RUIDO_Q 16
+
+/**
+ * @def NIVEL_DC_DESPLAZAMIENTO
+ * @brief Constante de tiempo de la continua: 2^n muestras (1 s a 8 kHz).
+ */
+#define NIVEL_DC_DESPLAZAMIENTO 13
+
+/**
+ * @def NIVEL_RUIDO_DESPLAZAMIENTO
+ * @brief Constante de tiempo del piso de ruido con muestras bajo el umbral: 2^n muestras (1 s a 8 kHz).
+ */
+#define NIVEL_RUIDO_DESPLAZAMIENTO 13
+
+/**
+ * @def NIVEL_RUIDO_DESPLAZAMIENTO_DISPARO
+ * @brief Constante de tiempo del piso con muestras sobre el umbral (8 s): un aplauso casi no lo mueve,
+ * un ruido fuerte sostenido lo sube en unos segundos.
+ */
+#define NIVEL_RUIDO_DESPLAZAMIENTO_DISPARO 16
+
+/**
+ * @def NIVEL_FACTOR_UMBRAL
+ * @brief Umbral de disparo en veces el piso de ruido (media de |x - continua|).
+ */
+#define NIVEL_FACTOR_UMBRAL 6
+
+/**
+ * @def NIVEL_UMBRAL_MIN
+ * @brief Umbral mínimo (códigos del ADC sobre la continua), para que una sala en silencio no dispare con el ruido del ADC.
+ */
+#define NIVEL_UMBRAL_MIN 300
+
+/**
+ * @def NIVEL_UMBRAL_MAX
+ * @brief Umbral máximo, por debajo de la saturación del ADC.
+ */
+#define NIVEL_UMBRAL_MAX 1800
+
+/**
+ * @def NIVEL_UMBRAL_INICIAL
+ * @brief Umbral al arrancar, hasta que el piso de ruido converge (el antiguo umbral fijo de 3000 códigos).
+ */
+#define NIVEL_UMBRAL_INICIAL 890
+
+/**
+ * @brief Estado de los estimadores y estadísticas de disparo para ajustar el umbral en campo.
+ */
+struct Nivel_adaptativo
+{
+    int32_t dc;                         /**< Continua en códigos del ADC, Q NIVEL_DC_Q. */
+    int32_t ruido;                      /**< Media de |x - continua| en códigos, Q NIVEL_RUIDO_Q. */
+    int32_t umbral;                     /**< Umbral de disparo vigente, en códigos sobre la continua. */
+    volatile uint32_t disparos;         /**< Capturas disparadas. */
+    volatile uint32_t disparos_falsos;  /**< Capturas disparadas que no correspondían a ningún patrón. */
+};
+
+/**
+ * @brief Inicializa los estimadores.
+ *
+ * @param n Estado a inicializar.
+ * @param dc_inicial Continua esperada (código del ADC en reposo).
+ */
+void nivel_adaptativo_iniciar(struct Nivel_adaptativo *n, int dc_inicial);
+
+/**
+ * @brief Actualiza la continua, el piso de ruido y el umbral con una muestra cruda.
+ *
+ * Las muestras sobre el umbral actualizan el piso con la constante lenta y recortadas al umbral, así
+ * los aplausos no inflan el piso.
+ *
+ * @param n Estado en curso.
+ * @param raw Muestra cruda del ADC.
+ * @return Muestra centrada (raw menos la continua estimada).
+ */
+int nivel_adaptativo_procesar(struct Nivel_adaptativo *n, int raw);
+
+/**
+ * @brief Continua estimada en códigos enteros del ADC.
+ *
+ * @param n Estado en curso.
+ * @return Código del ADC en reposo.
+ */
+static inline int nivel_adaptativo_dc(const struct Nivel_adaptativo *n)
+{
+    return (n->dc + (1 << (NIVEL_DC_Q - 1))) >> NIVEL_DC_Q;
+}
+
+/**
+ * @brief Indica si una muestra centrada supera el umbral de disparo.
+ *
+ * @param n Estado en curso.
+ * @param centrada Muestra devuelta por nivel_adaptativo_procesar().
+ * @return 1 si |centrada| alcanza el umbral, 0 en caso contrario.
+ */
+static inline int nivel_adaptativo_supera(const struct Nivel_adaptativo *n, int centrada)
+{
+    return ((centrada < 0) ? -centrada : centrada) >= n->umbral;
+}
+
+#endif // NIVEL_ADAPTATIVO_H
@@ -0,0 +1,74 @@
+#include "precision_matematica.h"
+
+// Error relativo de exp2_aprox(x) respecto de exp2f() sobre el argumento ya saturado
+static float error_exp2(float x)
+{
+    float saturado = fminf(fmaxf(x, -126.0f), 127.99f);
+    float exacta = exp2f(saturado);
+    return fabsf(exp2_aprox(x) - exacta) / exacta;
+}
+
+void medir_precision_matematica(struct Precision_matematica *res)
+{
+    uint32_t semilla = 12345;
+
+    // Magnitud: todos los ángulos a varios radios, en flotante y en enteros del rango de la FFT Q15
+    res->error_magnitud = 0.0f;
+    res->error_magnitud_entera = 0.0f;
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        float angulo = 6.28318531f * i / PRECISION_PUNTOS;
+        float radio = 1.0f + (float)(i % 97) * 300.0f;
+        float a = radio * cosf(angulo);
+        float b = radio * sinf(angulo);
+        float exacta = sqrtf(a * a + b * b);
+        res->error_magnitud = fmaxf(res->error_magnitud, fabsf(magnitud_alfa_beta(a, b) - exacta) / exacta);
+
+        int32_t re = (int32_t)lrintf(a), im = (int32_t)lrintf(b);
+        float exacta_entera = sqrtf((float)re * re + (float)im * im);
+        if (exacta_entera >= 256.0f) // Lejos de los códigos chicos, donde domina el redondeo
+        {
+            res->error_magnitud_entera = fmaxf(res->error_magnitud_entera,
+                                               fabsf((float)magnitud_alfa_beta_entera(re, im) - exacta_entera) / exacta_entera);
+        }
+    }
+
+    // Raíz entera: cuadrados exactos, sus vecinos y valores pseudoaleatorios de 32 bits
+    res->errores_raiz = 0;
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        semilla = semilla * 1664525u + 1013904223u;
+        uint32_t k = (uint32_t)i * 16u + 65000u * (i & 1);
+        uint32_t x = (i % 3 == 0) ? k * k : ((i % 3 == 1) ? k * k - 1u : semilla);
+        uint32_t r = raiz_entera(x);
+        // floor(sqrt(x)): r^2 <= x < (r + 1)^2, comparado en 64 bits
+        res->errores_raiz += !(((uint64_t)r * r <= x) && ((uint64_t)(r + 1) * (r + 1) > x));
+    }
+
+    // log2 sobre 12 décadas y exp2 sobre [-20, 20]
+    res->error_log2 = 0.0f;
+    res->error_exp2 = 0.0f;
+    for (int i = 0; i < PRECISION_PUNTOS; i++)
+    {
+        float x = exp2f(-20.0f + 40.0f * i / PRECISION_PUNTOS + 0.37f);
+        res->error_log2 = fmaxf(res->error_log2, fabsf(log2_aprox(x) - log2f(x)));
+        res->error_exp2 = fmaxf(res->error_exp2, error_exp2(-20.0f + 40.0f * i / PRECISION_PUNTOS + 0.013f));
+    }
+
+    // Bordes de exp2: justo bajo cada entero la parte fraccionaria redondea a 1, y fuera de [-126, 128) satura
+    for (int n = -125; n <= 127; n++)
+    {
+        res->error_exp2 = fmaxf(res->error_exp2, error_exp2(nextafterf((float)n, -INFINITY)));
+    }
+    const float extremos[] = {-1e-9f, -1e-30f, -0.0f, -126.0f, -200.0f, 127.99f, 200.0f};
+    for (unsigned i = 0; i < sizeof(extremos) / sizeof(extremos[0]); i++)
+    {
+        res->error_exp2 = fmaxf(res->error_exp2, error_exp2(extremos[i]));
+    }
+}
+
+int precision_matematica_aceptable(const struct Precision_matematica *res)
+{
+    return (res->error_magnitud <= COTA_ERROR_MAGNITUD) && (res->error_magnitud_entera <= COTA_ERROR_MAGNITUD_ENTERA) &&
+           (res->errores_raiz == 0) && (res->error_log2 <= COTA_ERROR_LOG2) && (res->error_exp2 <= COTA_ERROR_EXP2);
+}
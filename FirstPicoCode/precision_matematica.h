@@ -0,0 +1,77 @@
+#ifndef PRECISION_MATEMATICA_H
+#define PRECISION_MATEMATICA_H
+
+/**
+ * @file precision_matematica.h
+ * @brief Medición de la exactitud de los núcleos de matematica_aproximada.h frente a la libm.
+ *
+ * No depende del SDK de la Pico: la usa benchmark_matematica() en la placa y el arnés de tools/host
+ * en la computadora de desarrollo, donde además corre con los sanitizadores de direcciones y de
+ * comportamiento indefinido.
+ */
+
+#include <stdint.h>                  /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include "matematica_aproximada.h"   /**< Núcleos medidos */
+
+/**
+ * @def PRECISION_PUNTOS
+ * @brief Argumentos evaluados por cada núcleo aproximado.
+ */
+#define PRECISION_PUNTOS 4096
+
+/**
+ * @def COTA_ERROR_MAGNITUD
+ * @brief Error relativo máximo documentado de magnitud_alfa_beta() (3.96 %).
+ */
+#define COTA_ERROR_MAGNITUD 0.0397f
+
+/**
+ * @def COTA_ERROR_MAGNITUD_ENTERA
+ * @brief Error relativo máximo de magnitud_alfa_beta_entera() con magnitudes desde 256: 3.96 % más medio código.
+ */
+#define COTA_ERROR_MAGNITUD_ENTERA 0.0417f
+
+/**
+ * @def COTA_ERROR_LOG2
+ * @brief Error absoluto máximo documentado de log2_aprox().
+ */
+#define COTA_ERROR_LOG2 4.4e-5f
+
+/**
+ * @def COTA_ERROR_EXP2
+ * @brief Error relativo máximo documentado de exp2_aprox().
+ */
+#define COTA_ERROR_EXP2 1.5e-5f
+
+/**
+ * @brief Errores máximos medidos de cada núcleo.
+ */
+struct Precision_matematica
+{
+    float error_magnitud;         /**< Error relativo máximo de magnitud_alfa_beta(). */
+    float error_magnitud_entera;  /**< Error relativo máximo de magnitud_alfa_beta_entera() (magnitudes >= 256). */
+    int errores_raiz;             /**< Resultados de raiz_entera() distintos de floor(sqrt(x)). */
+    float error_log2;             /**< Error absoluto máximo de log2_aprox(). */
+    float error_exp2;             /**< Error relativo máximo de exp2_aprox(), incluidos los bordes enteros y las saturaciones. */
+};
+
+/**
+ * @brief Mide todos los núcleos sobre PRECISION_PUNTOS argumentos cada uno, más los casos de borde.
+ *
+ * Magnitud en todos los ángulos a varios radios; raíz entera sobre cuadrados exactos, sus vecinos y valores
+ * de 32 bits; log2 sobre 12 décadas; exp2 sobre [-20, 20], el flotante inmediato bajo cada entero y fuera
+ * del rango de saturación.
+ *
+ * @param res Errores medidos.
+ */
+void medir_precision_matematica(struct Precision_matematica *res);
+
+/**
+ * @brief Compara los errores medidos con las cotas documentadas.
+ *
+ * @param res Errores medidos por medir_precision_matematica().
+ * @return 1 si todos los núcleos cumplen su cota, 0 si alguno la excede.
+ */
+int precision_matematica_aceptable(const struct Precision_matematica *res);
+
+#endif // PRECISION_MATEMATICA_H
@@ -0,0 +1,293 @@
+#include "reconocedor.h"
+
+static struct Dtw_conjunto dtw_conjunto; // Filas del DTW conjunto de clasificar(): demasiado grandes para la pila
+
+void biblioteca_iniciar(struct Biblioteca_plantillas *bib, int banda, int lag_max)
+{
+    bib->cantidad = 0;
+    bib->banda = banda;
+    bib->lag_max = lag_max;
+}
+
+// Desplaza la consulta lag ventanas; lo que queda fuera se rellena con el extremo más silencioso
+static void alinear_consulta(const float *q, int n, int lag, float *alineada)
+{
+    float relleno = fminf(q[0], q[n - 1]);
+    for (int i = 0; i < n; i++)
+    {
+        int j = i + lag;
+        alineada[i] = ((j >= 0) && (j < n)) ? q[j] : relleno;
+    }
+}
+
+// Completa hasta NUM_VENTANAS una captura terminada antes por silencio, con el mismo relleno que alinear_consulta()
+static void rellenar_consulta(const float *q, int n, float *rellenada)
+{
+    float relleno = fminf(q[0], q[n - 1]);
+    for (int i = 0; i < NUM_VENTANAS; i++)
+    {
+        rellenada[i] = (i < n) ? q[i] : relleno;
+    }
+}
+
+int biblioteca_agregar(struct Biblioteca_plantillas *bib, const char *etiqueta, float umbral,
+                       const float *senal, float frecuencia_muestreo, accion_plantilla_t accion)
+{
+    struct Caracteristicas caract;
+    extraer_caracteristicas(senal, frecuencia_muestreo, &caract);
+    return biblioteca_agregar_caracteristicas(bib, etiqueta, umbral, &caract, accion);
+}
+
+int biblioteca_agregar_caracteristicas(struct Biblioteca_plantillas *bib, const char *etiqueta, float umbral,
+                                       const struct Caracteristicas *caract, accion_plantilla_t accion)
+{
+    if (bib->cantidad >= MAX_PLANTILLAS)
+    {
+        return -1;
+    }
+
+    struct Plantilla *p = &bib->plantillas[bib->cantidad];
+    p->etiqueta = etiqueta;
+    p->umbral = umbral;
+    p->accion = accion;
+
+    // La envolvente y la versión cuantizada se calculan una sola vez al registrar
+    p->caract = *caract;
+    dtw_envolvente(p->caract.amplitudes, p->caract.num_ventanas, bib->banda, p->envolvente_sup, p->envolvente_inf);
+    dtw_cuantizar_secuencia(p->caract.amplitudes, p->caract.num_ventanas, p->amplitudes_q);
+    p->limite_q = dtw_limite_entero(umbral);
+
+    // Una captura cortada por silencio debe haber llegado al último pico (el resto de la plantilla es la cola)
+    float maximo = 0.0f;
+    for (int i = 0; i < p->caract.num_ventanas; i++)
+    {
+        maximo = fmaxf(maximo, p->caract.amplitudes[i]);
+    }
+    p->fin_contenido = 1;
+    for (int i = 0; i < p->caract.num_ventanas; i++)
+    {
+        if (p->caract.amplitudes[i] >= FIN_ABIERTO_FRACCION_PICO * maximo)
+        {
+            p->fin_contenido = i + 1;
+        }
+    }
+
+    return bib->cantidad++;
+}
+
+void clasificar(const struct Biblioteca_plantillas *bib, const struct Caracteristicas *consulta,
+                struct Resultado_clasificacion *res)
+{
+    int candidatos[MAX_PLANTILLAS];
+    int lags[MAX_PLANTILLAS];
+    int largos[MAX_PLANTILLAS];
+    int num_candidatos = 0;
+    float alineada[NUM_VENTANAS];
+    float rellenada[NUM_VENTANAS];
+    const float *base = consulta->amplitudes;
+    const float *q = consulta->amplitudes;
+    int n = consulta->num_ventanas;
+
+    res->indice = -1;
+    res->etiqueta = NULL;
+    res->distancia = INF;
+    res->podadas_kim = 0;
+    res->podadas_keogh = 0;
+    res->dtw_evaluados = 0;
+    res->lag = 0;
+
+    // Una captura cortada por silencio se prealinea rellenada al largo de la plantilla
+    if (n < NUM_VENTANAS)
+    {
+        rellenar_consulta(consulta->amplitudes, n, rellenada);
+        base = rellenada;
+    }
+
+    // Etapas baratas: cada plantilla se compara contra su propio umbral (al cuadrado)
+    for (int k = 0; k < bib->cantidad; k++)
+    {
+        const struct Plantilla *p = &bib->plantillas[k];
+        float limite = p->umbral * p->umbral;
+        int m = p->caract.num_ventanas;
+        int abierto = (n < m); // Final abierto: la plantilla puede quedar sin cubrir al final
+
+        // Prealineación por el pico de la correlación cruzada
+        lags[k] = 0;
+        largos[k] = n;
+        if ((bib->lag_max > 0) && (abierto || (m == n)))
+        {
+            correlacion_cruzada_fft(p->caract.amplitudes, base, m, bib->lag_max, &lags[k]);
+            alinear_consulta(base, m, lags[k], alineada);
+            q = alineada;
+            if (abierto)
+            {
+                // Adelantar la captura descarta sus primeras ventanas; atrasarla agrega relleno al inicio
+                largos[k] = n - lags[k];
+                largos[k] = (largos[k] < 1) ? 1 : ((largos[k] > m) ? m : largos[k]);
+            }
+        }
+        else
+        {
+            q = consulta->amplitudes;
+        }
+
+        // Con final abierto solo el primer elemento está fijo en el camino
+        float cota = abierto ? lb_kim(p->caract.amplitudes, 1, q, 1) : lb_kim(p->caract.amplitudes, m, q, n);
+        if (cota >= limite)
+        {
+            res->podadas_kim++;
+            continue;
+        }
+
+        // LB_Keogh solo es válido con secuencias de igual longitud, o sobre el prefijo con final abierto
+        if (abierto || (m == n))
+        {
+            cota = lb_keogh(q, largos[k], p->envolvente_sup, p->envolvente_inf, limite);
+            if (cota >= limite)
+            {
+                res->podadas_keogh++;
+                continue;
+            }
+        }
+
+        candidatos[num_candidatos++] = k;
+    }
+
+    // DTW completo de los sobrevivientes en un solo recorrido de la consulta: cada plantilla la lee con su
+    // propio desplazamiento y sale en cuanto su fila supera su umbral o la mejor distancia ya terminada
+    struct Dtw_candidato cand[MAX_PLANTILLAS];
+    for (int c = 0; c < num_candidatos; c++)
+    {
+        const struct Plantilla *p = &bib->plantillas[candidatos[c]];
+        int m = p->caract.num_ventanas;
+
+        cand[c].plantilla = p->amplitudes_q;
+        cand[c].m = m;
+        cand[c].desplazamiento = lags[candidatos[c]];
+        cand[c].largo = largos[candidatos[c]];
+        cand[c].final_abierto = (n < m);
+        cand[c].fin_min = p->fin_contenido;
+        cand[c].limite = p->limite_q;
+    }
+
+    // Misma consulta base y relleno que alinear_consulta(), cuantizados una vez para todas las plantillas
+    uint16_t base_q[NUM_VENTANAS];
+    uint32_t costo;
+    int largo_base = (n < NUM_VENTANAS) ? NUM_VENTANAS : n;
+    dtw_cuantizar_secuencia(base, largo_base, base_q);
+    uint16_t relleno = (base_q[0] < base_q[largo_base - 1]) ? base_q[0] : base_q[largo_base - 1];
+    int elegido = dtw_banda_conjunto(&dtw_conjunto, base_q, largo_base, relleno, cand, num_candidatos, bib->banda,
+                                     &costo, NULL);
+    res->dtw_evaluados = num_candidatos;
+
+    if (elegido >= 0)
+    {
+        res->distancia = dtw_distancia_entero(costo);
+        res->indice = candidatos[elegido];
+        res->etiqueta = bib->plantillas[res->indice].etiqueta;
+        res->lag = lags[res->indice];
+    }
+}
+
+void detector_continuo_iniciar(struct Detector_continuo *det, const struct Biblioteca_plantillas *bib)
+{
+    det->bib = bib;
+    det->muestras_en_ventana = 0;
+    det->ventana_actual = 0;
+    det->hay_pendiente = 0;
+    for (int k = 0; k < bib->cantidad; k++)
+    {
+        spring_iniciar(&det->spring[k], bib->plantillas[k].caract.num_ventanas);
+    }
+}
+
+int detector_continuo_agregar(struct Detector_continuo *det, float muestra, struct Deteccion_continua *deteccion)
+{
+    det->ventana[det->muestras_en_ventana++] = muestra;
+    if (det->muestras_en_ventana < TAMANO_VENTANA)
+    {
+        return 0;
+    }
+
+    // Nuevo elemento del flujo de características
+    float amplitud = caracteristica_ventana(det->ventana);
+
+    // La próxima ventana empieza SALTO_VENTANA muestras después: se conserva el solapamiento
+    det->muestras_en_ventana = TAMANO_VENTANA - SALTO_VENTANA;
+    if (det->muestras_en_ventana > 0)
+    {
+        memmove(det->ventana, &det->ventana[SALTO_VENTANA], det->muestras_en_ventana * sizeof(float));
+    }
+    int32_t t = det->ventana_actual++;
+    int encontrado = 0;
+
+    for (int k = 0; k < det->bib->cantidad; k++)
+    {
+        const struct Plantilla *p = &det->bib->plantillas[k];
+        struct Coincidencia_subsecuencia coincidencia;
+
+        if (!spring_actualizar(&det->spring[k], p->caract.amplitudes, p->caract.num_ventanas, amplitud, t,
+                               p->umbral * p->umbral, &coincidencia))
+        {
+            continue;
+        }
+
+        if (det->hay_pendiente && (coincidencia.t_ini > det->pendiente.coincidencia.t_fin))
+        {
+            // Tramo disjunto: la detección retenida ya no compite con esta
+            *deteccion = det->pendiente;
+            encontrado = 1;
+            det->hay_pendiente = 0;
+        }
+
+        // Entre detecciones que se solapan gana la más cercana
+        if (!det->hay_pendiente || (coincidencia.distancia < det->pendiente.coincidencia.distancia))
+        {
+            det->pendiente.indice = k;
+            det->pendiente.coincidencia = coincidencia;
+            det->pendiente_desde = t;
+            det->hay_pendiente = 1;
+        }
+    }
+
+    if (encontrado || !det->hay_pendiente)
+    {
+        return encontrado;
+    }
+
+    // Arbitraje con las demás plantillas (p. ej. tres aplausos contienen a dos aplausos)
+    const struct Coincidencia_subsecuencia *retenida = &det->pendiente.coincidencia;
+    int esperar = 0;
+    for (int k = 0; k < det->bib->cantidad; k++)
+    {
+        const struct Plantilla *p = &det->bib->plantillas[k];
+        const struct Spring_estado *st = &det->spring[k];
+        float limite = p->umbral * p->umbral;
+        if (k == det->pendiente.indice)
+        {
+            continue;
+        }
+
+        // Otra plantilla ya tiene una coincidencia solapada y mejor: se descarta la retenida
+        if ((st->d_min <= limite) && (st->t_ini <= retenida->t_fin) && (sqrtf(st->d_min) < retenida->distancia))
+        {
+            det->hay_pendiente = 0;
+            return 0;
+        }
+
+        if (spring_camino_activo(st, p->caract.num_ventanas, limite, retenida->t_fin))
+        {
+            esperar = 1;
+        }
+    }
+
+    // La espera es acotada: en silencio un camino parcial puede seguir abierto indefinidamente
+    if (esperar && (t - det->pendiente_desde < DETECTOR_RETENCION_MAX))
+    {
+        return 0;
+    }
+
+    *deteccion = det->pendiente;
+    det->hay_pendiente = 0;
+    return 1;
+}
@@ -0,0 +1,191 @@
+#ifndef RECONOCEDOR_H
+#define RECONOCEDOR_H
+
+/**
+ * @file reconocedor.h
+ * @brief Biblioteca de plantillas de gestos sonoros y clasificador por vecino más cercano.
+ *
+ * Cada plantilla guarda su vector de características, una etiqueta, un umbral de decisión y la acción
+ * asociada. La clasificación aplica una cascada de cotas inferiores (LB_Kim y luego LB_Keogh) y solo
+ * ejecuta el DTW completo sobre las plantillas que sobreviven, de modo que el costo crece muy poco
+ * al agregar plantillas.
+ */
+
+#include "pico/stdlib.h"   /**< Librería principal del SDK de Raspberry Pi Pico */
+#include <stdint.h>        /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include <stdio.h>         /**< Funciones para entrada y salida estándar */
+#include "measure_libs.h"  /**< Extracción de características, DTW y cotas inferiores */
+
+/**
+ * @def MAX_PLANTILLAS
+ * @brief Cantidad máxima de plantillas en la biblioteca.
+ */
+#define MAX_PLANTILLAS 8
+
+#if MAX_PLANTILLAS > DTW_CONJUNTO_MAX
+#error "clasificar() compara todas las plantillas en un solo dtw_banda_conjunto()"
+#endif
+
+/**
+ * @def DETECTOR_RETENCION_MAX
+ * @brief Ventanas que el detector continuo retiene una detección mientras otra plantilla solapada sigue en curso.
+ */
+#define DETECTOR_RETENCION_MAX 48
+
+/**
+ * @def FIN_ABIERTO_FRACCION_PICO
+ * @brief Fracción del máximo de una plantilla que marca sus picos: una captura corta debe cubrir hasta el último.
+ */
+#define FIN_ABIERTO_FRACCION_PICO 0.5f
+
+/**
+ * @brief Acción ejecutada cuando se reconoce una plantilla.
+ */
+typedef void (*accion_plantilla_t)(void);
+
+/**
+ * @brief Patrón de referencia etiquetado (por ejemplo: dos aplausos, tres aplausos, golpes, silbidos).
+ */
+struct Plantilla
+{
+    const char *etiqueta;                  /**< Nombre del patrón, para mensajes. */
+    float umbral;                          /**< Distancia DTW máxima para aceptar el patrón. */
+    accion_plantilla_t accion;             /**< Acción asociada al patrón. */
+    struct Caracteristicas caract;         /**< Envolvente espectral de la plantilla. */
+    uint16_t amplitudes_q[NUM_VENTANAS];   /**< Envolvente cuantizada para el DTW entero. */
+    uint32_t limite_q;                     /**< Umbral al cuadrado en las unidades del DTW entero. */
+    int fin_contenido;                     /**< Ventanas hasta su último pico; el DTW de final abierto no corta antes. */
+    float envolvente_sup[NUM_VENTANAS];    /**< Envolvente superior para LB_Keogh. */
+    float envolvente_inf[NUM_VENTANAS];    /**< Envolvente inferior para LB_Keogh. */
+};
+
+/**
+ * @brief Conjunto de plantillas y parámetros comunes del DTW.
+ */
+struct Biblioteca_plantillas
+{
+    struct Plantilla plantillas[MAX_PLANTILLAS]; /**< Plantillas registradas. */
+    int cantidad;                                /**< Plantillas en uso. */
+    int banda;                                   /**< Radio de la banda de Sakoe-Chiba. */
+    int lag_max;                                 /**< Desplazamiento máximo de la prealineación (0: sin alinear). */
+};
+
+/**
+ * @brief Resultado de clasificar una captura contra la biblioteca.
+ */
+struct Resultado_clasificacion
+{
+    int indice;          /**< Índice de la plantilla reconocida, o -1 si ninguna pasa su umbral. */
+    const char *etiqueta; /**< Etiqueta de la plantilla reconocida, o NULL si no hay. */
+    float distancia;     /**< Distancia DTW a la plantilla reconocida (INF si no hay). */
+    int podadas_kim;     /**< Plantillas descartadas por LB_Kim. */
+    int podadas_keogh;   /**< Plantillas descartadas por LB_Keogh. */
+    int dtw_evaluados;   /**< Plantillas sobre las que se ejecutó el DTW. */
+    int lag;             /**< Desplazamiento aplicado a la captura para la plantilla reconocida. */
+};
+
+/**
+ * @brief Patrón encontrado por el detector continuo.
+ */
+struct Deteccion_continua
+{
+    int indice;                                    /**< Plantilla reconocida. */
+    struct Coincidencia_subsecuencia coincidencia; /**< Distancia y ventanas de inicio y fin. */
+};
+
+/**
+ * @brief Detector continuo: envolvente por ventanas y DTW de subsecuencia contra cada plantilla.
+ *
+ * No necesita disparo por umbral ni captura fija: cada SALTO_VENTANA muestras la ventana de las últimas
+ * TAMANO_VENTANA produce un elemento del flujo de características y cada plantilla avanza una columna de SPRING.
+ */
+struct Detector_continuo
+{
+    const struct Biblioteca_plantillas *bib;       /**< Plantillas a buscar. */
+    struct Spring_estado spring[MAX_PLANTILLAS];   /**< Estado SPRING de cada plantilla. */
+    float ventana[TAMANO_VENTANA];                 /**< Ventana en llenado. */
+    int muestras_en_ventana;                       /**< Muestras acumuladas en la ventana (incluido el solapamiento). */
+    int32_t ventana_actual;                        /**< Índice de ventana dentro del flujo. */
+    int hay_pendiente;                             /**< 1 si hay una detección retenida para arbitraje. */
+    struct Deteccion_continua pendiente;           /**< Mejor detección aún solapada por otra plantilla en curso. */
+    int32_t pendiente_desde;                       /**< Ventana en la que se retuvo la detección pendiente. */
+};
+
+/**
+ * @brief Deja la biblioteca vacía.
+ *
+ * Con lag_max > 0 cada captura se prealinea a cada plantilla con el pico de la correlación cruzada
+ * (buscado en +-lag_max ventanas) antes de las cotas y del DTW, lo que permite una banda mucho más angosta.
+ *
+ * @param bib Biblioteca a inicializar.
+ * @param banda Radio de la banda de Sakoe-Chiba para el DTW y LB_Keogh.
+ * @param lag_max Desplazamiento máximo de la prealineación en ventanas; 0 para no alinear.
+ */
+void biblioteca_iniciar(struct Biblioteca_plantillas *bib, int banda, int lag_max);
+
+/**
+ * @brief Registra un patrón: calcula sus características y su envolvente una sola vez.
+ *
+ * @param bib Biblioteca destino.
+ * @param etiqueta Nombre del patrón.
+ * @param umbral Distancia DTW máxima para aceptar el patrón.
+ * @param senal Señal de referencia de SAMPLES muestras.
+ * @param frecuencia_muestreo Frecuencia de muestreo de la señal.
+ * @param accion Acción a ejecutar cuando se reconozca.
+ * @return Índice de la plantilla, o -1 si la biblioteca está llena.
+ */
+int biblioteca_agregar(struct Biblioteca_plantillas *bib, const char *etiqueta, float umbral,
+                       const float *senal, float frecuencia_muestreo, accion_plantilla_t accion);
+
+/**
+ * @brief Registra un patrón a partir de características ya calculadas (p. ej. con el mismo extractor que las capturas).
+ *
+ * @param bib Biblioteca destino.
+ * @param etiqueta Nombre del patrón.
+ * @param umbral Distancia DTW máxima para aceptar el patrón.
+ * @param caract Características de la señal de referencia (se copian).
+ * @param accion Acción a ejecutar cuando se reconozca.
+ * @return Índice de la plantilla, o -1 si la biblioteca está llena.
+ */
+int biblioteca_agregar_caracteristicas(struct Biblioteca_plantillas *bib, const char *etiqueta, float umbral,
+                                       const struct Caracteristicas *caract, accion_plantilla_t accion);
+
+/**
+ * @brief Clasifica una captura por vecino más cercano con poda LB_Kim / LB_Keogh.
+ *
+ * Las plantillas que sobreviven a las cotas se comparan juntas con dtw_banda_conjunto(), en un solo
+ * recorrido de la captura y en aritmética entera; la distancia informada se deriva del costo ganador.
+ *
+ * Si la biblioteca tiene lag_max > 0, la captura se desplaza primero según la correlación cruzada con
+ * cada plantilla y todas las etapas trabajan sobre la captura alineada. Una captura más corta que la
+ * plantilla (terminada al detectar silencio) se compara con DTW de final abierto.
+ *
+ * @param bib Biblioteca de plantillas.
+ * @param consulta Características de la captura.
+ * @param res Resultado de la clasificación.
+ */
+void clasificar(const struct Biblioteca_plantillas *bib, const struct Caracteristicas *consulta,
+                struct Resultado_clasificacion *res);
+
+/**
+ * @brief Inicializa el detector continuo sobre una biblioteca ya cargada.
+ *
+ * @param det Detector a inicializar.
+ * @param bib Biblioteca de plantillas (debe seguir vigente mientras se use el detector).
+ */
+void detector_continuo_iniciar(struct Detector_continuo *det, const struct Biblioteca_plantillas *bib);
+
+/**
+ * @brief Entrega una muestra al detector continuo.
+ *
+ * El trabajo por muestra es una copia; al completar una ventana se hace una FFT real y una columna
+ * SPRING por plantilla (O(NUM_VENTANAS) cada una), acotado e independiente del tiempo transcurrido.
+ *
+ * @param det Detector en curso.
+ * @param muestra Muestra normalizada.
+ * @param deteccion Patrón encontrado (solo válido si la función devuelve 1).
+ * @return 1 si en esta muestra se confirmó un patrón, 0 en caso contrario.
+ */
+int detector_continuo_agregar(struct Detector_continuo *det, float muestra, struct Deteccion_continua *deteccion);
+
+#endif // RECONOCEDOR_H
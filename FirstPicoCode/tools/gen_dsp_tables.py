@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""
+Generador de tablas DSP para el reconocedor de aplausos.
+
+Se ejecuta en tiempo de compilación (ver CMakeLists.txt) y produce dsp_tables.h y dsp_tables.c
+con tablas constantes que el enlazador ubica en la flash del RP2040. Así el firmware no evalúa
+funciones trigonométricas en tiempo de ejecución.
+"""
+
+import argparse
+import math
+import os
+
+
+def q15(valor):
+    """Convierte un valor en [-1, 1] a Q15 con saturación."""
+    return max(-32768, min(32767, int(round(valor * 32768.0))))
+
+
+def bit_invertido(i, bits):
+    """Devuelve i con sus 'bits' bits menos significativos en orden invertido."""
+    r = 0
+    for _ in range(bits):
+        r = (r << 1) | (i & 1)
+        i >>= 1
+    return r
+
+
+def disenar_fir_decimacion(factor, taps):
+    """Filtro antialias de fase lineal (sinc con ventana de Hamming) para decimar por 'factor'.
+
+    Devuelve los coeficientes en Q15 con ganancia DC exactamente 1 (suma 32768).
+    """
+    if factor == 1:
+        return [32767]
+    corte = 0.45 / factor  # Frecuencia de corte normalizada a fs, con margen antes de fs/(2*factor)
+    centro = (taps - 1) / 2.0
+    h = []
+    for n in range(taps):
+        x = n - centro
+        sinc = 2.0 * corte if x == 0 else math.sin(2.0 * math.pi * corte * x) / (math.pi * x)
+        ventana = 0.54 - 0.46 * math.cos(2.0 * math.pi * n / (taps - 1))
+        h.append(sinc * ventana)
+    suma = sum(h)
+    q = [int(round(v / suma * 32768.0)) for v in h]
+    q[taps // 2] += 32768 - sum(q)  # Corregir el redondeo en el coeficiente central
+    return q
+
+
+def bins_goertzel(n, bandas):
+    """Bins de la banda de los aplausos para una ventana de n puntos: entre n/16 y 7n/16 (fs/16 a 7fs/16).
+
+    Fuera de ese rango sin(w) < 0.383 y el estado del filtro de Goertzel podría desbordar 32 bits.
+    """
+    bajo = max(1, -(-n // 16))
+    alto = (7 * n) // 16
+    if bandas <= 1 or alto == bajo:
+        return [bajo]
+    return sorted(set(int(round(bajo + i * (alto - bajo) / (bandas - 1))) for i in range(bandas)))
+
+
+def formatear(valores, fmt, por_linea=8):
+    """Formatea una lista de valores como el cuerpo de un inicializador de C."""
+    lineas = []
+    for i in range(0, len(valores), por_linea):
+        lineas.append("    " + ", ".join(fmt(v) for v in valores[i:i + por_linea]) + ",")
+    return "\n".join(lineas)
+
+
+def flotante(v):
+    return "%.9ef" % v
+
+
+def entero(v):
+    return "%d" % v
+
+
+def generar(args):
+    n_max = args.fft_max_size
+    if n_max < 2 or n_max & (n_max - 1):
+        raise SystemExit("--fft-max-size debe ser potencia de 2")
+    bits = n_max.bit_length() - 1
+
+    cos_tab = [math.cos(-2.0 * math.pi * k / n_max) for k in range(n_max // 2)]
+    sin_tab = [math.sin(-2.0 * math.pi * k / n_max) for k in range(n_max // 2)]
+    bitrev = [bit_invertido(i, bits) for i in range(n_max)]
+
+    factor = args.decimacion
+    taps = 1 if factor == 1 else args.fir_taps
+    if factor < 1 or taps % factor:
+        raise SystemExit("--fir-taps debe ser múltiplo de --decimacion")
+    fir = disenar_fir_decimacion(factor, taps)
+    # Reordenar por fases: fase p, coeficiente j -> h[j * factor + p]
+    polifase = [fir[j * factor + p] for p in range(factor) for j in range(taps // factor)]
+
+    ventana = args.ventana // factor
+    bins = bins_goertzel(ventana, args.goertzel_bandas)
+    # Coeficiente 2*cos(2*pi*k/N) en Q14 (|coef| <= 1.85 en el rango de bins_goertzel)
+    coef = [int(round(2.0 * math.cos(2.0 * math.pi * k / ventana) * 16384.0)) for k in bins]
+    # Demodulador de la DFT deslizante: exp(+2*pi*i*m/N) en Q13 (productos exactos y suma de N en 32 bits)
+    giro_real = [int(round(math.cos(2.0 * math.pi * m / ventana) * 8192.0)) for m in range(ventana)]
+    giro_imag = [int(round(math.sin(2.0 * math.pi * m / ventana) * 8192.0)) for m in range(ventana)]
+
+    # log2(1 + k/M) y 2^(k/M) con un punto extra para interpolar el último intervalo
+    if not 1 <= args.aprox_bits <= 16:
+        raise SystemExit("--aprox-bits debe estar entre 1 y 16")
+    m_aprox = 1 << args.aprox_bits
+    log2_tab = [math.log2(1.0 + k / m_aprox) for k in range(m_aprox + 1)]
+    exp2_tab = [2.0 ** (k / m_aprox) for k in range(m_aprox + 1)]
+
+    h = []
+    h.append("/* Archivo generado por tools/gen_dsp_tables.py. No editar. */")
+    h.append("#ifndef DSP_TABLES_H")
+    h.append("#define DSP_TABLES_H")
+    h.append("")
+    h.append("#include <stdint.h>")
+    h.append("")
+    h.append("/** Tamaño máximo de FFT cubierto por las tablas. */")
+    h.append("#define FFT_TABLAS_MAX_SIZE %d" % n_max)
+    h.append("/** log2(FFT_TABLAS_MAX_SIZE). */")
+    h.append("#define FFT_TABLAS_LOG2_MAX %d" % bits)
+    h.append("")
+    h.append("/** Factores de giro W^k = exp(-2*pi*i*k/FFT_TABLAS_MAX_SIZE), k < FFT_TABLAS_MAX_SIZE/2. */")
+    h.append("extern const float fft_twiddle_real[FFT_TABLAS_MAX_SIZE / 2];")
+    h.append("extern const float fft_twiddle_imag[FFT_TABLAS_MAX_SIZE / 2];")
+    h.append("/** Los mismos factores de giro en Q15. */")
+    h.append("extern const int16_t fft_twiddle_q15_real[FFT_TABLAS_MAX_SIZE / 2];")
+    h.append("extern const int16_t fft_twiddle_q15_imag[FFT_TABLAS_MAX_SIZE / 2];")
+    h.append("/** Permutación de bits invertidos para FFT_TABLAS_MAX_SIZE puntos. Para N puntos se usa")
+    h.append("    fft_bitrev[i] >> (FFT_TABLAS_LOG2_MAX - log2(N)). */")
+    h.append("extern const uint16_t fft_bitrev[FFT_TABLAS_MAX_SIZE];")
+    h.append("")
+    h.append("/** Factor de decimación entre el ADC y la extracción de características. */")
+    h.append("#define DECIMACION_FACTOR %d" % factor)
+    h.append("/** Coeficientes del filtro antialias. */")
+    h.append("#define FIR_DECIMACION_TAPS %d" % taps)
+    h.append("/** Coeficientes por fase del filtro polifásico. */")
+    h.append("#define FIR_DECIMACION_TAPS_FASE %d" % (taps // factor))
+    h.append("/** Filtro antialias en Q15 ordenado por fases: fir_decimacion_q15[p][j] = h[j * DECIMACION_FACTOR + p]. */")
+    h.append("extern const int16_t fir_decimacion_q15[DECIMACION_FACTOR][FIR_DECIMACION_TAPS_FASE];")
+    h.append("")
+    h.append("/** Filtros de Goertzel en la banda de los aplausos, para ventanas de %d puntos. */" % ventana)
+    h.append("#define GOERTZEL_NUM_BANDAS %d" % len(bins))
+    h.append("/** Bin de cada filtro de Goertzel. */")
+    h.append("extern const uint8_t goertzel_bins[GOERTZEL_NUM_BANDAS];")
+    h.append("/** Coeficiente 2*cos(2*pi*k/N) de cada filtro en Q14. */")
+    h.append("extern const int16_t goertzel_coef_q14[GOERTZEL_NUM_BANDAS];")
+    h.append("")
+    h.append("/** Puntos de la DFT deslizante (una ventana STFT). */")
+    h.append("#define SDFT_TAMANO %d" % ventana)
+    h.append("/** exp(+2*pi*i*m/SDFT_TAMANO) en Q13, para demodular la muestra m. */")
+    h.append("extern const int16_t sdft_giro_q13_real[SDFT_TAMANO];")
+    h.append("extern const int16_t sdft_giro_q13_imag[SDFT_TAMANO];")
+    h.append("")
+    h.append("/** Bits de la mantisa que indexan las tablas de log2 y exp2 aproximados. */")
+    h.append("#define APROX_TABLA_BITS %d" % args.aprox_bits)
+    h.append("/** Intervalos de las tablas de log2 y exp2 aproximados. */")
+    h.append("#define APROX_TABLA_TAMANO %d" % m_aprox)
+    h.append("/** log2(1 + k/APROX_TABLA_TAMANO), k <= APROX_TABLA_TAMANO. */")
+    h.append("extern const float aprox_log2_tabla[APROX_TABLA_TAMANO + 1];")
+    h.append("/** 2^(k/APROX_TABLA_TAMANO), k <= APROX_TABLA_TAMANO. */")
+    h.append("extern const float aprox_exp2_tabla[APROX_TABLA_TAMANO + 1];")
+    h.append("")
+    h.append("#endif // DSP_TABLES_H")
+
+    c = []
+    c.append("/* Archivo generado por tools/gen_dsp_tables.py. No editar. */")
+    c.append('#include "dsp_tables.h"')
+    c.append("")
+    c.append("const float fft_twiddle_real[FFT_TABLAS_MAX_SIZE / 2] = {")
+    c.append(formatear(cos_tab, flotante, 4))
+    c.append("};")
+    c.append("")
+    c.append("const float fft_twiddle_imag[FFT_TABLAS_MAX_SIZE / 2] = {")
+    c.append(formatear(sin_tab, flotante, 4))
+    c.append("};")
+    c.append("")
+    c.append("const int16_t fft_twiddle_q15_real[FFT_TABLAS_MAX_SIZE / 2] = {")
+    c.append(formatear([q15(v) for v in cos_tab], entero, 12))
+    c.append("};")
+    c.append("")
+    c.append("const int16_t fft_twiddle_q15_imag[FFT_TABLAS_MAX_SIZE / 2] = {")
+    c.append(formatear([q15(v) for v in sin_tab], entero, 12))
+    c.append("};")
+    c.append("")
+    c.append("const uint16_t fft_bitrev[FFT_TABLAS_MAX_SIZE] = {")
+    c.append(formatear(bitrev, entero, 16))
+    c.append("};")
+
+    c.append("")
+    c.append("const int16_t fir_decimacion_q15[DECIMACION_FACTOR][FIR_DECIMACION_TAPS_FASE] = {")
+    for p in range(factor):
+        fase = polifase[p * (taps // factor):(p + 1) * (taps // factor)]
+        c.append("    {")
+        c.append("    " + formatear(fase, entero, 12).replace("\n", "\n    "))
+        c.append("    },")
+    c.append("};")
+
+    c.append("")
+    c.append("const uint8_t goertzel_bins[GOERTZEL_NUM_BANDAS] = {")
+    c.append(formatear(bins, entero, 16))
+    c.append("};")
+    c.append("")
+    c.append("const int16_t goertzel_coef_q14[GOERTZEL_NUM_BANDAS] = {")
+    c.append(formatear(coef, entero, 16))
+    c.append("};")
+
+    c.append("")
+    c.append("const int16_t sdft_giro_q13_real[SDFT_TAMANO] = {")
+    c.append(formatear(giro_real, entero, 16))
+    c.append("};")
+    c.append("")
+    c.append("const int16_t sdft_giro_q13_imag[SDFT_TAMANO] = {")
+    c.append(formatear(giro_imag, entero, 16))
+    c.append("};")
+
+    c.append("")
+    c.append("const float aprox_log2_tabla[APROX_TABLA_TAMANO + 1] = {")
+    c.append(formatear(log2_tab, flotante, 4))
+    c.append("};")
+    c.append("")
+    c.append("const float aprox_exp2_tabla[APROX_TABLA_TAMANO + 1] = {")
+    c.append(formatear(exp2_tab, flotante, 4))
+    c.append("};")
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    with open(os.path.join(args.out_dir, "dsp_tables.h"), "w") as f:
+        f.write("\n".join(h) + "\n")
+    with open(os.path.join(args.out_dir, "dsp_tables.c"), "w") as f:
+        f.write("\n".join(c) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Genera las tablas DSP constantes del firmware.")
+    parser.add_argument("--out-dir", required=True, help="Directorio de salida de dsp_tables.h/.c")
+    parser.add_argument("--fft-max-size", type=int, default=1024, help="Tamaño máximo de FFT")
+    parser.add_argument("--decimacion", type=int, default=1, help="Factor de decimación (1: sin decimar)")
+    parser.add_argument("--fir-taps", type=int, default=32, help="Coeficientes del filtro antialias")
+    parser.add_argument("--ventana", type=int, default=64, help="Muestras por ventana STFT a la tasa del ADC")
+    parser.add_argument("--goertzel-bandas", type=int, default=4, help="Filtros de Goertzel por ventana")
+    parser.add_argument("--aprox-bits", type=int, default=6, help="Bits de índice de las tablas de log2/exp2")
+    generar(parser.parse_args())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+#include <stdio.h>            /**< printf */
+#include <math.h>             /**< fabsf */
+#include "measure_libs.h"     /**< dtw_banda, dtw_banda_conjunto, lb_kim y lb_keogh */
+
+/**
+ * @def COTA_ERROR_RELATIVO
+ * @brief Diferencia relativa admitida entre el DTW entero y el flotante sobre las mismas características cuantizadas.
+ *
+ * Las entradas son idénticas; solo difiere el redondeo de las sumas en flotante (24 bits de mantisa).
+ */
+#define COTA_ERROR_RELATIVO 1e-4f
+
+/**
+ * @def DISTANCIA_SATURACION
+ * @brief Distancia desde la que el costo entero satura en DTW_INF_ENTERO: sqrt(2^32) / 2^DTW_Q.
+ *
+ * Muy por encima de los umbrales de las plantillas, así saturar equivale a "no se parece".
+ */
+#define DISTANCIA_SATURACION ((float)(1 << (16 - DTW_Q)))
+
+#define NUM_CASOS 20000    /**< Casos aleatorios de dtw_banda_conjunto(). */
+#define NUM_PARES 20000    /**< Pares aleatorios de la prueba de las cotas inferiores. */
+#define LAG_MAX 10         /**< Desplazamiento máximo de la consulta por candidato. */
+
+static uint32_t semilla = 12345;
+
+// Entero pseudoaleatorio uniforme en [0, n)
+static int aleatorio_entero(int n)
+{
+    semilla = semilla * 1664525u + 1013904223u;
+    return (int)((semilla >> 8) % (uint32_t)n);
+}
+
+// Número pseudoaleatorio uniforme en [0, maximo)
+static float aleatorio(float maximo)
+{
+    return maximo * (float)aleatorio_entero(1 << 20) / (float)(1 << 20);
+}
+
+static int iguales(float a, float b)
+{
+    return fabsf(a - b) <= COTA_ERROR_RELATIVO * fmaxf(fabsf(a), fabsf(b));
+}
+
+// Secuencia parecida a una envolvente: la base más ruido centrado o, sin base, ruido uniforme en [0, ruido)
+static void generar_secuencia(const float *base, int n, float ruido, float *s)
+{
+    for (int i = 0; i < n; i++)
+    {
+        s[i] = fmaxf(0.0f, ((base != NULL) ? base[i] : 0.0f) + aleatorio(ruido) - ((base != NULL) ? ruido / 2 : 0.0f));
+    }
+}
+
+// DTW flotante de un candidato sobre la consulta alineada, con los mismos valores cuantizados que usa el
+// entero; devuelve la distancia de dtw_banda() o dtw_banda_final_abierto()
+static float dtw_flotante(const uint16_t *consulta, int n, uint16_t relleno, const struct Dtw_candidato *p, int banda)
+{
+    float alineada[MAX_SIZE], plantilla[MAX_SIZE];
+    const float escala = 1.0f / (float)(1 << DTW_Q);
+
+    for (int i = 0; i < p->largo; i++)
+    {
+        int q = i + p->desplazamiento;
+        alineada[i] = (((q >= 0) && (q < n)) ? consulta[q] : relleno) * escala;
+    }
+    for (int j = 0; j < p->m; j++)
+    {
+        plantilla[j] = p->plantilla[j] * escala;
+    }
+    return p->final_abierto ? dtw_banda_final_abierto(plantilla, p->m, p->fin_min, alineada, p->largo, banda, 0.0f, NULL)
+                            : dtw_banda(alineada, p->largo, plantilla, p->m, banda, 0.0f, NULL);
+}
+
+// dtw_banda_conjunto() frente a una llamada por plantilla y al DTW flotante; devuelve los casos que fallan
+static int probar_conjunto(void)
+{
+    static struct Dtw_conjunto cj;
+    static uint16_t plantillas[DTW_CONJUNTO_MAX][MAX_SIZE];
+    float consulta_f[NUM_VENTANAS], plantilla_f[MAX_SIZE];
+    uint16_t consulta[NUM_VENTANAS];
+    struct Dtw_candidato cand[DTW_CONJUNTO_MAX];
+    uint32_t costos[DTW_CONJUNTO_MAX];
+    int fallas = 0;
+
+    for (int caso = 0; caso < NUM_CASOS; caso++)
+    {
+        int n = 1 + aleatorio_entero(NUM_VENTANAS);
+        int k = 1 + aleatorio_entero(DTW_CONJUNTO_MAX);
+        int banda = 1 + aleatorio_entero(16);
+        generar_secuencia(NULL, n, 2.0f, consulta_f);
+        dtw_cuantizar_secuencia(consulta_f, n, consulta);
+        uint16_t relleno = (consulta[0] < consulta[n - 1]) ? consulta[0] : consulta[n - 1];
+
+        // Candidatos de extremo fijo o de final abierto, parecidos a la consulta o no, con su propio desplazamiento
+        int error = 0;
+        for (int c = 0; c < k; c++)
+        {
+            struct Dtw_candidato *p = &cand[c];
+            p->m = 2 + aleatorio_entero(MAX_SIZE - 2);
+            p->desplazamiento = aleatorio_entero(2 * LAG_MAX + 1) - LAG_MAX;
+            p->final_abierto = aleatorio_entero(2);
+            p->largo = p->final_abierto ? 1 + aleatorio_entero(p->m) : 1 + aleatorio_entero(NUM_VENTANAS);
+            p->fin_min = 1 + aleatorio_entero(p->m);
+            p->limite = DTW_INF_ENTERO;
+            p->plantilla = plantillas[c];
+
+            float base[MAX_SIZE];
+            for (int j = 0; j < p->m; j++)
+            {
+                int q = j + p->desplazamiento;
+                base[j] = ((q >= 0) && (q < n)) ? consulta_f[q] : 0.0f;
+            }
+            generar_secuencia(aleatorio_entero(2) ? base : NULL, p->m, aleatorio(2.0f), plantilla_f);
+            dtw_cuantizar_secuencia(plantilla_f, p->m, plantillas[c]);
+
+            // Referencia por plantilla: el mismo núcleo con un solo candidato y sin límite, y el DTW flotante
+            dtw_banda_conjunto(&cj, consulta, n, relleno, p, 1, banda, &costos[c], NULL);
+            float flotante = dtw_flotante(consulta, n, relleno, p, banda);
+            int saturado = (costos[c] == DTW_INF_ENTERO);
+            if (saturado ? (flotante < DISTANCIA_SATURACION * (1.0f - COTA_ERROR_RELATIVO))
+                         : !iguales(dtw_distancia_entero(costos[c]), flotante))
+            {
+                printf("caso %d candidato %d: entero %g, flotante %g\n", caso, c, dtw_distancia_entero(costos[c]),
+                       flotante);
+                error = 1;
+            }
+
+            // Límites que dejan afuera a unos candidatos y adentro a otros
+            p->limite = (saturado || !aleatorio_entero(4)) ? DTW_INF_ENTERO
+                                                           : (uint32_t)(costos[c] * (0.5 + aleatorio(1.0f)));
+        }
+
+        // El recorrido conjunto elige la menor distancia bajo su límite entre las de cada plantilla
+        int esperado = -1;
+        uint32_t esperado_costo = DTW_INF_ENTERO;
+        for (int c = 0; c < k; c++)
+        {
+            if ((costos[c] < cand[c].limite) && (costos[c] < esperado_costo))
+            {
+                esperado = c;
+                esperado_costo = costos[c];
+            }
+        }
+        uint32_t costo;
+        int elegido = dtw_banda_conjunto(&cj, consulta, n, relleno, cand, k, banda, &costo, NULL);
+
+        if (error || (elegido != esperado) || (costo != esperado_costo))
+        {
+            printf("caso %d (%d plantillas, banda %d): elegido %d con costo %lu, esperado %d con costo %lu\n", caso, k,
+                   banda, elegido, (unsigned long)costo, esperado, (unsigned long)esperado_costo);
+            fallas++;
+        }
+    }
+    return fallas;
+}
+
+// LB_Kim y LB_Keogh nunca superan el costo acumulado del DTW que podan, con extremo fijo y con final abierto
+// como los aplica clasificar(); devuelve los pares que fallan
+static int probar_cotas(void)
+{
+    float plantilla[MAX_SIZE], consulta[MAX_SIZE], sup[MAX_SIZE], inf[MAX_SIZE];
+    int fallas = 0;
+
+    for (int par = 0; par < NUM_PARES; par++)
+    {
+        int m = 2 + aleatorio_entero(MAX_SIZE - 2);
+        int banda = 1 + aleatorio_entero(16);
+        generar_secuencia(NULL, m, 8.0f, plantilla);
+        generar_secuencia(aleatorio_entero(2) ? plantilla : NULL, m, aleatorio(8.0f), consulta);
+        dtw_envolvente(plantilla, m, banda, sup, inf);
+
+        // Extremo fijo con el mismo largo: ambas cotas
+        float d = dtw_banda(consulta, m, plantilla, m, banda, 0.0f, NULL);
+        float costo = d * d * (1.0f + COTA_ERROR_RELATIVO);
+        int error = (lb_kim(plantilla, m, consulta, m) > costo) || (lb_keogh(consulta, m, sup, inf, INF) > costo);
+
+        // Extremo fijo con otro largo: solo LB_Kim
+        int n = 1 + aleatorio_entero(MAX_SIZE - 1);
+        d = dtw_banda(consulta, n, plantilla, m, banda, 0.0f, NULL);
+        error |= lb_kim(plantilla, m, consulta, n) > d * d * (1.0f + COTA_ERROR_RELATIVO);
+
+        // Final abierto: LB_Kim del primer elemento y LB_Keogh sobre el prefijo de la consulta
+        int largo = 1 + aleatorio_entero(m);
+        int fin_min = 1 + aleatorio_entero(m);
+        d = dtw_banda_final_abierto(plantilla, m, fin_min, consulta, largo, banda, 0.0f, NULL);
+        costo = d * d * (1.0f + COTA_ERROR_RELATIVO);
+        error |= (lb_kim(plantilla, 1, consulta, 1) > costo) || (lb_keogh(consulta, largo, sup, inf, INF) > costo);
+
+        if (error)
+        {
+            printf("par %d (m=%d, n=%d, largo=%d, banda %d): una cota supera al DTW\n", par, m, n, largo, banda);
+            fallas++;
+        }
+    }
+    return fallas;
+}
+
+// Recorrido conjunto de clasificar() frente al DTW por plantilla, y validez de la poda por cotas inferiores
+int main(void)
+{
+    int conjunto = probar_conjunto();
+    int cotas = probar_cotas();
+
+    printf("dtw_banda_conjunto: %d de %d casos distintos del DTW por plantilla\n", conjunto, NUM_CASOS);
+    printf("LB_Kim y LB_Keogh: %d de %d pares con una cota sobre el DTW\n", cotas, NUM_PARES);
+
+    if (conjunto + cotas > 0)
+    {
+        printf("Clasificador FUERA de la referencia\n");
+        return 1;
+    }
+    return 0;
+}
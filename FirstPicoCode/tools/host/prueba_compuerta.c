@@ -0,0 +1,181 @@
+#include <stdio.h>            /**< printf */
+#include <math.h>             /**< fabsf, lrintf */
+#include "measure_libs.h"     /**< Extractor STFT con compuerta de energía */
+#include "reconocedor.h"      /**< Biblioteca de plantillas y clasificar() */
+#include "base_de_datos.h"    /**< Señales de tres y dos aplausos */
+
+/**
+ * @def COTA_ERROR_PISO
+ * @brief Error máximo de la característica estimada en una ventana bajo la compuerta, relativo al pico de la captura.
+ *
+ * La estimación es relacion_piso por la suma de |x|: en el ruido la característica es casi proporcional
+ * a esa suma, así el error queda en el orden de la propia característica del silencio.
+ */
+#define COTA_ERROR_PISO 0.02f
+
+/**
+ * @def MIN_FFT_OMITIDAS
+ * @brief Ventanas de cada captura que la compuerta debe resolver sin FFT (de NUM_VENTANAS).
+ */
+#define MIN_FFT_OMITIDAS (NUM_VENTANAS / 5)
+
+#define AMPLITUD_ADC 2047          /**< Pico de las plantillas en códigos del ADC centrados. */
+#define SIGMA_RUIDO 10             /**< Desvío del ruido agregado a las capturas, en códigos del ADC. */
+#define FACTOR_COMPUERTA 4         /**< Compuerta en múltiplos de la suma de |x| del ruido (COMPUERTA_FACTOR_RUIDO). */
+#define NUM_REPETICIONES 4         /**< Capturas con ruido distinto por plantilla y posición en el anillo. */
+#define TAMANO_ANILLO (SAMPLES + 3 * TAMANO_VENTANA) /**< Anillo de la captura, mayor que ella para que dé la vuelta. */
+
+static uint32_t semilla = 12345;
+
+// Ruido aproximadamente gaussiano de desvío SIGMA_RUIDO (suma de doce uniformes)
+static int16_t ruido(void)
+{
+    int32_t suma = 0;
+    for (int k = 0; k < 12; k++)
+    {
+        semilla = semilla * 1664525u + 1013904223u;
+        suma += (int32_t)(semilla >> 16) - 32768;
+    }
+    return (int16_t)((suma * SIGMA_RUIDO) >> 15);
+}
+
+// Captura de una plantilla, con ruido o sin él, escrita en el anillo desde inicio (da la vuelta si no cabe)
+static void generar_captura(int id, int con_ruido, int16_t anillo[], int inicio)
+{
+    const struct Plantilla_almacenada *p = almacen_plantilla(id);
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        float x = (i < p->num_muestras) ? plantilla_muestra(p, i) : 0.0f;
+        int32_t codigo = lrintf(x * AMPLITUD_ADC) + (con_ruido ? ruido() : 0);
+        anillo[(inicio + i) % TAMANO_ANILLO] = (int16_t)codigo;
+    }
+}
+
+// Características de la captura del anillo con la compuerta dada; devuelve las FFT omitidas
+static int extraer(const int16_t anillo[], int inicio, int32_t compuerta, float relacion_piso,
+                   struct Caracteristicas *c)
+{
+    struct Extractor_STFT ext;
+    extractor_stft_iniciar(&ext, c, 1.0f);
+    extractor_stft_fijar_compuerta(&ext, compuerta, relacion_piso);
+    extractor_stft_procesar_anillo(&ext, anillo, TAMANO_ANILLO, inicio, SAMPLES, NUM_VENTANAS,
+                                   1.0f / AMPLITUD_ADC);
+    return ext.fft_omitidas;
+}
+
+// Suma de |x| de la ventana v de la captura, leída del anillo muestra a muestra
+static int32_t suma_ventana(const int16_t anillo[], int inicio, int v)
+{
+    int32_t suma = 0;
+    for (int n = 0; n < TAMANO_VENTANA; n++)
+    {
+        int16_t x = anillo[(inicio + v * SALTO_VENTANA + n) % TAMANO_ANILLO];
+        suma += (x < 0) ? -x : x;
+    }
+    return suma;
+}
+
+// Extractor con y sin la compuerta sobre capturas ruidosas de las dos plantillas: conteo de FFT omitidas,
+// ventanas transformadas idénticas, estimación de los silencios y clasificación
+int main(void)
+{
+    static int16_t anillo[TAMANO_ANILLO];
+    static struct Biblioteca_plantillas bib;
+    static struct Caracteristicas plantillas[2], sin_compuerta, con_compuerta;
+    const int ids[2] = {PLANTILLA_TRES_APLAUSOS, PLANTILLA_DOS_APLAUSOS};
+    const float umbrales[2] = {4.0f, 3.3f}; // Los de measure.c
+    const int inicios[] = {0, TAMANO_ANILLO - SAMPLES / 2 - 7}; // Alineada y partida al dar la vuelta
+    int fallas = 0;
+
+    // Plantillas sin ruido ni compuerta, y la relación característica / suma de |x| en sus silencios
+    // (las ventanas bajo la energía media), como la mide measure.c al arrancar
+    float piso_caracteristica = 0.0f, piso_energia = 0.0f;
+    biblioteca_iniciar(&bib, DTW_BANDA_ALINEADA, DTW_BANDA);
+    for (int k = 0; k < 2; k++)
+    {
+        generar_captura(ids[k], 0, anillo, 0);
+        extraer(anillo, 0, 0, 0.0f, &plantillas[k]);
+        biblioteca_agregar_caracteristicas(&bib, almacen_plantilla(ids[k])->etiqueta, umbrales[k], &plantillas[k],
+                                           NULL);
+
+        int64_t energia_total = 0;
+        for (int v = 0; v < NUM_VENTANAS; v++)
+        {
+            energia_total += suma_ventana(anillo, 0, v);
+        }
+        for (int v = 0; v < NUM_VENTANAS; v++)
+        {
+            int32_t energia = suma_ventana(anillo, 0, v);
+            if (energia * (int64_t)NUM_VENTANAS <= energia_total)
+            {
+                piso_caracteristica += plantillas[k].amplitudes[v] * AMPLITUD_ADC;
+                piso_energia += (float)energia;
+            }
+        }
+    }
+    float relacion_piso = piso_caracteristica / piso_energia;
+
+    // Compuerta como la fija measure.c: FACTOR_COMPUERTA veces el |x| medio del ruido por ventana
+    int64_t suma_ruido = 0;
+    for (int n = 0; n < 1 << 16; n++)
+    {
+        int16_t x = ruido();
+        suma_ruido += (x < 0) ? -x : x;
+    }
+    int32_t compuerta = (int32_t)((suma_ruido * FACTOR_COMPUERTA * TAMANO_VENTANA) >> 16);
+    printf("Compuerta %ld (suma de |x| por ventana), relacion de piso %.3e\n", (long)compuerta, relacion_piso);
+
+    for (int k = 0; k < 2; k++)
+    {
+        for (int r = 0; r < NUM_REPETICIONES; r++)
+        {
+            for (int a = 0; a < 2; a++)
+            {
+                int inicio = inicios[a];
+                generar_captura(ids[k], 1, anillo, inicio);
+                int omitidas_sin = extraer(anillo, inicio, 0, relacion_piso, &sin_compuerta);
+                int omitidas = extraer(anillo, inicio, compuerta, relacion_piso, &con_compuerta);
+
+                // Las ventanas sobre la compuerta se transforman igual; las de abajo se cuentan y se estiman
+                int esperadas = 0, distintas = 0;
+                float pico = 0.0f, error = 0.0f;
+                for (int v = 0; v < NUM_VENTANAS; v++)
+                {
+                    pico = fmaxf(pico, sin_compuerta.amplitudes[v]);
+                }
+                for (int v = 0; v < NUM_VENTANAS; v++)
+                {
+                    if (suma_ventana(anillo, inicio, v) < compuerta)
+                    {
+                        esperadas++;
+                        error = fmaxf(error, fabsf(con_compuerta.amplitudes[v] - sin_compuerta.amplitudes[v]) / pico);
+                    }
+                    else
+                    {
+                        distintas += con_compuerta.amplitudes[v] != sin_compuerta.amplitudes[v];
+                    }
+                }
+
+                struct Resultado_clasificacion res_sin, res_con;
+                clasificar(&bib, &sin_compuerta, &res_sin);
+                clasificar(&bib, &con_compuerta, &res_con);
+
+                int correcta = (omitidas_sin == 0) && (omitidas == esperadas) && (omitidas >= MIN_FFT_OMITIDAS) &&
+                               (distintas == 0) && (error <= COTA_ERROR_PISO) && (res_sin.indice == k) &&
+                               (res_con.indice == k);
+                printf("%-13s ruido %d inicio %4d: %2d FFT omitidas (esperadas %2d), error de piso %.1e, "
+                       "distancia %.3f sin compuerta y %.3f con ella%s\n",
+                       bib.plantillas[k].etiqueta, r, inicio, omitidas, esperadas, error,
+                       res_sin.distancia, res_con.distancia, correcta ? "" : "  <- FALLA");
+                fallas += !correcta;
+            }
+        }
+    }
+
+    if (fallas > 0)
+    {
+        printf("%d capturas FUERA de lo esperado con la compuerta\n", fallas);
+        return 1;
+    }
+    return 0;
+}
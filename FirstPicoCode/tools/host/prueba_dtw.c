@@ -0,0 +1,365 @@
+#include <stdio.h>            /**< printf */
+#include <stdlib.h>           /**< abs */
+#include <math.h>             /**< fabsf, sqrtf */
+#include "measure_libs.h"     /**< dtw, dtw_banda, dtw_banda_final_abierto y SPRING */
+#include "reconocedor.h"      /**< Biblioteca de plantillas y clasificar() */
+#include "base_de_datos.h"    /**< Señales de tres y dos aplausos */
+
+/**
+ * @def COTA_ERROR_RELATIVO
+ * @brief Diferencia relativa admitida entre un DTW y su referencia por fuerza bruta.
+ *
+ * Ambos suman los mismos costos por la misma recurrencia; solo el orden de las sumas sobre caminos
+ * empatados puede cambiar el último bit.
+ */
+#define COTA_ERROR_RELATIVO 1e-5f
+
+#define NUM_CASOS 3000     /**< Pares aleatorios de cada prueba del DTW con banda y de final abierto. */
+#define NUM_FLUJOS 200     /**< Flujos aleatorios de la prueba de SPRING. */
+#define MAX_PLANTILLA 24   /**< Largo máximo de la plantilla de SPRING. */
+#define LARGO_FLUJO (3 * (28 + 2 * MAX_PLANTILLA)) /**< Elementos de cada flujo: caben tres copias estiradas al doble. */
+
+static uint32_t semilla = 12345;
+
+// Entero pseudoaleatorio uniforme en [0, n)
+static int aleatorio_entero(int n)
+{
+    semilla = semilla * 1664525u + 1013904223u;
+    return (int)((semilla >> 8) % (uint32_t)n);
+}
+
+// Número pseudoaleatorio uniforme en [0, maximo)
+static float aleatorio(float maximo)
+{
+    return maximo * (float)aleatorio_entero(1 << 20) / (float)(1 << 20);
+}
+
+static int iguales(float a, float b)
+{
+    return fabsf(a - b) <= COTA_ERROR_RELATIVO * fmaxf(fabsf(a), fabsf(b));
+}
+
+// Costo acumulado (sin raíz) por la matriz completa: celdas con |i - j| > banda fuera del camino; con
+// final_abierto la consulta s2 se recorre entera y el mejor final en s1 se busca desde la fila fin_min
+static float dtw_fuerza_bruta(const float *s1, int n, const float *s2, int m, int banda, int final_abierto,
+                              int fin_min)
+{
+    static float D[MAX_SIZE][MAX_SIZE];
+    float mejor = INF;
+
+    for (int i = 0; i <= n; i++)
+    {
+        for (int j = 0; j <= m; j++)
+        {
+            D[i][j] = INF;
+        }
+    }
+    D[0][0] = 0.0f;
+    for (int i = 1; i <= n; i++)
+    {
+        for (int j = 1; j <= m; j++)
+        {
+            if (abs(i - j) <= banda)
+            {
+                float diff = s1[i - 1] - s2[j - 1];
+                D[i][j] = diff * diff + fminf(fminf(D[i - 1][j], D[i][j - 1]), D[i - 1][j - 1]);
+            }
+        }
+        if (final_abierto && (i >= fin_min))
+        {
+            mejor = fminf(mejor, D[i][m]);
+        }
+    }
+    return final_abierto ? mejor : D[n][m];
+}
+
+// Un resultado con umbral debe ser el exacto si está bajo el umbral; por encima puede ser el exacto o INF
+static int abandono_correcto(float resultado, float exacto, float umbral)
+{
+    if (exacto <= umbral)
+    {
+        return iguales(resultado, exacto);
+    }
+    return (resultado == INF) || iguales(resultado, exacto);
+}
+
+// dtw_banda() con banda amplia frente a dtw(), y su abandono temprano; devuelve los casos que fallan
+static int probar_banda(void)
+{
+    float s1[MAX_SIZE], s2[MAX_SIZE];
+    int fallas = 0;
+
+    for (int c = 0; c < NUM_CASOS; c++)
+    {
+        int n = 1 + aleatorio_entero(MAX_SIZE - 1);
+        int m = 1 + aleatorio_entero(MAX_SIZE - 1);
+        for (int i = 0; i < n; i++)
+        {
+            s1[i] = aleatorio(8.0f);
+        }
+        for (int j = 0; j < m; j++)
+        {
+            s2[j] = aleatorio(8.0f);
+        }
+
+        float exacto = dtw(s1, n, s2, m);
+        float amplia = dtw_banda(s1, n, s2, m, MAX_SIZE, 0.0f, NULL);
+        int banda = 1 + aleatorio_entero(16);
+        float angosta = dtw_banda(s1, n, s2, m, banda, 0.0f, NULL);
+        float umbral = aleatorio(2.0f * angosta);
+        float con_umbral = dtw_banda(s1, n, s2, m, banda, umbral, NULL);
+
+        // La banda solo quita caminos: nunca mejora el DTW completo
+        if (!iguales(amplia, exacto) || (angosta < exacto * (1.0f - COTA_ERROR_RELATIVO)) ||
+            !abandono_correcto(con_umbral, angosta, umbral))
+        {
+            printf("dtw_banda n=%d m=%d banda=%d: %g (completo %g), banda %g, umbral %g -> %g\n", n, m, banda, amplia,
+                   exacto, angosta, umbral, con_umbral);
+            fallas++;
+        }
+    }
+    return fallas;
+}
+
+// dtw_banda_final_abierto() frente a la matriz completa con la misma banda; devuelve los casos que fallan
+static int probar_final_abierto(void)
+{
+    float s1[MAX_SIZE], s2[MAX_SIZE];
+    int fallas = 0;
+
+    for (int c = 0; c < NUM_CASOS; c++)
+    {
+        int n = 1 + aleatorio_entero(MAX_SIZE - 1);
+        int m = 1 + aleatorio_entero(n);
+        int fin_min = 1 + aleatorio_entero(n);
+        int banda = 1 + aleatorio_entero(16);
+        for (int i = 0; i < n; i++)
+        {
+            s1[i] = aleatorio(8.0f);
+        }
+        for (int j = 0; j < m; j++)
+        {
+            s2[j] = aleatorio(8.0f);
+        }
+
+        float exacto = sqrtf(dtw_fuerza_bruta(s1, n, s2, m, banda, 1, fin_min));
+        float resultado = dtw_banda_final_abierto(s1, n, fin_min, s2, m, banda, 0.0f, NULL);
+        float umbral = aleatorio(2.0f * fminf(exacto, 100.0f));
+        float con_umbral = dtw_banda_final_abierto(s1, n, fin_min, s2, m, banda, umbral, NULL);
+
+        if (!iguales(resultado, exacto) || !abandono_correcto(con_umbral, exacto, umbral))
+        {
+            printf("final abierto n=%d m=%d fin_min=%d banda=%d: %g (fuerza bruta %g), umbral %g -> %g\n", n, m,
+                   fin_min, banda, resultado, exacto, umbral, con_umbral);
+            fallas++;
+        }
+    }
+    return fallas;
+}
+
+// Flujo de ruido bajo con tres copias de la plantilla estiradas al azar (elementos repetidos) y con
+// ruido leve; guarda el inicio y el fin de cada copia
+static void generar_flujo(const float *plantilla, int m, float *flujo, int32_t copias[3][2])
+{
+    int t = 0;
+    for (int c = 0; c < 3; c++)
+    {
+        int silencio = 8 + aleatorio_entero(20);
+        for (int k = 0; k < silencio; k++)
+        {
+            flujo[t++] = aleatorio(0.5f);
+        }
+        copias[c][0] = t;
+        for (int i = 0; i < m; i++)
+        {
+            int repeticiones = (aleatorio_entero(4) == 0) ? 2 : 1;
+            for (int r = 0; r < repeticiones; r++)
+            {
+                flujo[t++] = plantilla[i] + aleatorio(0.2f) - 0.1f;
+            }
+        }
+        copias[c][1] = t - 1;
+    }
+    while (t < LARGO_FLUJO)
+    {
+        flujo[t++] = aleatorio(0.5f);
+    }
+}
+
+// SPRING frente al DTW de subsecuencia por fuerza bruta; devuelve los flujos que fallan
+static int probar_spring(void)
+{
+    static float costo[LARGO_FLUJO][LARGO_FLUJO]; // costo[s][t]: plantilla completa contra flujo[s..t]
+    static struct Spring_estado st;
+    float plantilla[MAX_PLANTILLA], flujo[LARGO_FLUJO], D[MAX_PLANTILLA + 1];
+    int32_t copias[3][2];
+    int fallas = 0;
+
+    for (int f = 0; f < NUM_FLUJOS; f++)
+    {
+        int m = 4 + aleatorio_entero(MAX_PLANTILLA - 3);
+        for (int i = 0; i < m; i++)
+        {
+            plantilla[i] = 1.0f + aleatorio(7.0f);
+        }
+        generar_flujo(plantilla, m, flujo, copias);
+
+        // DTW de la plantilla contra cada tramo, empezando exactamente en s
+        for (int s = 0; s < LARGO_FLUJO; s++)
+        {
+            D[0] = INF;
+            for (int i = 1; i <= m; i++)
+            {
+                D[i] = INF;
+            }
+            for (int t = s; t < LARGO_FLUJO; t++)
+            {
+                float diagonal = (t == s) ? 0.0f : INF; // Solo la columna s sale de la fila 0
+                for (int i = 1; i <= m; i++)
+                {
+                    float diff = flujo[t] - plantilla[i - 1];
+                    float izquierda = D[i];
+                    float abajo = (i == 1) ? ((t == s) ? 0.0f : INF) : D[i - 1];
+                    D[i] = diff * diff + fminf(fminf(abajo, izquierda), diagonal);
+                    diagonal = izquierda;
+                }
+                costo[s][t] = D[m];
+            }
+        }
+
+        // Sin límite no se confirma nada: la última fila de cada columna es el mínimo sobre los inicios
+        int error = 0;
+        spring_iniciar(&st, m);
+        for (int t = 0; t < LARGO_FLUJO; t++)
+        {
+            struct Coincidencia_subsecuencia c;
+            spring_actualizar(&st, plantilla, m, flujo[t], t, -1.0f, &c);
+            float minimo = INF;
+            for (int s = 0; s <= t; s++)
+            {
+                minimo = fminf(minimo, costo[s][t]);
+            }
+            int32_t inicio = st.inicio[st.fila][m];
+            error |= !iguales(st.d[st.fila][m], minimo) || (inicio > t) || !iguales(costo[inicio][t], minimo);
+        }
+
+        // Con límite: coincidencias disjuntas, en orden, bajo el límite y con el costo de su propio tramo
+        float limite = 0.25f * m;
+        int32_t fin_anterior = -1;
+        int reportadas = 0, copias_halladas = 0;
+        spring_iniciar(&st, m);
+        for (int t = 0; t < LARGO_FLUJO; t++)
+        {
+            struct Coincidencia_subsecuencia c;
+            if (!spring_actualizar(&st, plantilla, m, flujo[t], t, limite, &c))
+            {
+                continue;
+            }
+            float d2 = c.distancia * c.distancia;
+            error |= (c.t_ini <= fin_anterior) || (c.t_ini > c.t_fin) || (c.t_fin >= t) ||
+                     (d2 > limite * (1.0f + COTA_ERROR_RELATIVO)) ||
+                     (d2 < costo[c.t_ini][c.t_fin] * (1.0f - COTA_ERROR_RELATIVO));
+
+            // La primera es el óptimo exacto de todo tramo que la solape y haya terminado antes de confirmarla
+            if (reportadas == 0)
+            {
+                error |= !iguales(d2, costo[c.t_ini][c.t_fin]);
+                for (int t2 = 0; t2 <= t; t2++)
+                {
+                    for (int s = 0; (s <= t2) && (s <= c.t_fin); s++)
+                    {
+                        error |= costo[s][t2] < d2 * (1.0f - COTA_ERROR_RELATIVO);
+                    }
+                }
+            }
+            for (int k = 0; k < 3; k++)
+            {
+                copias_halladas += (c.t_ini <= copias[k][1]) && (c.t_fin >= copias[k][0]);
+            }
+            fin_anterior = c.t_fin;
+            reportadas++;
+        }
+        error |= copias_halladas < 3;
+
+        if (error)
+        {
+            printf("SPRING flujo %d (m=%d): %d coincidencias, %d de 3 copias\n", f, m, reportadas, copias_halladas);
+            fallas++;
+        }
+    }
+    return fallas;
+}
+
+// Características de una plantilla almacenada, extraídas de la señal de SAMPLES muestras como al registrarla
+static void caracteristicas_plantilla(int id, struct Caracteristicas *c)
+{
+    static float senal[SAMPLES];
+    const struct Plantilla_almacenada *p = almacen_plantilla(id);
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        senal[i] = (i < p->num_muestras) ? plantilla_muestra(p, i) : 0.0f;
+    }
+    extraer_caracteristicas(senal, 1.0f, c); // La frecuencia solo fija indices_tiempo, que el DTW no usa
+}
+
+// Capturas cortadas por silencio: las plantillas truncadas pasado su último pico se reconocen a sí mismas,
+// ningún prefijo se toma por la otra plantilla y los que terminan más de una banda antes del último pico
+// (el camino de final abierto ya no llega a fin_contenido) no se aceptan; devuelve los casos que fallan
+static int probar_truncadas(void)
+{
+    static struct Biblioteca_plantillas bib;
+    static struct Caracteristicas caract[2], consulta;
+    const int ids[2] = {PLANTILLA_TRES_APLAUSOS, PLANTILLA_DOS_APLAUSOS};
+    const float umbrales[2] = {4.0f, 3.3f}; // Los de measure.c
+    int fallas = 0;
+
+    biblioteca_iniciar(&bib, DTW_BANDA_ALINEADA, DTW_BANDA);
+    for (int k = 0; k < 2; k++)
+    {
+        caracteristicas_plantilla(ids[k], &caract[k]);
+        biblioteca_agregar_caracteristicas(&bib, almacen_plantilla(ids[k])->etiqueta, umbrales[k], &caract[k], NULL);
+    }
+
+    for (int k = 0; k < 2; k++)
+    {
+        int fin = bib.plantillas[k].fin_contenido;
+        int correctas = 0, cortas_aceptadas = 0, confundidas = 0;
+        for (int largo = 1; largo <= caract[k].num_ventanas; largo++)
+        {
+            struct Resultado_clasificacion res;
+            consulta = caract[k];
+            consulta.num_ventanas = largo;
+            clasificar(&bib, &consulta, &res);
+            correctas += (largo >= fin) && (res.indice == k);
+            cortas_aceptadas += (largo < fin - bib.banda) && (res.indice >= 0);
+            confundidas += (res.indice >= 0) && (res.indice != k);
+        }
+        printf("%s: fin de contenido %d ventanas, truncadas reconocidas %d de %d, prefijos cortos aceptados %d, "
+               "confundidas %d\n",
+               bib.plantillas[k].etiqueta, fin, correctas, caract[k].num_ventanas - fin + 1, cortas_aceptadas,
+               confundidas);
+        fallas += (correctas != caract[k].num_ventanas - fin + 1) + cortas_aceptadas + confundidas;
+    }
+    return fallas;
+}
+
+// DTW con banda y de final abierto frente a la fuerza bruta, SPRING frente al DTW de subsecuencia y
+// clasificación de capturas cortadas por silencio
+int main(void)
+{
+    int banda = probar_banda();
+    int final_abierto = probar_final_abierto();
+    int spring = probar_spring();
+    int truncadas = probar_truncadas();
+
+    printf("dtw_banda: %d de %d casos fuera de la referencia\n", banda, NUM_CASOS);
+    printf("dtw_banda_final_abierto: %d de %d casos fuera de la referencia\n", final_abierto, NUM_CASOS);
+    printf("SPRING: %d de %d flujos fuera de la referencia\n", spring, NUM_FLUJOS);
+
+    if (banda + final_abierto + spring + truncadas > 0)
+    {
+        printf("DTW FUERA de la referencia\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>            /**< printf */
+#include <math.h>             /**< fabsf, sqrtf */
+#include "measure_libs.h"     /**< dtw_banda, dtw_cuantizar y dtw_banda_conjunto */
+#include "base_de_datos.h"    /**< Señales de tres y dos aplausos */
+
+/**
+ * @def COSTO_TRES_DOS
+ * @brief Costo acumulado entero de "tres aplausos" contra "dos aplausos" con banda DTW_BANDA, como lo imprime
+ * benchmark_dtw().
+ *
+ * El núcleo es aritmética entera sin comportamiento dependiente de la implementación: el RP2040 debe
+ * imprimir este mismo valor. Cambia si cambian las plantillas, el extractor o las tablas generadas: el
+ * redondeo de las características flotantes decide la cuantización de las que caen cerca de un escalón.
+ */
+#define COSTO_TRES_DOS 0x12f0e13du
+
+/**
+ * @def COTA_REDONDEO_FLOTANTE
+ * @brief Margen relativo para el redondeo de las sumas del DTW flotante de referencia.
+ */
+#define COTA_REDONDEO_FLOTANTE 1e-5f
+
+#define NUM_PARES 5000 /**< Pares aleatorios comparados contra el DTW flotante sin cuantizar. */
+
+static uint32_t semilla = 12345;
+
+// Entero pseudoaleatorio uniforme en [0, n)
+static int aleatorio_entero(int n)
+{
+    semilla = semilla * 1664525u + 1013904223u;
+    return (int)((semilla >> 8) % (uint32_t)n);
+}
+
+// Número pseudoaleatorio uniforme en [0, maximo)
+static float aleatorio(float maximo)
+{
+    return maximo * (float)aleatorio_entero(1 << 20) / (float)(1 << 20);
+}
+
+// Características de una plantilla almacenada como las extrae benchmark_dtw()
+static void caracteristicas_plantilla(int id, struct Caracteristicas *c)
+{
+    static float senal[SAMPLES];
+    const struct Plantilla_almacenada *p = almacen_plantilla(id);
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        senal[i] = (i < p->num_muestras) ? plantilla_muestra(p, i) : 0.0f;
+    }
+    extraer_caracteristicas(senal, 1.0f, c); // La frecuencia solo fija indices_tiempo, que el DTW no usa
+}
+
+// Distancia del DTW entero de extremo fijo de s2 (consulta, filas) contra s1 (plantilla, columnas)
+static float dtw_entero(const float *s1, int n, const float *s2, int m, int banda, uint32_t *costo)
+{
+    static struct Dtw_conjunto cj;
+    static uint16_t s1_q[MAX_SIZE], s2_q[MAX_SIZE];
+    struct Dtw_candidato cand;
+
+    dtw_cuantizar_secuencia(s1, n, s1_q);
+    dtw_cuantizar_secuencia(s2, m, s2_q);
+    cand.plantilla = s1_q;
+    cand.m = n;
+    cand.desplazamiento = 0;
+    cand.largo = m;
+    cand.final_abierto = 0;
+    cand.fin_min = n;
+    cand.limite = DTW_INF_ENTERO;
+    dtw_banda_conjunto(&cj, s2_q, m, s2_q[0], &cand, 1, banda, costo, NULL);
+    return dtw_distancia_entero(*costo);
+}
+
+// Diferencia de la distancia entera y la flotante sin cuantizar frente a DTW_COTA_CUANTIZACION
+static int dentro_de_cota(float entero, float flotante, int n, int m, float *exceso)
+{
+    float cota = DTW_COTA_CUANTIZACION(n, m) + COTA_REDONDEO_FLOTANTE * flotante;
+    *exceso = fmaxf(*exceso, fabsf(entero - flotante) / cota);
+    return fabsf(entero - flotante) <= cota;
+}
+
+// DTW entero sobre las plantillas almacenadas (costo exacto) y frente al flotante sin cuantizar
+int main(void)
+{
+    static struct Caracteristicas tres, dos;
+    float s1[MAX_SIZE], s2[MAX_SIZE];
+    float exceso = 0.0f;
+    uint32_t costo;
+    int fallas = 0;
+
+    caracteristicas_plantilla(PLANTILLA_TRES_APLAUSOS, &tres);
+    caracteristicas_plantilla(PLANTILLA_DOS_APLAUSOS, &dos);
+    float entero = dtw_entero(tres.amplitudes, tres.num_ventanas, dos.amplitudes, dos.num_ventanas, DTW_BANDA, &costo);
+    float flotante = dtw_banda(dos.amplitudes, dos.num_ventanas, tres.amplitudes, tres.num_ventanas, DTW_BANDA, 0.0f,
+                               NULL);
+    int correcta = (costo == COSTO_TRES_DOS) &&
+                   dentro_de_cota(entero, flotante, tres.num_ventanas, dos.num_ventanas, &exceso);
+    printf("Tres contra dos, banda %d: costo 0x%08lx (esperado 0x%08lx), distancia %.5f, flotante %.5f, cota %.1e\n",
+           DTW_BANDA, (unsigned long)costo, (unsigned long)COSTO_TRES_DOS, entero, flotante,
+           DTW_COTA_CUANTIZACION(tres.num_ventanas, dos.num_ventanas));
+    fallas += !correcta;
+
+    // Pares aleatorios de envolventes en el rango de las características
+    int fuera = 0;
+    for (int par = 0; par < NUM_PARES; par++)
+    {
+        int n = 1 + aleatorio_entero(MAX_SIZE - 1);
+        int m = 1 + aleatorio_entero(MAX_SIZE - 1);
+        int banda = 1 + aleatorio_entero(16);
+        float nivel = aleatorio(4.0f);
+        for (int i = 0; i < n; i++)
+        {
+            s1[i] = aleatorio(nivel);
+        }
+        for (int j = 0; j < m; j++)
+        {
+            s2[j] = aleatorio(nivel);
+        }
+        entero = dtw_entero(s1, n, s2, m, banda, &costo);
+        flotante = dtw_banda(s2, m, s1, n, banda, 0.0f, NULL); // Misma orientación: la consulta en las filas
+        // Saturar solo es válido por encima de la distancia que llena 32 bits: sqrt(2^32) / 2^DTW_Q
+        int saturado_valido = flotante >= (float)(1 << (16 - DTW_Q)) - DTW_COTA_CUANTIZACION(n, m);
+        if ((costo == DTW_INF_ENTERO) ? !saturado_valido : !dentro_de_cota(entero, flotante, n, m, &exceso))
+        {
+            printf("par %d (n=%d, m=%d, banda %d): entero %.6f, flotante %.6f\n", par, n, m, banda, entero, flotante);
+            fuera++;
+        }
+    }
+    printf("Pares aleatorios: %d de %d fuera de la cota; mayor diferencia %.2f de la cota\n", fuera, NUM_PARES, exceso);
+    fallas += fuera;
+
+    if (fallas > 0)
+    {
+        printf("DTW entero FUERA de lo esperado\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>            /**< printf */
+#include <math.h>             /**< cosf, log10f */
+#include "measure_libs.h"     /**< fft_q15, rfft_enteros y fft_float */
+#include "base_de_datos.h"    /**< Señal de tres aplausos para el tramo de plantilla */
+
+/**
+ * @def COTA_SNR_DB
+ * @brief Relación señal/ruido mínima de la FFT Q15 de N puntos frente a fft_float() sobre el espectro completo.
+ *
+ * Cada etapa suma su ruido de redondeo y el escalado de bloque descarta un bit cada dos etapas: la SNR
+ * baja unos 3 dB por cada duplicación de N (de ~87 dB con 8 puntos a ~54 dB con 1024 en un tono).
+ */
+#define COTA_SNR_DB(N) (80.0f - 3.0f * log2f((float)(N)))
+
+/**
+ * @def COTA_ERROR_BIN
+ * @brief Error máximo de un bin de la FFT Q15, relativo al bin de mayor magnitud de la referencia.
+ */
+#define COTA_ERROR_BIN 1e-3f
+
+#define AMPLITUD_ADC 2047 /**< Pico de las señales de prueba: el de un código del ADC de 12 bits centrado. */
+
+enum
+{
+    SENAL_IMPULSO,
+    SENAL_TONO,
+    SENAL_PLANTILLA,
+    NUM_SENALES
+};
+
+static const char *nombres_senal[NUM_SENALES] = {"impulso", "tono", "plantilla"};
+
+// Señal de prueba de N muestras enteras con pico AMPLITUD_ADC
+static void generar_senal(int tipo, int N, int16_t x[])
+{
+    const struct Plantilla_almacenada *tres = almacen_plantilla(PLANTILLA_TRES_APLAUSOS);
+    int inicio = 0;
+
+    if (tipo == SENAL_PLANTILLA)
+    {
+        // Tramo centrado en el pico del primer aplauso, donde la señal tiene más contenido
+        int pico = 0;
+        for (int i = 1; i < tres->num_muestras; i++)
+        {
+            pico = (fabsf(plantilla_muestra(tres, i)) > fabsf(plantilla_muestra(tres, pico))) ? i : pico;
+        }
+        inicio = (pico > N / 2) ? pico - N / 2 : 0;
+        inicio = (inicio + N > tres->num_muestras) ? tres->num_muestras - N : inicio;
+    }
+
+    float maximo = 0.0f;
+    float v[FFT_TABLAS_MAX_SIZE];
+    for (int n = 0; n < N; n++)
+    {
+        switch (tipo)
+        {
+        case SENAL_IMPULSO:
+            v[n] = (n == 1) ? 1.0f : 0.0f; // Fuera del origen, para que intervengan los factores de giro
+            break;
+        case SENAL_TONO:
+            v[n] = cosf(2.0f * (float)PI * (N / 8 + 0.37f) * n / N + 0.3f); // Entre dos bins: reparte energía
+            break;
+        default:
+            v[n] = plantilla_muestra(tres, inicio + n);
+            break;
+        }
+        maximo = fmaxf(maximo, fabsf(v[n]));
+    }
+    for (int n = 0; n < N; n++)
+    {
+        x[n] = (int16_t)lrintf(v[n] * AMPLITUD_ADC / maximo);
+    }
+}
+
+// Relación señal/ruido (dB) y error máximo de bin relativo al pico de la referencia, sobre los bins 0..num_bins-1
+static void comparar(int num_bins, const float real[], const float imag[], const float ref_real[],
+                     const float ref_imag[], float *snr_db, float *error_bin)
+{
+    float potencia = 0.0f, ruido = 0.0f, pico = 0.0f, error = 0.0f;
+    for (int k = 0; k < num_bins; k++)
+    {
+        float dr = real[k] - ref_real[k], di = imag[k] - ref_imag[k];
+        potencia += ref_real[k] * ref_real[k] + ref_imag[k] * ref_imag[k];
+        ruido += dr * dr + di * di;
+        pico = fmaxf(pico, sqrtf(ref_real[k] * ref_real[k] + ref_imag[k] * ref_imag[k]));
+        error = fmaxf(error, sqrtf(dr * dr + di * di));
+    }
+    *snr_db = (ruido > 0.0f) ? 10.0f * log10f(potencia / ruido) : INFINITY;
+    *error_bin = error / pico;
+}
+
+// Compara fft_q15() y rfft_enteros() con fft_float() en un tamaño y una señal; devuelve 1 si cumplen las cotas
+static int probar(int N, int tipo)
+{
+    int16_t x[FFT_TABLAS_MAX_SIZE];
+    int16_t q15_real[FFT_TABLAS_MAX_SIZE], q15_imag[FFT_TABLAS_MAX_SIZE];
+    float ref_real[FFT_TABLAS_MAX_SIZE], ref_imag[FFT_TABLAS_MAX_SIZE];
+    float real[FFT_TABLAS_MAX_SIZE], imag[FFT_TABLAS_MAX_SIZE];
+    float snr_compleja, error_compleja, snr_real, error_real;
+
+    generar_senal(tipo, N, x);
+    for (int n = 0; n < N; n++)
+    {
+        ref_real[n] = x[n];
+        ref_imag[n] = 0.0f;
+    }
+    fft_float(N, ref_real, ref_imag);
+
+    // FFT compleja Q15: la entrada se lleva al rango de Q15 como hace fft() y la salida se devuelve a códigos
+    const int desplazamiento = 4; // AMPLITUD_ADC * 16 = 32752
+    for (int n = 0; n < N; n++)
+    {
+        q15_real[n] = (int16_t)(x[n] * (1 << desplazamiento));
+        q15_imag[n] = 0;
+    }
+    int exponente = fft_q15(N, q15_real, q15_imag);
+    float escala = ldexpf(1.0f, exponente - desplazamiento);
+    for (int k = 0; k < N; k++)
+    {
+        real[k] = q15_real[k] * escala;
+        imag[k] = q15_imag[k] * escala;
+    }
+    comparar(N, real, imag, ref_real, ref_imag, &snr_compleja, &error_compleja);
+
+    // FFT real sobre las muestras enteras: bins 0..N/2
+    rfft_enteros(N, x, real, imag);
+    comparar(N / 2 + 1, real, imag, ref_real, ref_imag, &snr_real, &error_real);
+
+    int correcta = (snr_compleja >= COTA_SNR_DB(N)) && (error_compleja <= COTA_ERROR_BIN) && (snr_real >= COTA_SNR_DB(N)) &&
+                   (error_real <= COTA_ERROR_BIN);
+    printf("N=%4d %-9s fft_q15: SNR %5.1f dB, error de bin %.1e; rfft_enteros: SNR %5.1f dB, error de bin %.1e%s\n", N,
+           nombres_senal[tipo], snr_compleja, error_compleja, snr_real, error_real, correcta ? "" : "  <- EXCEDE");
+    return correcta;
+}
+
+// Exactitud de la FFT Q15 (compleja y real sobre enteros) frente a fft_float() en cada tamaño admitido
+int main(void)
+{
+    int fallas = 0;
+
+    printf("Cotas: SNR >= 80 - 3 log2(N) dB, error de bin <= %.0e del pico\n", COTA_ERROR_BIN);
+    for (int N = 4; N <= FFT_TABLAS_MAX_SIZE; N *= 2)
+    {
+        for (int tipo = 0; tipo < NUM_SENALES; tipo++)
+        {
+            fallas += !probar(N, tipo);
+        }
+    }
+
+    if (fallas > 0)
+    {
+        printf("%d casos EXCEDEN las cotas\n", fallas);
+        return 1;
+    }
+    return 0;
+}
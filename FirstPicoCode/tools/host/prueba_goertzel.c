@@ -0,0 +1,178 @@
+#include <stdio.h>            /**< printf */
+#include <math.h>             /**< cos, sin, sqrt */
+#include "measure_libs.h"     /**< energia_bandas_goertzel, amplitud_promedio_ventana y dtw_banda */
+#include "base_de_datos.h"    /**< Señales de tres y dos aplausos */
+
+/**
+ * @def COTA_ERROR_BANDAS
+ * @brief Error relativo máximo de energia_bandas_goertzel() frente a la DFT directa de los mismos bins.
+ *
+ * Lo fija el redondeo de las muestras a Q GOERTZEL_Q (el máximo de la ventana queda entre 128 y 256 códigos):
+ * en ventanas con poca energía en los bins seguidos llega a ~2 %. Los coeficientes en Q14 aportan mucho menos.
+ */
+#define COTA_ERROR_BANDAS 0.03f
+
+/**
+ * @def MIN_ACIERTOS_GOERTZEL
+ * @brief Variantes de las plantillas que el extractor de Goertzel debe clasificar bien (de 36; la FFT acierta 36).
+ */
+#define MIN_ACIERTOS_GOERTZEL 30
+
+#define NUM_VENTANAS_PRUEBA 2000 /**< Ventanas pseudoaleatorias comparadas contra la DFT directa. */
+
+typedef float (*extractor_t)(const float *ventana);
+
+static uint32_t semilla = 12345;
+
+// Número pseudoaleatorio uniforme en [-1, 1)
+static float aleatorio(void)
+{
+    semilla = semilla * 1664525u + 1013904223u;
+    return (float)(semilla >> 8) / (float)(1u << 23) - 1.0f;
+}
+
+// Promedio de |X[k]| sobre goertzel_bins, por la definición de la DFT en doble precisión
+static double bandas_directas(const float *ventana)
+{
+    double suma = 0.0;
+    for (int b = 0; b < GOERTZEL_NUM_BANDAS; b++)
+    {
+        double re = 0.0, im = 0.0;
+        for (int n = 0; n < TAMANO_VENTANA; n++)
+        {
+            double fase = 2.0 * PI * goertzel_bins[b] * n / TAMANO_VENTANA;
+            re += ventana[n] * cos(fase);
+            im -= ventana[n] * sin(fase);
+        }
+        suma += sqrt(re * re + im * im);
+    }
+    return suma / GOERTZEL_NUM_BANDAS;
+}
+
+// Error relativo máximo de las dos variantes del extractor sobre ventanas de ruido, de tonos y de las plantillas
+static float probar_bandas(void)
+{
+    float ventana[TAMANO_VENTANA];
+    int16_t codigos[TAMANO_VENTANA];
+    float error = 0.0f;
+    const struct Plantilla_almacenada *tres = almacen_plantilla(PLANTILLA_TRES_APLAUSOS);
+
+    for (int v = 0; v < NUM_VENTANAS_PRUEBA; v++)
+    {
+        float amplitud = 0.05f + 0.95f * (aleatorio() + 1.0f) / 2.0f;
+        int bin = goertzel_bins[v % GOERTZEL_NUM_BANDAS];
+        for (int n = 0; n < TAMANO_VENTANA; n++)
+        {
+            switch (v % 3)
+            {
+            case 0: // Ruido uniforme
+                ventana[n] = amplitud * aleatorio();
+                break;
+            case 1: // Tono en un bin seguido más ruido leve
+                ventana[n] = amplitud * (0.9f * cosf(2.0f * (float)PI * bin * n / TAMANO_VENTANA + v) + 0.1f * aleatorio());
+                break;
+            default: // Ventana de la plantilla
+                ventana[n] = plantilla_muestra(tres, (v * TAMANO_VENTANA / 7 + n) % tres->num_muestras);
+                break;
+            }
+            codigos[n] = (int16_t)lrintf(ventana[n] * 2047.0f);
+        }
+
+        double referencia = bandas_directas(ventana);
+        if (referencia < 1e-3)
+        {
+            continue; // Ventana casi muda: el error relativo no dice nada
+        }
+        error = fmaxf(error, (float)(fabs(energia_bandas_goertzel(ventana) - referencia) / referencia));
+        error = fmaxf(error, (float)(fabs(energia_bandas_goertzel_enteros(codigos) / 2047.0 - referencia) / referencia));
+    }
+    return error;
+}
+
+// Envolvente de una señal de SAMPLES muestras con el extractor dado (ventanas cada SALTO_VENTANA)
+static void extraer(extractor_t extractor, const float *senal, struct Caracteristicas *c)
+{
+    c->num_ventanas = NUM_VENTANAS;
+    for (int v = 0; v < NUM_VENTANAS; v++)
+    {
+        c->amplitudes[v] = extractor(&senal[v * SALTO_VENTANA]);
+    }
+}
+
+// Extractor de la FFT completa con la firma de energia_bandas_goertzel()
+static float ventana_fft(const float *ventana)
+{
+    return amplitud_promedio_ventana(TAMANO_VENTANA, ventana);
+}
+
+// Vecino más cercano por DTW sobre 36 variantes (ganancia, desplazamiento y ruido) de las dos plantillas
+static int aciertos_clasificacion(extractor_t extractor)
+{
+    static struct Caracteristicas plantillas[2], consulta;
+    static float senal[SAMPLES];
+    const struct Plantilla_almacenada *senales[2] = {almacen_plantilla(PLANTILLA_TRES_APLAUSOS),
+                                                     almacen_plantilla(PLANTILLA_DOS_APLAUSOS)};
+    const float ganancias[] = {1.0f, 0.7f, 0.4f};
+    const int desplazamientos[] = {0, 3 * TAMANO_VENTANA, -3 * TAMANO_VENTANA};
+    const float ruidos[] = {0.0f, 0.05f};
+    int correctas = 0;
+
+    semilla = 12345;
+    for (int p = 0; p < 2; p++)
+    {
+        for (int i = 0; i < SAMPLES; i++)
+        {
+            senal[i] = (i < senales[p]->num_muestras) ? plantilla_muestra(senales[p], i) : 0.0f;
+        }
+        extraer(extractor, senal, &plantillas[p]);
+    }
+
+    for (int p = 0; p < 2; p++)
+    {
+        for (int g = 0; g < 3; g++)
+        {
+            for (int d = 0; d < 3; d++)
+            {
+                for (int r = 0; r < 2; r++)
+                {
+                    for (int i = 0; i < SAMPLES; i++)
+                    {
+                        int j = i - desplazamientos[d];
+                        float ruido = ruidos[r] * aleatorio();
+                        senal[i] = ((j >= 0) && (j < senales[p]->num_muestras) ? ganancias[g] * plantilla_muestra(senales[p], j) : 0.0f) + ruido;
+                    }
+                    extraer(extractor, senal, &consulta);
+
+                    float dist[2];
+                    for (int q = 0; q < 2; q++)
+                    {
+                        dist[q] = dtw_banda(consulta.amplitudes, consulta.num_ventanas, plantillas[q].amplitudes,
+                                            plantillas[q].num_ventanas, DTW_BANDA, 0.0f, NULL);
+                    }
+                    correctas += dist[p] < dist[1 - p];
+                }
+            }
+        }
+    }
+    return correctas;
+}
+
+// Exactitud del extractor de Goertzel y su capacidad de distinguir las plantillas
+int main(void)
+{
+    float error = probar_bandas();
+    int aciertos_fft = aciertos_clasificacion(ventana_fft);
+    int aciertos_goertzel = aciertos_clasificacion(energia_bandas_goertzel);
+
+    printf("Bandas de Goertzel frente a la DFT directa: error relativo maximo %.2e (cota %.2e)\n", error,
+           COTA_ERROR_BANDAS);
+    printf("Aciertos sobre 36 variantes: FFT completa %d, Goertzel %d (minimo %d)\n", aciertos_fft, aciertos_goertzel,
+           MIN_ACIERTOS_GOERTZEL);
+
+    if ((error > COTA_ERROR_BANDAS) || (aciertos_fft < 36) || (aciertos_goertzel < MIN_ACIERTOS_GOERTZEL))
+    {
+        printf("Extractor de Goertzel FUERA de lo esperado\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include <stdio.h>                   /**< printf */
+#include "precision_matematica.h"    /**< Medición y cotas de los núcleos aproximados */
+
+// Mide la exactitud de matematica_aproximada.h y falla si algún núcleo excede su cota documentada
+int main(void)
+{
+    struct Precision_matematica precision;
+
+    medir_precision_matematica(&precision);
+    printf("Magnitud alfa-max-beta-min: error relativo maximo %.4f (cota %.4f), entera %.4f (cota %.4f)\n",
+           precision.error_magnitud, COTA_ERROR_MAGNITUD, precision.error_magnitud_entera, COTA_ERROR_MAGNITUD_ENTERA);
+    printf("Raiz entera: %d resultados distintos de floor(sqrt(x)) en %d\n", precision.errores_raiz, PRECISION_PUNTOS);
+    printf("log2 por tabla: error absoluto maximo %.2e (cota %.2e)\n", precision.error_log2, COTA_ERROR_LOG2);
+    printf("exp2 por tabla: error relativo maximo %.2e (cota %.2e)\n", precision.error_exp2, COTA_ERROR_EXP2);
+
+    if (!precision_matematica_aceptable(&precision))
+    {
+        printf("Cotas documentadas EXCEDIDAS\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef PICO_STDLIB_HOST_H
+#define PICO_STDLIB_HOST_H
+
+/**
+ * @file stdlib.h
+ * @brief Sustituto mínimo de pico/stdlib.h para compilar en el host los módulos DSP del firmware.
+ *
+ * Solo declara lo que usan measure_libs.h y reconocedor.h; el resto del SDK no existe en el host.
+ */
+
+#include <stdint.h>    /**< Definiciones de tipos de datos enteros con tamaño fijo */
+#include <stdbool.h>   /**< Tipo bool */
+#include <time.h>      /**< clock_gettime para time_us_64 */
+
+typedef unsigned int uint;
+
+/**
+ * @brief Microsegundos de un reloj monótono, como time_us_64() del SDK.
+ * @return Tiempo en microsegundos.
+ */
+static inline uint64_t time_us_64(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000u + (uint64_t)t.tv_nsec / 1000u;
+}
+
+#endif // PICO_STDLIB_HOST_H